@@ -11,6 +11,13 @@
 #      STREAMR_TS_NETWORK_DIR). Read with `git show`, so the checkout does
 #      not need to have the pin checked out.
 #   2. raw.githubusercontent.com at the pinned commit (used in CI).
+#
+# The one exception are native-only additions: messages, fields and RPCs
+# that only native nodes exchange and that TS nodes never see (the fields
+# use tag numbers the TS schema leaves unused, so TS nodes skip them as
+# unknown fields). They are fenced by "// NATIVE-ONLY BEGIN" and
+# "// NATIVE-ONLY END" lines and are dropped, along with the blank lines
+# right before them, before comparing. See README.md.
 
 set -e
 
@@ -39,13 +46,23 @@ fetch_reference() {
     fi
 }
 
+strip_native_only() {
+    awk '
+        /NATIVE-ONLY BEGIN/ { blanks = 0; skip = 1; next }
+        skip { if (/NATIVE-ONLY END/) skip = 0; next }
+        /^$/ { blanks++; next }
+        { for (; blanks > 0; blanks--) print ""; print }
+        END { for (; blanks > 0; blanks--) print "" }
+    ' "$1"
+}
+
 failures=0
 for entry in "${PROTO_MAP[@]}"; do
     local_path="${entry%%:*}"
     upstream_path="${entry#*:}"
     if ! fetch_reference "$upstream_path" |
         diff -u --label "$upstream_path@$PIN" --label "$local_path" \
-            - "$REPO_DIR/$local_path"; then
+            - <(strip_native_only "$REPO_DIR/$local_path"); then
         failures=$((failures + 1))
     fi
 done
@@ -4,8 +4,17 @@
 module;
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 export module streamr.dht.Identifiers;
@@ -29,11 +38,172 @@ using ServiceID = streamr::utils::Branded<std::string, struct ServiceIDBrand>;
 
 inline constexpr size_t kademliaIdLengthInBytes = 20;
 
+namespace detail {
+
+inline constexpr std::string_view hexDigits = "0123456789abcdef";
+
+// Lowercase hex of `bytes`, sized up front: ids are hex-encoded on every
+// peer descriptor lookup, so this avoids boost's per-char back_inserter.
+inline std::string encodeHex(const uint8_t* bytes, size_t size) {
+    std::string hex(size * 2, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        hex[2 * i] = hexDigits[bytes[i] >> 4U];
+        hex[(2 * i) + 1] = hexDigits[bytes[i] & 0x0fU]; // NOLINT
+    }
+    return hex;
+}
+
+} // namespace detail
+
+/**
+ * A kademlia id in binary: trivially copyable and compared and hashed
+ * without allocating, so the contact lists, KBucket and
+ * ConnectionManager's endpoint table key their contacts by it. Hex (DhtAddress) is produced only at
+ * the API boundary. Like TS, those APIs accept ids shorter than a
+ * kademlia id (the ported tests use 3- and 4-byte ids): the bytes are
+ * left-aligned and zero-padded, and the real length is kept, so two ids
+ * are equal only if their raw bytes are. Ids longer than a kademlia id
+ * are rejected.
+ */
+class NodeId {
+public:
+    using Bytes = std::array<uint8_t, kademliaIdLengthInBytes>;
+
+private:
+    Bytes bytes{};
+    // Declared after the bytes, so the defaulted ordering is that of the
+    // raw byte strings.
+    uint8_t length = kademliaIdLengthInBytes;
+
+public:
+    constexpr NodeId() = default;
+
+    explicit constexpr NodeId(const Bytes& bytes) : bytes(bytes) {}
+
+    // The id, or nullopt if it is longer than kademliaIdLengthInBytes.
+    static std::optional<NodeId> tryFromRaw(std::string_view raw) {
+        if (raw.size() > kademliaIdLengthInBytes) {
+            return std::nullopt;
+        }
+        NodeId id;
+        std::memcpy(id.bytes.data(), raw.data(), raw.size());
+        id.length = static_cast<uint8_t>(raw.size());
+        return id;
+    }
+
+    static NodeId fromRaw(std::string_view raw) {
+        const auto id = tryFromRaw(raw);
+        if (!id.has_value()) {
+            throw std::invalid_argument(
+                "NodeId must be at most " +
+                std::to_string(kademliaIdLengthInBytes) + " bytes, received " +
+                std::to_string(raw.size()));
+        }
+        return id.value();
+    }
+
+    // The id, or nullopt if the address is not hex of at most
+    // kademliaIdLengthInBytes bytes.
+    static std::optional<NodeId> tryFromDhtAddress(
+        const DhtAddress& address) {
+        if (address.size() % 2 != 0 ||
+            address.size() > kademliaIdLengthInBytes * 2) {
+            return std::nullopt;
+        }
+        NodeId id;
+        id.length = static_cast<uint8_t>(address.size() / 2);
+        for (size_t i = 0; i < id.length; ++i) {
+            const int high = fromHexDigit(address[2 * i]);
+            const int low = fromHexDigit(address[(2 * i) + 1]);
+            if (high < 0 || low < 0) {
+                return std::nullopt;
+            }
+            id.bytes[i] = static_cast<uint8_t>((high << 4) | low);
+        }
+        return id;
+    }
+
+    static NodeId fromDhtAddress(const DhtAddress& address) {
+        const auto id = tryFromDhtAddress(address);
+        if (!id.has_value()) {
+            throw std::invalid_argument(
+                "NodeId must be hex of at most " +
+                std::to_string(kademliaIdLengthInBytes) +
+                " bytes, received: " + address);
+        }
+        return id.value();
+    }
+
+    static NodeId fromPeerDescriptor(
+        const ::dht::PeerDescriptor& peerDescriptor) {
+        return fromRaw(peerDescriptor.nodeid());
+    }
+
+    // The id left-aligned in a full kademlia id, zero-padded if shorter.
+    [[nodiscard]] constexpr const Bytes& getBytes() const {
+        return this->bytes;
+    }
+
+    [[nodiscard]] constexpr size_t size() const { return this->length; }
+
+    [[nodiscard]] constexpr bool isFullLength() const {
+        return this->length == kademliaIdLengthInBytes;
+    }
+
+    [[nodiscard]] DhtAddressRaw toRaw() const {
+        return DhtAddressRaw{std::string(
+            this->bytes.begin(), this->bytes.begin() + this->length)};
+    }
+
+    [[nodiscard]] DhtAddress toDhtAddress() const {
+        return DhtAddress{detail::encodeHex(this->bytes.data(), this->length)};
+    }
+
+    constexpr auto operator<=>(const NodeId&) const = default;
+    constexpr bool operator==(const NodeId&) const = default;
+
+private:
+    static constexpr int fromHexDigit(char c) {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10; // NOLINT(readability-magic-numbers)
+        }
+        if (c >= 'A' && c <= 'F') {
+            return c - 'A' + 10; // NOLINT(readability-magic-numbers)
+        }
+        return -1;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<NodeId>);
+
+// Hash for NodeId keys. Ids are uniformly distributed (random or
+// keccak-derived), so folding the words is enough mixing.
+struct NodeIdHash {
+    size_t operator()(const NodeId& id) const noexcept {
+        const auto& bytes = id.getBytes();
+        uint64_t first = 0;
+        uint64_t second = 0;
+        uint32_t third = 0;
+        std::memcpy(&first, bytes.data(), sizeof(first));
+        std::memcpy(&second, bytes.data() + sizeof(first), sizeof(second));
+        std::memcpy(
+            &third,
+            bytes.data() + sizeof(first) + sizeof(second),
+            sizeof(third));
+        return static_cast<size_t>(
+            first ^ std::rotl(second, 21) ^ third ^ id.size()); // NOLINT
+    }
+};
+
 struct Identifiers {
     using PeerDescriptor = ::dht::PeerDescriptor;
 
     static DhtAddress getDhtAddressFromRaw(const DhtAddressRaw& raw) {
-        return DhtAddress{BinaryUtils::binaryStringToHex(raw)};
+        return DhtAddress{detail::encodeHex(
+            reinterpret_cast<const uint8_t*>(raw.data()), raw.size())};
     }
 
     static DhtAddressRaw getRawFromDhtAddress(const DhtAddress& address) {
@@ -15,6 +15,7 @@ export module streamr.dht.Connection;
 
 import streamr.eventemitter.EventEmitter;
 import streamr.logger.SLogger;
+import streamr.dht.SendBuffer;
 import streamr.utils.Branded;
 import streamr.utils.Uuid;
 
@@ -69,7 +70,7 @@ protected:
     explicit Connection(ConnectionType type) : mType(type) {}
 
 public:
-    virtual void send(const std::vector<std::byte>& data) = 0;
+    virtual void send(const SendBuffer& data) = 0;
     virtual void close(bool gracefulLeave) = 0;
     virtual void destroy() = 0;
 
@@ -2,29 +2,45 @@
 // CONSOLIDATED from the former header
 // streamr-dht/connection/ConnectionManager.hpp (MODERNIZATION.md Phase 2.6):
 // this file is now the source of truth.
+//
+// Connection garbage collection follows TS: every
+// garbageCollectionInterval the connections above maxConnections that are
+// unlocked, not private and idle for garbageCollectionIdleLimit are
+// gracefully disconnected. TS picks them by distance from the local node;
+// this port disconnects the least recently used first. The periodic pass
+// and the disconnects run on the shared worker pool, tracked by a scope
+// that stop() drains.
 module;
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
-#include <ranges>
 
 // Coroutine definitions need std::coroutine_traits declared in THIS
 // translation unit; it cannot arrive through an imported BMI.
 #include <coroutine> // IWYU pragma: keep
 
+#include <cstddef>
 #include <cstdint>
-#include <map>
 #include <memory>
-#include <mutex>
+#include <span>
 #include <utility>
 
 #include <string>
+#include <tuple>
+#include <vector>
+#include <google/protobuf/arena.h>
 
 export module streamr.dht.ConnectionManager;
 
 import streamr.dht.protos;
 
+import streamr.utils.AbortController;
 import streamr.utils.CoroutineHelper;
+import streamr.utils.GuardedAsyncScope;
+import streamr.utils.SharedExecutors;
+import streamr.protorpc.DispatchArena;
 import streamr.protorpc.RpcCommunicator;
 import streamr.dht.ConnectionLockStates;
 import streamr.logger.SLogger;
@@ -36,10 +52,12 @@ import streamr.dht.ConnectionsView;
 import streamr.dht.ConnectorFacade;
 import streamr.dht.DuplicateDetector;
 import streamr.dht.Endpoint;
+import streamr.dht.EndpointTable;
 import streamr.dht.Errors;
 import streamr.dht.Identifiers;
 import streamr.dht.Offerer;
 import streamr.dht.RoutingRpcCommunicator;
+import streamr.dht.SendBuffer;
 import streamr.dht.Transport;
 
 // Hoisted from the former header (file scope, NOT exported);
@@ -47,6 +65,7 @@ import streamr.dht.Transport;
 // at file scope than inside the package namespace.
 using streamr::logger::SLogger;
 using streamr::protorpc::RpcCommunicatorOptions;
+using streamr::utils::AbortController;
 using streamr::utils::waitForEvent;
 
 export namespace streamr::dht::connection {
@@ -62,7 +81,9 @@ using streamr::dht::connection::ConnectionLockRpcLocal;
 using streamr::dht::connection::ConnectionsView;
 using streamr::dht::connection::IPendingConnection;
 using streamr::dht::connection::PendingConnection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::endpoint::Endpoint;
+using streamr::dht::connection::endpoint::EndpointTable;
 using streamr::dht::helpers::CannotConnectToSelf;
 using streamr::dht::helpers::CouldNotStart;
 using streamr::dht::helpers::Offerer;
@@ -85,13 +106,20 @@ enum class ConnectionManagerState : std::uint8_t {
     STOPPED
 };
 
+// TS ConnectionManager applies the same default when none is given.
+inline constexpr size_t DEFAULT_MAX_CONNECTIONS = 80;
+
 struct ConnectionManagerOptions {
-    size_t maxConnections;
+    size_t maxConnections = DEFAULT_MAX_CONNECTIONS;
     // MetricsContext metricsContext;
     std::function<std::shared_ptr<ConnectorFacade>()> createConnectorFacade;
     // Whether remote peers may mark their connection to us as private
     // (setPrivate RPC); mirrors the TS option of the same name.
     bool allowIncomingPrivateConnections = false;
+    // How often connections above maxConnections are collected, and how
+    // long a connection must have been idle to be collected.
+    std::chrono::milliseconds garbageCollectionInterval{5000};
+    std::chrono::milliseconds garbageCollectionIdleLimit{15000};
 };
 
 class ConnectionManager : public Transport,
@@ -106,33 +134,32 @@ private:
     DuplicateDetector duplicateMessageDetector;
 
     std::atomic<ConnectionManagerState> state = ConnectionManagerState::IDLE;
-    std::map<DhtAddress, std::shared_ptr<Endpoint>> endpoints;
-    std::recursive_mutex endpointsMutex;
+    EndpointTable endpoints;
     // Monotonic counter handed to Endpoint::setConnecting so an endpoint
     // adopts pending connections in tie-break decision order even when the
-    // setConnecting() calls race across threads; guarded by endpointsMutex.
-    // See acceptNewConnection().
-    uint64_t connectingSequenceCounter = 0;
+    // setConnecting() calls race across threads; incremented under the
+    // peer's shard lock. See acceptNewConnection().
+    std::atomic<uint64_t> connectingSequenceCounter = 0;
+
+    // Connection garbage collection (see the file comment); aborted and
+    // drained by stop().
+    AbortController garbageCollectionAbortController;
+    streamr::utils::SharedSerialExecutor garbageCollectionExecutor{
+        streamr::utils::SharedExecutors::worker()};
+    streamr::utils::GuardedAsyncScope garbageCollectionScope;
+    std::atomic<uint64_t> evictedConnectionCount = 0;
 
     // Constructs an Endpoint for the peer and wires its listeners; pure
     // construction with no call-outs, so acceptNewConnection() may run
-    // it while holding endpointsMutex. The caller inserts the endpoint
+    // it while holding the peer's shard lock. The caller inserts the endpoint
     // into the container and starts it connecting.
     [[nodiscard]] std::shared_ptr<Endpoint> createEndpoint(
-        const PeerDescriptor& peerDescriptor, const DhtAddress& nodeId) {
+        const PeerDescriptor& peerDescriptor, const NodeId& endpointKey) {
         SLogger::debug("ConnectionManager::createEndpoint start");
 
         auto endpoint = Endpoint::newInstance(
-            peerDescriptor, [this, peerDescriptor, nodeId]() {
-                {
-                    SLogger::debug(
-                        "Trying to acquire mutex lock in endpoint callback");
-                    std::scoped_lock lock(this->endpointsMutex);
-                    SLogger::debug("Acquired mutex lock in endpoint callback");
-                    if (this->endpoints.contains(nodeId)) {
-                        this->endpoints.erase(nodeId);
-                    }
-                }
+            peerDescriptor, [this, peerDescriptor, endpointKey]() {
+                this->endpoints.erase(endpointKey);
                 this->emit<Disconnected>(peerDescriptor, true);
             });
 
@@ -149,11 +176,24 @@ private:
         return endpoint;
     }
 
+    // The peer's endpoint, or nullptr. A peer whose id is longer than a
+    // kademlia id never has one.
+    [[nodiscard]] std::shared_ptr<Endpoint> findEndpoint(
+        const PeerDescriptor& peerDescriptor) {
+        const auto endpointKey = NodeId::tryFromRaw(peerDescriptor.nodeid());
+        return endpointKey.has_value()
+            ? this->endpoints.find(endpointKey.value())
+            : nullptr;
+    }
+
 public:
     // NOLINTNEXTLINE
     static constexpr auto INTERNAL_SERVICE_ID = "system/connection-manager";
     // NOLINTNEXTLINE
     static constexpr auto DUPLICATE_DETECTOR_SIZE = 10000;
+    // The stack block of onData()'s arena; most RPC frames fit in it.
+    // NOLINTNEXTLINE
+    static constexpr size_t ARENA_INITIAL_BLOCK_SIZE = 4096;
 
     explicit ConnectionManager(ConnectionManagerOptions&& options)
         : options(std::move(options)),
@@ -236,7 +276,7 @@ public:
         SLogger::trace("~ConnectionManager()");
         this->stop();
         // Drain the lock-RPC communicator's straggler coroutines while the
-        // members they reach (endpoints, endpointsMutex, state) are still
+        // members they reach (endpoints, state) are still
         // alive — rpcCommunicator is declared before them, so its own
         // destructor drain would run after they are destroyed, and
         // sendIfStopped responses bypass the stopped-state guard in send().
@@ -244,7 +284,69 @@ public:
         SLogger::debug("~ConnectionManager() end");
     };
 
-    // garbageCollectConnections() not implemented in native-sdk
+    // Gracefully disconnects the least recently used connections above
+    // maxConnections. Connections that are locked (locally, remotely or
+    // weakly), private or used within lastUsedLimit are kept. Returns the
+    // number of connections evicted; the disconnects complete in the
+    // background.
+    size_t garbageCollectConnections(
+        size_t maxConnections, std::chrono::milliseconds lastUsedLimit) {
+        if (this->state != ConnectionManagerState::RUNNING) {
+            return 0;
+        }
+        const auto endpointsSnapshot = this->endpoints.getEndpoints();
+        if (endpointsSnapshot.size() <= maxConnections) {
+            return 0;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<std::shared_ptr<Endpoint>> candidates;
+        for (const auto& endpoint : endpointsSnapshot) {
+            const auto nodeId = Identifiers::getNodeIdFromPeerDescriptor(
+                endpoint->getPeerDescriptor());
+            if (!this->locks.isLocked(nodeId) &&
+                !this->locks.isPrivate(nodeId) &&
+                now - endpoint->getLastUsed() > lastUsedLimit) {
+                candidates.push_back(endpoint);
+            }
+        }
+        // Coldest first; the last-used times are sampled once so the sort
+        // sees a consistent order.
+        std::vector<std::pair<std::chrono::steady_clock::time_point, size_t>>
+            order;
+        order.reserve(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            order.emplace_back(candidates[i]->getLastUsed(), i);
+        }
+        std::ranges::sort(order);
+        const size_t evictCount = std::min(
+            candidates.size(), endpointsSnapshot.size() - maxConnections);
+        if (evictCount == 0) {
+            return 0;
+        }
+        std::vector<folly::coro::Task<void>> evictions;
+        evictions.reserve(evictCount);
+        for (size_t i = 0; i < evictCount; ++i) {
+            evictions.push_back(
+                this->evictConnection(candidates[order[i].second]));
+        }
+        this->evictedConnectionCount += evictCount;
+        SLogger::debug(
+            "Garbage collecting " + std::to_string(evictCount) + " of " +
+            std::to_string(endpointsSnapshot.size()) + " connections");
+        this->garbageCollectionScope.add(
+            streamr::utils::co_withExecutor(
+                &this->garbageCollectionExecutor,
+                streamr::utils::co_withCancellation(
+                    this->garbageCollectionAbortController.getSignal()
+                        .getCancellationToken(),
+                    folly::coro::collectAllRange(std::move(evictions)))));
+        return evictCount;
+    }
+
+    // Connections disconnected by garbage collection since start.
+    [[nodiscard]] uint64_t getEvictedConnectionCount() const {
+        return this->evictedConnectionCount;
+    }
 
     void start() {
         SLogger::debug("ConnectionManager::start() start");
@@ -267,13 +369,13 @@ public:
                 return this->hasConnection(nodeId);
             });
 
-        // Garbage collection of connections not implemented in native-sdk
+        this->scheduleGarbageCollection();
         SLogger::debug("ConnectionManager::start() end");
     }
 
     void stop() override {
         SLogger::debug("ConnectionManager::stop() start");
-        std::map<DhtAddress, std::shared_ptr<Endpoint>> endpointsCopy;
+        std::vector<std::shared_ptr<Endpoint>> endpointsCopy;
         {
             if (this->state == ConnectionManagerState::STOPPED ||
                 this->state == ConnectionManagerState::STOPPING) {
@@ -282,24 +384,18 @@ public:
             }
             this->state = ConnectionManagerState::STOPPING;
             SLogger::trace("Stopping ConnectionManager");
+            // Before the endpoints are snapshotted: a collection pass
+            // disconnecting concurrently with the stop would race it.
+            this->garbageCollectionAbortController.abort();
+            this->garbageCollectionScope.close();
 
-            {
-                SLogger::debug("Trying to acquire mutex lock in stop");
-                std::scoped_lock lock(this->endpointsMutex);
-                SLogger::debug("Acquired mutex lock in stop");
-                // make temporary copy of endpoints to avoid iterator
-                // invalidation
-                endpointsCopy = this->endpoints;
-            }
+            // A copy: disconnecting removes the endpoints from the table.
+            endpointsCopy = this->endpoints.getEndpoints();
         }
-        // pop one by one from copy to avoid iterator invalidation
 
-        while (!endpointsCopy.empty()) {
-            auto it = endpointsCopy.begin();
-            auto peerDescriptorToDisconnect = it->second->getPeerDescriptor();
-            endpointsCopy.erase(it);
+        for (const auto& endpoint : endpointsCopy) {
             this->gracefullyDisconnect(
-                std::move(peerDescriptorToDisconnect), DisconnectMode::LEAVING);
+                endpoint->getPeerDescriptor(), DisconnectMode::LEAVING);
         }
 
         this->connectorFacade->stop();
@@ -334,37 +430,26 @@ public:
 
         const auto nodeId =
             Identifiers::getNodeIdFromPeerDescriptor(peerDescriptor);
+        const auto endpointKey = NodeId::tryFromRaw(peerDescriptor.nodeid());
+        if (!endpointKey.has_value()) {
+            throw SendFailed("Target node id is longer than a kademlia id");
+        }
         SLogger::debug("Retrieved node ID");
-        SLogger::trace("Sending message to: " + nodeId);
+        SLogger::trace([&nodeId]() { return "Sending message to: " + nodeId; });
         SLogger::debug("Traced sending message to node");
 
-        Message messageWithSource = message;
-        SLogger::debug("Created message with source");
-        messageWithSource.mutable_sourcedescriptor()->CopyFrom(
-            this->getLocalPeerDescriptor());
-        SLogger::debug("Copied local peer descriptor to message");
-
-        const auto debugMessage = messageWithSource.DebugString();
-        SLogger::debug("Created debug message string");
-        SLogger::trace("Sending message: " + debugMessage);
+        SLogger::trace([&message]() {
+            return "Sending message: " + message.DebugString();
+        });
         SLogger::debug("Traced sending message details");
 
-        // endpointsMutex is held only for the container lookups;
-        // createConnection/onNewConnection and the endpoint queries lead
-        // into the connector facade and the endpoint state machine, and
-        // holding the container lock across them nests it with the
-        // endpoint mutex (phase-A0 locking policy: no call-outs under
-        // endpointsMutex).
-        std::shared_ptr<Endpoint> endpoint;
-        {
-            SLogger::debug("Trying to acquire mutex lock in send");
-            std::scoped_lock lock(this->endpointsMutex);
-            SLogger::debug("Acquired mutex lock in send");
-            const auto it = this->endpoints.find(nodeId);
-            if (it != this->endpoints.end()) {
-                endpoint = it->second;
-            }
-        }
+        // The endpoint table is locked only for the lookups (a shared
+        // lock on the peer's shard); createConnection/onNewConnection and
+        // the endpoint queries lead into the connector facade and the
+        // endpoint state machine, and holding a table lock across them
+        // nests it with the endpoint mutex (phase-A0 locking policy: no
+        // call-outs under the table locks).
+        auto endpoint = this->endpoints.find(endpointKey.value());
         if (!endpoint) {
             SLogger::debug("Node ID not found in endpoints");
             if (!sendOptions.connect) {
@@ -397,18 +482,13 @@ public:
                 this->onNewConnection(connection, /*isLocalInitiated=*/true);
             SLogger::debug("Handled new connection");
             if (!accepted) {
-                SLogger::trace(
-                    "send(): outgoing connection rejected by the tie-break,"
-                    " using the existing endpoint for " +
-                    nodeId);
-            }
-            {
-                std::scoped_lock lock(this->endpointsMutex);
-                const auto it = this->endpoints.find(nodeId);
-                if (it != this->endpoints.end()) {
-                    endpoint = it->second;
-                }
+                SLogger::trace([&nodeId]() {
+                    return "send(): outgoing connection rejected by the"
+                           " tie-break, using the existing endpoint for " +
+                        nodeId;
+                });
             }
+            endpoint = this->endpoints.find(endpointKey.value());
             if (!endpoint) {
                 SLogger::debug(
                     "Node ID not found in endpoints after creating new connection, this means that the connection failed");
@@ -420,20 +500,9 @@ public:
             throw SendFailed("No connection to target, connect flag is false");
         }
         SLogger::debug("Passed connection checks");
-        size_t nBytes = messageWithSource.ByteSizeLong();
-        SLogger::debug("Calculated message size");
-        if (nBytes == 0) {
-            SLogger::debug("Message size is zero, throwing exception");
-            SLogger::error("send(): serialized message is empty");
-            throw SendFailed("send(): serialized message is empty");
-        }
-        SLogger::debug("Passed message size check");
-        std::vector<std::byte> byteVec(nBytes);
-        SLogger::debug("Created byte vector");
-        messageWithSource.SerializeToArray(
-            byteVec.data(), static_cast<int>(nBytes));
-        SLogger::debug("Serialized message to byte vector");
-        endpoint->send(byteVec);
+        const auto buffer = this->serializeWithSource(message);
+        SLogger::debug("Serialized message to a send buffer");
+        endpoint->send(buffer);
         SLogger::debug("Sent message through endpoint");
         SLogger::debug("ConnectionManager::send() end");
     }
@@ -517,14 +586,9 @@ public:
             Identifiers::getNodeIdFromPeerDescriptor(targetDescriptor);
         this->locks.removeLocalLocked(nodeId, lockId);
 
-        {
-            SLogger::debug("Trying to acquire mutex lock in unlockConnection");
-            std::scoped_lock lock(this->endpointsMutex);
-            SLogger::debug("Acquired mutex lock in unlockConnection");
-            if (!this->endpoints.contains(nodeId)) {
-                SLogger::debug("Node ID not found in endpoints");
-                co_return;
-            }
+        if (this->findEndpoint(targetDescriptor) == nullptr) {
+            SLogger::debug("Node ID not found in endpoints");
+            co_return;
         }
 
         ConnectionLockRpcClient client{this->rpcCommunicator};
@@ -569,16 +633,11 @@ public:
     }
 
     [[nodiscard]] std::vector<PeerDescriptor> getConnections() override {
-        // Snapshot the endpoints under the container lock, query them
-        // after releasing it: isConnected() takes the endpoint
-        // state-machine mutex, and nesting it under endpointsMutex is
+        // Snapshot the endpoints under the table locks, query them
+        // after releasing them: isConnected() takes the endpoint
+        // state-machine mutex, and nesting it under a table lock is
         // against the phase-A0 locking policy.
-        std::vector<std::shared_ptr<Endpoint>> endpointsSnapshot;
-        {
-            std::scoped_lock lock(this->endpointsMutex);
-            endpointsSnapshot = this->endpoints | std::views::values |
-                std::ranges::to<std::vector>();
-        }
+        const auto endpointsSnapshot = this->endpoints.getEndpoints();
         // Materialized with a single-pass loop, NOT a views::filter |
         // ranges::to pipeline: for a forward range libc++'s to<vector> walks
         // the range twice (ranges::distance to size the allocation, then the
@@ -597,6 +656,48 @@ public:
     }
 
 private:
+    // Serializes message with the local peer descriptor as its source.
+    // The source is serialized as a second Message holding only that
+    // field and written right after the message instead of being set on
+    // a copy: protobuf parses concatenated messages as one merged
+    // message, and copying the whole message (payload included) for
+    // every target was the costliest step of a broadcast fan-out. A
+    // message that already has a source descriptor takes the copying
+    // path, since the merge would combine the two descriptors.
+    // The bytes are written straight into a pooled SendBuffer, which the
+    // endpoint and the connection share instead of copying.
+    [[nodiscard]] SendBuffer serializeWithSource(
+        const Message& message) const {
+        auto source = this->getLocalPeerDescriptor();
+        if (message.has_sourcedescriptor()) {
+            Message messageWithSource = message;
+            *messageWithSource.mutable_sourcedescriptor() = std::move(source);
+            return ConnectionManager::serialize(messageWithSource);
+        }
+        Message sourceOnly;
+        *sourceOnly.mutable_sourcedescriptor() = std::move(source);
+        const size_t messageSize = message.ByteSizeLong();
+        const size_t sourceSize = sourceOnly.ByteSizeLong();
+        return SendBuffer::create(
+            messageSize + sourceSize, [&](std::span<std::byte> bytes) {
+                auto* target = reinterpret_cast<uint8_t*>(bytes.data());
+                target = message.SerializeWithCachedSizesToArray(target);
+                sourceOnly.SerializeWithCachedSizesToArray(target);
+            });
+    }
+
+    static SendBuffer serialize(const Message& message) {
+        const size_t nBytes = message.ByteSizeLong();
+        if (nBytes == 0) {
+            SLogger::error("send(): serialized message is empty");
+            throw SendFailed("send(): serialized message is empty");
+        }
+        return SendBuffer::create(nBytes, [&](std::span<std::byte> bytes) {
+            message.SerializeWithCachedSizesToArray(
+                reinterpret_cast<uint8_t*>(bytes.data()));
+        });
+    }
+
     // isLocalInitiated: true for a connection we created ourselves
     // (send() -> createConnection, outgoing), false for one handed to us
     // by the connector (incoming, initiated by the remote peer).
@@ -624,7 +725,14 @@ private:
         const auto peerDescriptor = newConnection->getPeerDescriptor();
         const auto nodeId =
             Identifiers::getNodeIdFromPeerDescriptor(peerDescriptor);
-        // Resolved before taking endpointsMutex: getLocalPeerDescriptor()
+        const auto endpointKey = NodeId::tryFromRaw(peerDescriptor.nodeid());
+        if (!endpointKey.has_value()) {
+            SLogger::debug(
+                "acceptNewConnection(): rejected a node id longer than a "
+                "kademlia id");
+            return false;
+        }
+        // Resolved before taking the shard lock: getLocalPeerDescriptor()
         // calls out into the connector facade.
         const auto localNodeId = Identifiers::getNodeIdFromPeerDescriptor(
             this->getLocalPeerDescriptor());
@@ -651,37 +759,40 @@ private:
             OffererHelper::getOfferer(localNodeId, nodeId) == Offerer::LOCAL;
         const bool newConnectionWins = (isLocalInitiated == localIsOfferer);
 
-        // The exists-check and the insert happen under one lock hold, so
-        // two racing accepts for the same peer cannot both insert (the
-        // second one would silently orphan the first endpoint). The
-        // endpoint calls (setConnecting) run after the lock is released:
-        // they take the endpoint's state-machine mutex and lead to
-        // call-outs, and holding endpointsMutex across them was one half
-        // of the phase-A0 ABBA inversion (the other half being
+        // The exists-check and the insert happen under one hold of the
+        // peer's shard lock, so two racing accepts for the same peer cannot
+        // both insert (the second one would silently orphan the first
+        // endpoint). The endpoint calls (setConnecting) run after the lock
+        // is released: they take the endpoint's state-machine mutex and
+        // lead to call-outs, and holding the table lock across them was one
+        // half of the phase-A0 ABBA inversion (the other half being
         // handleDisconnect -> removeSelfFromContainer, which now runs
         // without the state-machine mutex held).
         std::shared_ptr<Endpoint> existingEndpoint;
         std::shared_ptr<Endpoint> createdEndpoint;
         uint64_t sequenceNumber = 0;
-        {
-            SLogger::debug("ConnectionManager::acceptNewConnection() start");
-            std::scoped_lock lock(this->endpointsMutex);
-            SLogger::debug("Acquired mutex lock in acceptNewConnection");
-
-            const auto it = this->endpoints.find(nodeId);
-            if (it != this->endpoints.end()) {
-                if (!newConnectionWins) {
-                    return false;
+        SLogger::debug("ConnectionManager::acceptNewConnection() start");
+        const bool accepted = this->endpoints.update(
+            endpointKey.value(), [&](EndpointTable::Shard& shard) {
+                const auto it = shard.find(endpointKey.value());
+                if (it != shard.end()) {
+                    if (!newConnectionWins) {
+                        return false;
+                    }
+                    existingEndpoint = it->second;
+                } else {
+                    createdEndpoint = this->createEndpoint(
+                        peerDescriptor, endpointKey.value());
+                    shard.emplace(endpointKey.value(), createdEndpoint);
                 }
-                existingEndpoint = it->second;
-            } else {
-                createdEndpoint = this->createEndpoint(peerDescriptor, nodeId);
-                this->endpoints.emplace(nodeId, createdEndpoint);
-            }
-            // Assigned in decision order under the lock; the endpoint uses
-            // it to ignore an adoption that a thread race would otherwise
-            // apply out of order.
-            sequenceNumber = ++this->connectingSequenceCounter;
+                // Assigned in decision order under the shard lock; the
+                // endpoint uses it to ignore an adoption that a thread race
+                // would otherwise apply out of order.
+                sequenceNumber = ++this->connectingSequenceCounter;
+                return true;
+            });
+        if (!accepted) {
+            return false;
         }
         if (existingEndpoint) {
             existingEndpoint->setConnecting(newConnection, sequenceNumber);
@@ -701,16 +812,8 @@ private:
         SLogger::trace(nodeId + " closeConnection() " + reason.value_or(""));
         this->locks.clearAllLocks(nodeId);
 
-        std::shared_ptr<Endpoint> endpoint;
-        {
-            SLogger::debug("ConnectionManager::closeConnection() start");
-            std::scoped_lock lock(this->endpointsMutex);
-            SLogger::debug("Acquired mutex lock in closeConnection");
-            auto it = this->endpoints.find(nodeId);
-            if (it != this->endpoints.end()) {
-                endpoint = it->second;
-            }
-        }
+        SLogger::debug("ConnectionManager::closeConnection() start");
+        const auto endpoint = this->findEndpoint(peerDescriptor);
 
         if (endpoint) {
             endpoint->close(gracefulLeave);
@@ -726,18 +829,7 @@ private:
         PeerDescriptor&& targetDescriptor, DisconnectMode&& disconnectMode) {
         SLogger::debug("ConnectionManager::gracefullyDisconnect() start");
 
-        std::shared_ptr<Endpoint> endpoint = nullptr;
-        {
-            SLogger::debug(
-                "Trying to acquire mutex lock in gracefullyDisconnect");
-            std::unique_lock lock(this->endpointsMutex);
-            SLogger::debug("Acquired mutex lock in gracefullyDisconnect");
-            auto it = this->endpoints.find(
-                Identifiers::getNodeIdFromPeerDescriptor(targetDescriptor));
-            if (it != this->endpoints.end()) {
-                endpoint = it->second;
-            }
-        }
+        const auto endpoint = this->findEndpoint(targetDescriptor);
         if (endpoint == nullptr) {
             SLogger::debug(
                 "gracefullyDisconnected() tried on a non-existing connection");
@@ -746,27 +838,8 @@ private:
         if (endpoint->isConnected()) {
             try {
                 SLogger::debug("gracefullyDisconnect() calling blockingWait()");
-                streamr::utils::blockingWait(
-                    folly::coro::co_invoke(
-                        [this,
-                         endpoint,
-                         targetDescriptor = std::move(targetDescriptor),
-                         disconnectMode]() -> folly::coro::Task<void> {
-                            co_await folly::coro::collectAll(
-                                waitForEvent<endpointevents::Disconnected>(
-                                    endpoint.get(), 2000ms), // NOLINT
-                                folly::coro::co_invoke(
-                                    [this,
-                                     endpoint,
-                                     targetDescriptor,
-                                     disconnectMode]()
-                                        -> folly::coro::Task<void> {
-                                        co_return co_await this
-                                            ->doGracefullyDisconnectAsync(
-                                                targetDescriptor,
-                                                disconnectMode);
-                                    }));
-                        }));
+                streamr::utils::blockingWait(this->disconnectAndWait(
+                    endpoint, std::move(targetDescriptor), disconnectMode));
             } catch (const std::exception& err) {
                 SLogger::error(
                     "Caught exception in gracefullyDisconnect " +
@@ -782,6 +855,64 @@ private:
         SLogger::debug("ConnectionManager::gracefullyDisconnect() end");
     }
 
+    // Sends the graceful-disconnect notice and waits (up to 2 s) for the
+    // endpoint to go down.
+    folly::coro::Task<void> disconnectAndWait(
+        std::shared_ptr<Endpoint> endpoint,
+        PeerDescriptor targetDescriptor,
+        DisconnectMode disconnectMode) {
+        co_await folly::coro::collectAll(
+            waitForEvent<endpointevents::Disconnected>(
+                endpoint.get(), 2000ms), // NOLINT
+            this->doGracefullyDisconnectAsync(
+                std::move(targetDescriptor), disconnectMode));
+    }
+
+    // The asynchronous gracefullyDisconnect() of garbage collection.
+    folly::coro::Task<void> evictConnection(
+        std::shared_ptr<Endpoint> endpoint) {
+        if (!endpoint->isConnected()) {
+            endpoint->close(true);
+            co_return;
+        }
+        try {
+            co_await this->disconnectAndWait(
+                endpoint,
+                endpoint->getPeerDescriptor(),
+                DisconnectMode::NORMAL);
+        } catch (const std::exception& err) {
+            SLogger::debug(
+                "Evicting connection failed, force-closing it: " +
+                std::string(err.what()));
+            endpoint->close(true);
+        }
+    }
+
+    void scheduleGarbageCollection() {
+        const auto token = this->garbageCollectionAbortController.getSignal()
+                               .getCancellationToken();
+        this->garbageCollectionScope.add(
+            streamr::utils::co_withExecutor(
+                &this->garbageCollectionExecutor,
+                folly::coro::co_invoke(
+                    [this, token]() -> folly::coro::Task<void> {
+                        while (!token.isCancellationRequested()) {
+                            try {
+                                co_await streamr::utils::co_withCancellation(
+                                    token,
+                                    folly::coro::sleep(
+                                        this->options
+                                            .garbageCollectionInterval));
+                            } catch (const folly::OperationCancelled&) {
+                                co_return;
+                            }
+                            this->garbageCollectConnections(
+                                this->options.maxConnections,
+                                this->options.garbageCollectionIdleLimit);
+                        }
+                    })));
+    }
+
     folly::coro::Task<void> doGracefullyDisconnectAsync(
         PeerDescriptor targetDescriptor, DisconnectMode disconnectMode) {
         const auto nodeId =
@@ -797,20 +928,25 @@ private:
     }
 
     void handleMessage(const Message& message) {
-        SLogger::trace("Received message " + message.DebugString());
+        SLogger::trace([&message]() {
+            return "Received message " + message.DebugString();
+        });
 
         if (!message.has_rpcmessage()) {
-            SLogger::trace(
-                "Filtered out non-RPC message: " + message.DebugString());
+            SLogger::trace([&message]() {
+                return "Filtered out non-RPC message: " +
+                    message.DebugString();
+            });
             return;
         }
         if (this->duplicateMessageDetector.isMostLikelyDuplicate(
                 message.messageid())) {
-            SLogger::trace(
-                "handleMessage filtered duplicate " +
-                Identifiers::getNodeIdFromPeerDescriptor(
-                    message.sourcedescriptor()) +
-                " " + message.serviceid() + " " + message.messageid());
+            SLogger::trace([&message]() {
+                return "handleMessage filtered duplicate " +
+                    Identifiers::getNodeIdFromPeerDescriptor(
+                           message.sourcedescriptor()) +
+                    " " + message.serviceid() + " " + message.messageid();
+            });
             return;
         }
 
@@ -819,11 +955,12 @@ private:
         if (message.serviceid() == INTERNAL_SERVICE_ID) {
             this->rpcCommunicator.handleMessageFromPeer(message);
         } else {
-            SLogger::trace(
-                "emit \"message\" " +
-                Identifiers::getNodeIdFromPeerDescriptor(
-                    message.sourcedescriptor()) +
-                " " + message.serviceid() + " " + message.messageid());
+            SLogger::trace([&message]() {
+                return "emit \"message\" " +
+                    Identifiers::getNodeIdFromPeerDescriptor(
+                           message.sourcedescriptor()) +
+                    " " + message.serviceid() + " " + message.messageid();
+            });
             this->emit<transport::transportevents::Message>(message);
         }
     }
@@ -834,9 +971,19 @@ private:
         if (this->state == ConnectionManagerState::STOPPED) {
             return;
         }
-        Message message;
+        // The frame is parsed into an arena that lives until the
+        // synchronous dispatch returns; the notification requests unpacked
+        // from its RPC body go there too (DispatchArenaScope). The first
+        // block is on the stack, so a small frame allocates nothing.
+        alignas(std::max_align_t) std::array<char, ARENA_INITIAL_BLOCK_SIZE>
+            initialBlock;
+        google::protobuf::ArenaOptions arenaOptions;
+        arenaOptions.initial_block = initialBlock.data();
+        arenaOptions.initial_block_size = initialBlock.size();
+        google::protobuf::Arena arena(arenaOptions);
+        auto* message = google::protobuf::Arena::Create<Message>(&arena);
         try {
-            message.ParseFromArray(data.data(), static_cast<int>(data.size()));
+            message->ParseFromArray(data.data(), static_cast<int>(data.size()));
         } catch (const std::exception& e) {
             SLogger::debug(
                 "Parsing incoming data into Message failed: " +
@@ -844,14 +991,21 @@ private:
             return;
         }
 
-        message.mutable_sourcedescriptor()->CopyFrom(peerDescriptor);
-
-        try {
-            this->handleMessage(message);
-        } catch (const std::exception& e) {
-            SLogger::debug(
-                "Handling incoming data failed: " + std::string(e.what()));
+        // The sender's descriptor is referenced, not copied: it outlives
+        // the dispatch and is detached again before the arena goes.
+        // Listeners only get a const Message.
+        message->unsafe_arena_set_allocated_sourcedescriptor(
+            const_cast<PeerDescriptor*>(&peerDescriptor)); // NOLINT
+        {
+            const streamr::protorpc::DispatchArenaScope arenaScope(arena);
+            try {
+                this->handleMessage(*message);
+            } catch (const std::exception& e) {
+                SLogger::debug(
+                    "Handling incoming data failed: " + std::string(e.what()));
+            }
         }
+        std::ignore = message->unsafe_arena_release_sourcedescriptor();
     }
 
     bool isConnectionToSelf(const PeerDescriptor& peerDescriptor) const {
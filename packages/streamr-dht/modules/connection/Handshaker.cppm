@@ -3,7 +3,10 @@
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
 module;
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
 #include <tuple>
 
@@ -16,6 +19,7 @@ import streamr.logger.SLogger;
 import streamr.utils.EnableSharedFromThis;
 import streamr.utils.Uuid;
 import streamr.dht.Connection;
+import streamr.dht.SendBuffer;
 import streamr.dht.Version;
 
 // Hoisted from the former header (file scope, NOT exported);
@@ -34,6 +38,7 @@ using ::dht::HandshakeResponse;
 using ::dht::Message;
 using ::dht::PeerDescriptor;
 using streamr::dht::connection::Connection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::connectionevents::Data;
 using streamr::dht::helpers::Version;
 namespace handshakerevents {
@@ -135,9 +140,11 @@ protected:
                 "sendHandshakeRequest(): handshake request is empty");
             return;
         }
-        std::vector<std::byte> byteVec(nBytes);
-        msg.SerializeToArray(byteVec.data(), static_cast<int>(nBytes));
-        this->connection->send(byteVec);
+        this->connection->send(
+            SendBuffer::create(nBytes, [&msg](std::span<std::byte> bytes) {
+                msg.SerializeWithCachedSizesToArray(
+                    reinterpret_cast<uint8_t*>(bytes.data()));
+            }));
         SLogger::debug(
             "sendHandshakeRequest() sending handshake request:" +
             msg.DebugString());
@@ -154,9 +161,11 @@ protected:
                 "sendHandshakeResponse(): handshake response is empty");
             return;
         }
-        std::vector<std::byte> byteVec(nBytes);
-        msg.SerializeToArray(byteVec.data(), static_cast<int>(nBytes));
-        this->connection->send(byteVec);
+        this->connection->send(
+            SendBuffer::create(nBytes, [&msg](std::span<std::byte> bytes) {
+                msg.SerializeWithCachedSizesToArray(
+                    reinterpret_cast<uint8_t*>(bytes.data()));
+            }));
         SLogger::trace(
             "sendHandshakeResponse(): handshake response sent: " +
             msg.DebugString());
@@ -0,0 +1,222 @@
+// Module streamr.dht.SendBuffer
+// Native-only (no TS counterpart): the outbound byte buffer that travels
+// from ConnectionManager::send through the Endpoint and its states to the
+// Connection.
+//
+// A SendBuffer is an immutable, reference-counted view of one serialized
+// message. Copying it only bumps the reference count, so the connecting
+// state's buffer, the WebRTC send queue and the simulator's operation
+// queue keep the message without copying its bytes. The storage comes
+// from SendBufferPool, which recycles released slabs per size class
+// instead of returning them to the allocator: the small RPC messages and
+// the larger stream messages of a broadcast fan-out each reuse slabs of
+// their own class, under that class's own lock.
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+export module streamr.dht.SendBuffer;
+
+export namespace streamr::dht::connection {
+
+struct SendBufferPoolStats {
+    // Slabs handed out from the free lists.
+    uint64_t reused = 0;
+    // Slabs allocated because their size class had none free, or because
+    // the message was larger than the largest size class.
+    uint64_t allocated = 0;
+};
+
+class SendBufferPool {
+public:
+    struct Slab {
+        std::atomic<uint32_t> references{1};
+        size_t size = 0;
+        size_t capacity = 0;
+        // sizeClasses.size() for a slab too large to be recycled.
+        size_t sizeClass = 0;
+        std::unique_ptr<std::byte[]> bytes;
+    };
+
+private:
+    struct SizeClass {
+        size_t capacity;
+        // Free slabs kept at most; the rest go back to the allocator.
+        size_t maxFree;
+    };
+
+    // Handshakes and RPC requests, routed RPCs, stream messages, and
+    // batches of them.
+    static constexpr std::array<SizeClass, 4> sizeClasses{{
+        {.capacity = 1024, .maxFree = 1024},
+        {.capacity = 8 * 1024, .maxFree = 256},
+        {.capacity = 64 * 1024, .maxFree = 64},
+        {.capacity = 512 * 1024, .maxFree = 8},
+    }};
+
+    struct FreeList {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Slab>> slabs;
+    };
+
+    std::array<FreeList, sizeClasses.size()> freeLists;
+    std::atomic<uint64_t> reused{0};
+    std::atomic<uint64_t> allocated{0};
+
+    static size_t getSizeClass(size_t size) {
+        const auto it = std::ranges::find_if(
+            sizeClasses, [size](const SizeClass& sizeClass) {
+                return size <= sizeClass.capacity;
+            });
+        return static_cast<size_t>(it - sizeClasses.begin());
+    }
+
+public:
+    // Never destroyed: a SendBuffer held by a connection may still be
+    // released during static destruction.
+    static SendBufferPool& instance() {
+        // magic static
+        static auto* pool = new SendBufferPool();
+        return *pool;
+    }
+
+    [[nodiscard]] Slab* acquire(size_t size) {
+        const auto sizeClass = getSizeClass(size);
+        std::unique_ptr<Slab> slab;
+        if (sizeClass < sizeClasses.size()) {
+            auto& freeList = this->freeLists[sizeClass];
+            std::scoped_lock lock(freeList.mutex);
+            if (!freeList.slabs.empty()) {
+                slab = std::move(freeList.slabs.back());
+                freeList.slabs.pop_back();
+            }
+        }
+        if (slab) {
+            this->reused.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            this->allocated.fetch_add(1, std::memory_order_relaxed);
+            slab = std::make_unique<Slab>();
+            slab->sizeClass = sizeClass;
+            slab->capacity = sizeClass < sizeClasses.size()
+                ? sizeClasses[sizeClass].capacity
+                : size;
+            slab->bytes =
+                std::make_unique_for_overwrite<std::byte[]>(slab->capacity);
+        }
+        slab->references.store(1, std::memory_order_relaxed);
+        slab->size = size;
+        return slab.release();
+    }
+
+    void release(Slab* released) {
+        std::unique_ptr<Slab> slab(released);
+        if (slab->sizeClass >= sizeClasses.size()) {
+            return;
+        }
+        auto& freeList = this->freeLists[slab->sizeClass];
+        std::scoped_lock lock(freeList.mutex);
+        if (freeList.slabs.size() < sizeClasses[slab->sizeClass].maxFree) {
+            freeList.slabs.push_back(std::move(slab));
+        }
+    }
+
+    [[nodiscard]] SendBufferPoolStats getStats() const {
+        return {
+            .reused = this->reused.load(std::memory_order_relaxed),
+            .allocated = this->allocated.load(std::memory_order_relaxed)};
+    }
+};
+
+class SendBuffer {
+private:
+    using Slab = SendBufferPool::Slab;
+
+    Slab* slab = nullptr;
+
+    explicit SendBuffer(Slab* slab) : slab(slab) {}
+
+    void reset() {
+        if (this->slab &&
+            this->slab->references.fetch_sub(1, std::memory_order_acq_rel) ==
+                1) {
+            SendBufferPool::instance().release(this->slab);
+        }
+        this->slab = nullptr;
+    }
+
+public:
+    SendBuffer() = default;
+
+    // Copies bytes that were not serialized into a SendBuffer directly
+    // (handshakes, connectivity checks, tests).
+    explicit SendBuffer(const std::vector<std::byte>& bytes)
+        : SendBuffer(create(bytes.size(), [&bytes](std::span<std::byte> to) {
+              std::ranges::copy(bytes, to.begin());
+          })) {}
+
+    // A buffer of size bytes, written by fill before it is shared.
+    template <typename Fill>
+    static SendBuffer create(size_t size, Fill&& fill) {
+        SendBuffer buffer(SendBufferPool::instance().acquire(size));
+        std::forward<Fill>(fill)(
+            std::span<std::byte>(buffer.slab->bytes.get(), size));
+        return buffer;
+    }
+
+    SendBuffer(const SendBuffer& other) : slab(other.slab) {
+        if (this->slab) {
+            this->slab->references.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    SendBuffer(SendBuffer&& other) noexcept
+        : slab(std::exchange(other.slab, nullptr)) {}
+
+    SendBuffer& operator=(const SendBuffer& other) {
+        if (this != &other) {
+            SendBuffer copy(other);
+            std::swap(this->slab, copy.slab);
+        }
+        return *this;
+    }
+
+    SendBuffer& operator=(SendBuffer&& other) noexcept {
+        if (this != &other) {
+            this->reset();
+            this->slab = std::exchange(other.slab, nullptr);
+        }
+        return *this;
+    }
+
+    ~SendBuffer() { this->reset(); }
+
+    [[nodiscard]] const std::byte* data() const {
+        return this->slab ? this->slab->bytes.get() : nullptr;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return this->slab ? this->slab->size : 0;
+    }
+
+    [[nodiscard]] bool empty() const { return this->size() == 0; }
+
+    [[nodiscard]] std::span<const std::byte> bytes() const {
+        return {this->data(), this->size()};
+    }
+
+    // A copy of the bytes, for the receiving side of the simulator.
+    [[nodiscard]] std::vector<std::byte> toVector() const {
+        return {this->data(), this->data() + this->size()};
+    }
+};
+
+} // namespace streamr::dht::connection
@@ -17,7 +17,9 @@ module;
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -34,6 +36,7 @@ import streamr.dht.protos;
 import streamr.dht.Connection;
 import streamr.dht.Connectivity;
 import streamr.dht.Errors;
+import streamr.dht.SendBuffer;
 import streamr.dht.Version;
 import streamr.dht.WebsocketClientConnection;
 import streamr.logger.SLogger;
@@ -135,11 +138,13 @@ inline ConnectivityResponse sendConnectivityRequest(
     msg.set_messageid(
         boost::uuids::to_string(boost::uuids::random_generator()()));
     *msg.mutable_connectivityrequest() = request;
-    const auto serialized = msg.SerializeAsString();
-    std::vector<std::byte> data(serialized.size());
-    std::memcpy(data.data(), serialized.data(), serialized.size());
     auto future = promise->getFuture();
-    outgoingConnection->send(data);
+    const size_t nBytes = msg.ByteSizeLong();
+    outgoingConnection->send(
+        SendBuffer::create(nBytes, [&msg](std::span<std::byte> bytes) {
+            msg.SerializeWithCachedSizesToArray(
+                reinterpret_cast<uint8_t*>(bytes.data()));
+        }));
     SLogger::trace("ConnectivityRequest sent");
     ConnectivityResponse response;
     try {
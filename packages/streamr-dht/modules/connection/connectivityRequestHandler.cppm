@@ -17,7 +17,9 @@
 // WebsocketServerConnection.
 module;
 
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -35,6 +37,7 @@ import streamr.dht.Connection;
 import streamr.dht.Connectivity;
 import streamr.dht.connectivityChecker;
 import streamr.dht.NatType;
+import streamr.dht.SendBuffer;
 import streamr.dht.Version;
 import streamr.logger.SLogger;
 import streamr.utils.Ipv4Helper;
@@ -123,10 +126,12 @@ inline void handleIncomingConnectivityRequest(
     msg.set_messageid(
         boost::uuids::to_string(boost::uuids::random_generator()()));
     *msg.mutable_connectivityresponse() = connectivityResponse;
-    const auto serialized = msg.SerializeAsString();
-    std::vector<std::byte> data(serialized.size());
-    std::memcpy(data.data(), serialized.data(), serialized.size());
-    connection.send(data);
+    const size_t nBytes = msg.ByteSizeLong();
+    connection.send(
+        SendBuffer::create(nBytes, [&msg](std::span<std::byte> bytes) {
+            msg.SerializeWithCachedSizesToArray(
+                reinterpret_cast<uint8_t*>(bytes.data()));
+        }));
     SLogger::trace("ConnectivityResponse sent");
 }
 
@@ -20,6 +20,7 @@ import streamr.dht.Connection;
 import streamr.dht.EndpointState;
 import streamr.dht.EndpointStateInterface;
 import streamr.dht.Errors;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -29,6 +30,7 @@ using streamr::logger::SLogger;
 export namespace streamr::dht::connection::endpoint {
 
 using streamr::dht::connection::Connection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::helpers::SendFailed;
 
 // The state's resources (connection, tokens) are guarded by the
@@ -159,7 +161,7 @@ public:
         return [connection, graceful]() { connection->close(graceful); };
     }
 
-    void send(const std::vector<std::byte>& data) override {
+    void send(const SendBuffer& data) override {
         SLogger::debug("ConnectedEndpointState::send");
         if (!this->connection) {
             throw SendFailed("send() called on endpoint with no connection");
@@ -16,6 +16,7 @@ import streamr.dht.IPendingConnection;
 import streamr.eventemitter.EventEmitter;
 import streamr.dht.EndpointState;
 import streamr.dht.EndpointStateInterface;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -29,6 +30,7 @@ export namespace streamr::dht::connection::endpoint {
 
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::IPendingConnection;
+using streamr::dht::connection::SendBuffer;
 
 // The state's resources (pending connection, tokens, send buffer) are
 // guarded by the Endpoint's state-machine mutex (phase A0: the former
@@ -50,7 +52,7 @@ private:
     // implementation) merged them into one corrupt message on flush and
     // silently destroyed all but the last RPC (phase-AA bug; TS buffers an
     // array of messages the same way this does).
-    std::vector<std::vector<std::byte>> buffer;
+    std::vector<SendBuffer> buffer;
     std::shared_ptr<IPendingConnection> pendingConnection;
     HandlerToken connectedHandlerToken;
     HandlerToken disconnectedHandlerToken;
@@ -250,7 +252,7 @@ public:
         };
     }
 
-    void send(const std::vector<std::byte>& data) override {
+    void send(const SendBuffer& data) override {
         SLogger::debug("ConnectingEndpointState::send");
         this->buffer.push_back(data);
     }
@@ -16,6 +16,7 @@ import streamr.dht.EndpointState;
 import streamr.dht.EndpointStateInterface;
 import streamr.dht.Errors;
 import streamr.dht.IPendingConnection;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -25,6 +26,7 @@ export namespace streamr::dht::connection::endpoint {
 
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::IPendingConnection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::helpers::SendFailed;
 
 // Terminal state: a disconnected endpoint ignores further transitions
@@ -60,7 +62,7 @@ public:
         return {};
     }
 
-    void send(const std::vector<std::byte>& /* data */) override {
+    void send(const SendBuffer& /* data */) override {
         SLogger::debug("DisconnectedEndpointState::send");
         throw SendFailed("send() called on disconnected endpoint");
     }
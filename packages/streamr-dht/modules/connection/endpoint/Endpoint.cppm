@@ -4,6 +4,8 @@
 // this file is now the source of truth.
 module;
 
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -25,6 +27,7 @@ import streamr.dht.DisconnectedEndpointState;
 import streamr.dht.EndpointState;
 import streamr.dht.EndpointStateInterface;
 import streamr.dht.InitialEndpointState;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -36,6 +39,7 @@ using streamr::utils::EnableSharedFromThis;
 export namespace streamr::dht::connection::endpoint {
 
 using ::dht::PeerDescriptor;
+using streamr::dht::connection::SendBuffer;
 
 namespace endpointevents {
 
@@ -73,6 +77,17 @@ private:
     // Highest pending-connection sequence number adopted so far; guarded
     // by mutex. See setConnecting().
     uint64_t lastConnectingSequence = 0;
+    // When data last went through the endpoint in either direction, as a
+    // steady_clock tick count (TS Connection.getLastUsedTimestamp). Read
+    // by the connection garbage collector without the mutex.
+    std::atomic<std::chrono::steady_clock::rep> lastUsed{
+        std::chrono::steady_clock::now().time_since_epoch().count()};
+
+    void markUsed() {
+        this->lastUsed.store(
+            std::chrono::steady_clock::now().time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
 
     // --- EndpointStateInterface (called by the state classes) ---
 
@@ -105,6 +120,7 @@ private:
 
     void emitData(const std::vector<std::byte>& data) override {
         SLogger::debug("Endpoint::emitData");
+        this->markUsed();
         this->emit<endpointevents::Data>(data);
     }
 
@@ -244,6 +260,12 @@ public:
         return this->peerDescriptor;
     }
 
+    [[nodiscard]] std::chrono::steady_clock::time_point getLastUsed() const {
+        return std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(
+                this->lastUsed.load(std::memory_order_relaxed)));
+    }
+
     void close(bool graceful) {
         SLogger::debug("Endpoint::close start");
         auto self = this->sharedFromThis<Endpoint>();
@@ -263,9 +285,10 @@ public:
         SLogger::debug("Endpoint::close end");
     }
 
-    void send(const std::vector<std::byte>& data) {
+    void send(const SendBuffer& data) {
         SLogger::debug("Endpoint::send start");
         auto self = this->sharedFromThis<Endpoint>();
+        this->markUsed();
         std::scoped_lock lock(this->mutex);
         // ConnectedEndpointState forwards to connection->send() under
         // the mutex: a deliberate exception to the no-call-outs rule —
@@ -15,6 +15,7 @@ import streamr.logger.SLogger;
 import streamr.utils.EnableSharedFromThis;
 import streamr.dht.Connection;
 import streamr.dht.IPendingConnection;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -25,6 +26,7 @@ export namespace streamr::dht::connection::endpoint {
 
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::IPendingConnection;
+using streamr::dht::connection::SendBuffer;
 
 // LOCKING CONTRACT (phase A0, see EndpointStateInterface): every method
 // here is called by Endpoint with the state-machine mutex held. Methods
@@ -45,7 +47,7 @@ public:
         SLogger::debug("EndpointState::close");
         return {};
     };
-    virtual void send(const std::vector<std::byte>& /* data */) {
+    virtual void send(const SendBuffer& /* data */) {
         SLogger::debug("EndpointState::send");
     };
 
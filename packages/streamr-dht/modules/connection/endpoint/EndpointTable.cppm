@@ -0,0 +1,114 @@
+// Module streamr.dht.EndpointTable
+// Native-only (no TS counterpart): ConnectionManager's endpoints, in
+// shards by binary NodeId. A peer whose id is longer than a kademlia id
+// has no NodeId and so never gets an endpoint.
+//
+// Each shard has its own std::shared_mutex, so the lookups of the send
+// path take a shared lock on one shard only, and mutations for
+// different peers do not wait for each other. All mutations for one peer
+// go through the same shard's exclusive lock, which keeps accept, close
+// and the simultaneous-connect tie-break ordered per peer as the single
+// container lock did. Like that lock, a shard lock is never held across
+// a call-out: the callers resolve the endpoint and call it after the
+// lock is released (phase-A0 locking policy).
+module;
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+export module streamr.dht.EndpointTable;
+
+import streamr.dht.Endpoint;
+import streamr.dht.Identifiers;
+
+export namespace streamr::dht::connection::endpoint {
+
+using streamr::dht::NodeId;
+using streamr::dht::NodeIdHash;
+
+class EndpointTable {
+public:
+    using Shard =
+        std::unordered_map<NodeId, std::shared_ptr<Endpoint>, NodeIdHash>;
+
+private:
+    static constexpr size_t shardCount = 16;
+
+    struct LockedShard {
+        std::shared_mutex mutex;
+        Shard endpoints;
+    };
+
+    std::array<LockedShard, shardCount> shards;
+
+    LockedShard& getShard(const NodeId& nodeId) {
+        return this->shards[NodeIdHash{}(nodeId) % shardCount];
+    }
+
+public:
+    [[nodiscard]] std::shared_ptr<Endpoint> find(const NodeId& nodeId) {
+        auto& shard = this->getShard(nodeId);
+        std::shared_lock lock(shard.mutex);
+        const auto it = shard.endpoints.find(nodeId);
+        return it == shard.endpoints.end() ? nullptr : it->second;
+    }
+
+    [[nodiscard]] bool contains(const NodeId& nodeId) {
+        auto& shard = this->getShard(nodeId);
+        std::shared_lock lock(shard.mutex);
+        return shard.endpoints.contains(nodeId);
+    }
+
+    void erase(const NodeId& nodeId) {
+        // Released after the lock: the last reference may destroy the
+        // endpoint, which must not run under a shard lock.
+        std::shared_ptr<Endpoint> erased;
+        auto& shard = this->getShard(nodeId);
+        std::scoped_lock lock(shard.mutex);
+        if (const auto it = shard.endpoints.find(nodeId);
+            it != shard.endpoints.end()) {
+            erased = std::move(it->second);
+            shard.endpoints.erase(it);
+        }
+    }
+
+    // Runs mutate on the shard of nodeId under its exclusive lock, for a
+    // check-and-insert that must be atomic. mutate must not call out.
+    template <typename F>
+    decltype(auto) update(const NodeId& nodeId, F&& mutate) {
+        auto& shard = this->getShard(nodeId);
+        std::scoped_lock lock(shard.mutex);
+        return std::forward<F>(mutate)(shard.endpoints);
+    }
+
+    [[nodiscard]] size_t size() {
+        size_t result = 0;
+        for (auto& shard : this->shards) {
+            std::shared_lock lock(shard.mutex);
+            result += shard.endpoints.size();
+        }
+        return result;
+    }
+
+    // The endpoints of all shards; each shard is read under its own lock,
+    // so the result is not one atomic snapshot of the whole table.
+    [[nodiscard]] std::vector<std::shared_ptr<Endpoint>> getEndpoints() {
+        std::vector<std::shared_ptr<Endpoint>> result;
+        result.reserve(this->size());
+        for (auto& shard : this->shards) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [nodeId, endpoint] : shard.endpoints) {
+                result.push_back(endpoint);
+            }
+        }
+        return result;
+    }
+};
+
+} // namespace streamr::dht::connection::endpoint
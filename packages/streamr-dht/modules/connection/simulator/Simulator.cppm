@@ -50,6 +50,7 @@ import streamr.dht.protos;
 
 import streamr.dht.Identifiers;
 import streamr.dht.RegionPings;
+import streamr.dht.SendBuffer;
 import streamr.dht.SimulatorInterfaces;
 import streamr.logger.SLogger;
 import streamr.utils.SharedExecutors;
@@ -63,6 +64,7 @@ export namespace streamr::dht::connection::simulator {
 
 using ::dht::PeerDescriptor;
 using streamr::dht::Identifiers;
+using streamr::dht::connection::SendBuffer;
 
 enum class LatencyType : std::uint8_t { NONE, RANDOM, REAL, FIXED };
 
@@ -103,7 +105,7 @@ private:
         uint64_t sequenceNumber;
         OperationType type;
         std::shared_ptr<Association> association;
-        std::vector<std::byte> data; // SEND only
+        SendBuffer data; // SEND only
         PeerDescriptor targetDescriptor; // CONNECT only
     };
 
@@ -273,7 +275,9 @@ private:
                 " destination, dropping the message");
             return;
         }
-        destination->handleIncomingData(operation.data);
+        // The copy stands in for the wire: the receiver gets bytes of its
+        // own, as from a real socket.
+        destination->handleIncomingData(operation.data.toVector());
     }
 
     void dispatchLoop() {
@@ -452,7 +456,7 @@ public:
 
     void send(
         const ISimulatorConnection& sourceConnection,
-        const std::vector<std::byte>& data) {
+        const SendBuffer& data) {
         std::scoped_lock lock(this->mMutex);
         if (this->stopped) {
             return;
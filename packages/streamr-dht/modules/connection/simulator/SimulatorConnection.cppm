@@ -21,6 +21,7 @@ import streamr.dht.protos;
 
 import streamr.dht.Connection;
 import streamr.dht.Identifiers;
+import streamr.dht.SendBuffer;
 import streamr.dht.Simulator;
 import streamr.dht.SimulatorInterfaces;
 import streamr.logger.SLogger;
@@ -38,6 +39,7 @@ using ::dht::PeerDescriptor;
 using streamr::dht::Identifiers;
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::ConnectionType;
+using streamr::dht::connection::SendBuffer;
 
 class SimulatorConnection : public Connection,
                             public ISimulatorConnection,
@@ -87,7 +89,7 @@ public:
             simulator);
     }
 
-    void send(const std::vector<std::byte>& data) override {
+    void send(const SendBuffer& data) override {
         SLogger::trace("send()");
         {
             std::scoped_lock lock(this->mMutex);
@@ -23,18 +23,15 @@ using ::dht::PeerDescriptor;
 using streamr::dht::connection::ConnectionManager;
 using streamr::dht::connection::ConnectionManagerOptions;
 using streamr::dht::connection::ConnectorFacade;
+using streamr::dht::connection::DEFAULT_MAX_CONNECTIONS;
 
 class SimulatorTransport : public ConnectionManager {
 public:
-    // Same maxConnections default as the TS ConnectionManager applies
-    // when SimulatorTransport passes none.
-    static constexpr size_t defaultMaxConnections = 80;
-
     SimulatorTransport(
         const PeerDescriptor& localPeerDescriptor, Simulator& simulator)
         : ConnectionManager(
               ConnectionManagerOptions{
-                  .maxConnections = defaultMaxConnections,
+                  .maxConnections = DEFAULT_MAX_CONNECTIONS,
                   .createConnectorFacade = [localPeerDescriptor, &simulator]()
                       -> std::shared_ptr<ConnectorFacade> {
                       return std::make_shared<SimulatorConnectorFacade>(
@@ -36,6 +36,7 @@ import streamr.dht.protos;
 
 import streamr.dht.Connection;
 import streamr.dht.Identifiers;
+import streamr.dht.SendBuffer;
 import streamr.dht.webrtcTypes;
 import streamr.eventemitter.EventEmitter;
 import streamr.logger.SLogger;
@@ -58,6 +59,7 @@ using streamr::dht::connection::ConnectionType;
 using streamr::dht::connection::connectionevents::Connected;
 using streamr::dht::connection::connectionevents::Data;
 using streamr::dht::connection::connectionevents::Disconnected;
+using streamr::dht::connection::SendBuffer;
 
 inline constexpr size_t defaultBufferThresholdHigh = 1U << 17U;
 inline constexpr size_t defaultBufferThresholdLow = 1U << 15U;
@@ -78,7 +80,8 @@ private:
     std::vector<std::pair<std::string, std::string>> pendingCandidates;
     bool closed = false;
     std::optional<bool> offering;
-    std::deque<std::vector<std::byte>> messageQueue;
+    // Shares the senders' buffers: queueing copies no bytes.
+    std::deque<SendBuffer> messageQueue;
     AbortController earlyTimeoutAbort;
     streamr::eventemitter::EventEmitter<WebrtcSignallingEvents>
         signallingEvents;
@@ -252,7 +255,7 @@ public:
         }
     }
 
-    void send(const std::vector<std::byte>& data) override {
+    void send(const SendBuffer& data) override {
         std::scoped_lock lock(this->mMutex);
         if (this->isOpen()) {
             try {
@@ -14,6 +14,7 @@ export module streamr.dht.WebsocketConnection;
 import streamr.logger.SLogger;
 import streamr.utils.EnableSharedFromThis;
 import streamr.dht.Connection;
+import streamr.dht.SendBuffer;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified: relative namespace names resolve differently
@@ -26,6 +27,7 @@ using streamr::dht::connection::connectionevents::Connected;
 using streamr::dht::connection::connectionevents::Data;
 using streamr::dht::connection::connectionevents::Disconnected;
 using streamr::dht::connection::connectionevents::Error;
+using streamr::dht::connection::SendBuffer;
 
 inline constexpr size_t maxMessageSize = 1048576;
 
@@ -37,6 +39,24 @@ private:
     std::function<void()> onOpen;
     std::function<void()> onClosed;
 
+    // The metadata of the send() logs.
+    struct SendLogMetadata {
+        std::string connectionType;
+        bool mDestroyed;
+        size_t size;
+    };
+
+    // Builds the metadata only when a send() log is actually written:
+    // send() is on the hot path and trace is normally disabled.
+    [[nodiscard]] auto sendLogMetadata(const SendBuffer& data) const {
+        return [this, &data]() {
+            return SendLogMetadata{
+                .connectionType = getConnectionTypeString(),
+                .mDestroyed = mDestroyed.load(),
+                .size = data.size()};
+        };
+    }
+
 protected:
     std::shared_ptr<rtc::WebSocket> mSocket; // NOLINT
     std::atomic<bool> mDestroyed{false}; // NOLINT
@@ -207,27 +227,18 @@ public:
         }
     }
 
-    void send(const std::vector<std::byte>& data) override {
-        SLogger::trace(
-            "send() start",
-            {{"connectionType", getConnectionTypeString()},
-             {"mDestroyed", mDestroyed.load()},
-             {"size", data.size()}});
+    void send(const SendBuffer& data) override {
+        SLogger::trace("send() start", sendLogMetadata(data));
         auto self = this->sharedFromThis<WebsocketConnection>();
         if (!mDestroyed && mSocket &&
             mSocket->readyState() == rtc::WebSocket::State::Open) {
-            auto dataCopy = data;
-            SLogger::trace(
-                "send() sending data",
-                {{"connectionType", getConnectionTypeString()},
-                 {"mDestroyed", mDestroyed.load()},
-                 {"size", data.size()}});
-            mSocket->send(std::move(dataCopy));
+            SLogger::trace("send() sending data", sendLogMetadata(data));
+            // libdatachannel copies the bytes into its own message once;
+            // the pooled buffer is released when the caller drops it.
+            mSocket->send(data.data(), data.size());
         } else {
             SLogger::debug(
-                "send() on non-open connection",
-                {{"connectionType", getConnectionTypeString()},
-                 {"mDestroyed", mDestroyed.load()}});
+                "send() on non-open connection", sendLogMetadata(data));
             return;
         }
         SLogger::trace("send() end");
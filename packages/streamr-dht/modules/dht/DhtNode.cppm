@@ -97,6 +97,7 @@ using ::dht::RecursiveOperation;
 using ::dht::RouteMessageWrapper;
 using streamr::dht::connection::ConnectionLocker;
 using streamr::dht::connection::ConnectionsView;
+using streamr::dht::connection::DEFAULT_MAX_CONNECTIONS;
 using streamr::dht::connection::LockID;
 using streamr::dht::contact::RingIdRaw;
 using streamr::dht::discovery::PeerDiscovery;
@@ -108,7 +109,9 @@ using streamr::dht::routing::Router;
 using streamr::dht::routing::RouterOptions;
 using streamr::dht::routing::RoutingMode;
 using streamr::dht::rpcprotocol::DhtCallContext;
+using streamr::dht::store::DEFAULT_LOCAL_DATA_STORE_MAX_BYTES;
 using streamr::dht::store::LocalDataStore;
+using streamr::dht::store::LocalDataStoreOptions;
 using streamr::dht::store::StoreManager;
 using streamr::dht::store::StoreManagerOptions;
 using streamr::dht::store::StoreRpcRemote;
@@ -129,12 +132,24 @@ struct DhtNodeOptions {
     ServiceID serviceId = CONTROL_LAYER_NODE_SERVICE_ID;
     size_t joinParallelism = 3;
     size_t maxContactCount = 200;
+    // Connections the owned ConnectionManager keeps before it starts
+    // collecting idle, unlocked ones.
+    size_t maxConnections = DEFAULT_MAX_CONNECTIONS;
     size_t numberOfNodesPerKBucket = numberOfNodesPerKBucketDefault;
     size_t joinNoProgressLimit = 5;
+    // Extra getClosestPeers requests a join session may send next to ones
+    // slower than the recent p95 round trip (0 disables hedging).
+    size_t joinMaxHedgedRequests = 1;
+    // A join session ends once this many closest neighbours are stable for
+    // a round of responses (0 waits for joinNoProgressLimit).
+    size_t joinStableClosestCount = 0;
     std::chrono::milliseconds dhtJoinTimeout{60000};
     size_t peerDiscoveryQueryBatchSize = 5;
     uint32_t storeHighestTtl = 60000;
     uint32_t storeMaxTtl = 60000;
+    // Memory budget of the local data store; the oldest entries are evicted
+    // past it.
+    size_t storeMaxBytes = DEFAULT_LOCAL_DATA_STORE_MAX_BYTES;
     std::chrono::milliseconds networkConnectivityTimeout{10000};
     size_t storageRedundancyFactor = 5;
     std::optional<size_t> neighborPingLimit;
@@ -203,6 +218,7 @@ private:
     static constexpr std::chrono::milliseconds externalApiTimeout{10000};
     static constexpr std::chrono::milliseconds networkConnectivityPollInterval{
         100};
+    static constexpr std::chrono::milliseconds storeExpiryInterval{1000};
 
     DhtNodeOptions options;
     LocalDataStore localDataStore;
@@ -232,9 +248,10 @@ private:
     bool started = false;
     AbortController abortController;
     // Detaches the k-bucket-empty rejoin off the delivery thread that raised
-    // the event. Serial view of the shared worker pool (formerly a private
-    // single-thread pool — see streamr.utils.SharedExecutors); the scope is
-    // drained in stop() so no rejoin outlives this node.
+    // the event, and runs the local data store's periodic expiry. Serial
+    // view of the shared worker pool (formerly a private single-thread
+    // pool — see streamr.utils.SharedExecutors); the scope is drained in
+    // stop() so no rejoin or expiry outlives this node.
     streamr::utils::SharedSerialExecutor recoveryExecutor{
         streamr::utils::SharedExecutors::worker()};
     streamr::utils::GuardedAsyncScope recoveryScope;
@@ -252,6 +269,28 @@ private:
             this->options.rpcRequestTimeout);
     }
 
+    // Drops expired store entries even while nothing reads the store.
+    void scheduleStoreExpiry() {
+        const auto token =
+            this->abortController.getSignal().getCancellationToken();
+        this->recoveryScope.add(
+            streamr::utils::co_withExecutor(
+                &this->recoveryExecutor,
+                folly::coro::co_invoke(
+                    [this, token]() -> folly::coro::Task<void> {
+                        while (!token.isCancellationRequested()) {
+                            try {
+                                co_await streamr::utils::co_withCancellation(
+                                    token,
+                                    folly::coro::sleep(storeExpiryInterval));
+                            } catch (const folly::OperationCancelled&) {
+                                co_return;
+                            }
+                            this->localDataStore.expire();
+                        }
+                    })));
+    }
+
     // PeerManager::getNeighbors returns the k-bucket remotes; the callers here
     // (and the public getNeighbors) want their descriptors (TS maps them).
     [[nodiscard]] std::vector<PeerDescriptor> getNeighborDescriptors() {
@@ -398,6 +437,7 @@ private:
                     }
                 }
                 this->router->onNodeDisconnected(peerDescriptor);
+                this->storeManager->onContactDisconnected(peerDescriptor);
                 this->emit<Disconnected>(peerDescriptor, gracefulLeave);
             });
     }
@@ -491,7 +531,9 @@ private:
 public:
     explicit DhtNode(DhtNodeOptions options)
         : options(std::move(options)),
-          localDataStore(this->options.storeMaxTtl) {}
+          localDataStore(LocalDataStoreOptions{
+              .maxTtl = this->options.storeMaxTtl,
+              .maxBytes = this->options.storeMaxBytes}) {}
 
     ~DhtNode() override = default;
     DhtNode(const DhtNode&) = delete;
@@ -550,6 +592,7 @@ public:
             }
             this->ownedConnectionManager =
                 std::make_shared<ConnectionManager>(ConnectionManagerOptions{
+                    .maxConnections = this->options.maxConnections,
                     .createConnectorFacade = [facadeOptions =
                                                   std::move(facadeOptions)]()
                         -> std::shared_ptr<DefaultConnectorFacade> {
@@ -602,7 +645,9 @@ public:
                 .createDhtNodeRpcRemote =
                     [this](const PeerDescriptor& peerDescriptor) {
                         return this->createDhtNodeRpcRemote(peerDescriptor);
-                    }});
+                    },
+                .maxHedgedRequests = this->options.joinMaxHedgedRequests,
+                .stableClosestCount = this->options.joinStableClosestCount});
         this->router = Router::newInstance(
             RouterOptions{
                 .rpcCommunicator = *this->rpcCommunicator,
@@ -638,7 +683,9 @@ public:
                             const RouteMessageWrapper& message,
                             RoutingMode mode,
                             const std::optional<DhtAddress>& excludedPeer) {
-                            return routerPtr->doRouteMessage(
+                            // Routing state belongs to the router's worker;
+                            // the caller awaits the hop there.
+                            return routerPtr->doRouteMessageAsync(
                                 message, mode, excludedPeer);
                         },
                     .isMostLikelyDuplicate =
@@ -674,6 +721,7 @@ public:
                             key, operation);
                     }});
         this->bindRpcLocalMethods();
+        this->scheduleStoreExpiry();
         // Set only after everything above succeeded: if start() throws
         // (e.g. the websocket server port is taken), transportPtr is still
         // null — a `started` node in that state would make stop() call
@@ -1,5 +1,7 @@
 // Module streamr.dht.ContactList
 // Ported from packages/dht/src/dht/contact/ContactList.ts (v103.8.0-rc.3).
+// Adaptations: the contacts are keyed by their binary NodeId rather than
+// the hex DhtAddress, which is converted at the API boundary.
 module;
 
 #include <concepts>
@@ -7,7 +9,6 @@ module;
 #include <map>
 #include <memory>
 #include <tuple>
-#include <utility>
 #include <vector>
 
 export module streamr.dht.ContactList;
@@ -22,6 +23,7 @@ using streamr::eventemitter::EventEmitter;
 export namespace streamr::dht::contact {
 
 using streamr::dht::DhtAddress;
+using streamr::dht::NodeId;
 
 // The element type the sorted/random contact lists hold: anything that can
 // report its node id. Replaces TS's `C extends { getNodeId: () => DhtAddress
@@ -53,20 +55,24 @@ using ContactListEvents = std::tuple<
 template <HasGetNodeId C>
 class ContactList : public EventEmitter<ContactListEvents<C>> {
 protected:
-    std::map<DhtAddress, std::shared_ptr<C>> contactsById;
+    std::map<NodeId, std::shared_ptr<C>> contactsById;
     // TODO (from TS) move this to SortedContactList
-    std::vector<DhtAddress> contactIds;
-    DhtAddress localNodeId;
+    std::vector<NodeId> contactIds;
+    NodeId localNodeId;
     size_t maxSize;
 
 public:
-    ContactList(DhtAddress localNodeId, size_t maxSize)
-        : localNodeId(std::move(localNodeId)), maxSize(maxSize) {}
+    ContactList(const DhtAddress& localNodeId, size_t maxSize)
+        : localNodeId(NodeId::fromDhtAddress(localNodeId)), maxSize(maxSize) {}
 
     ~ContactList() override = default;
 
     [[nodiscard]] std::shared_ptr<C> getContact(const DhtAddress& id) const {
-        const auto it = this->contactsById.find(id);
+        const auto nodeId = NodeId::tryFromDhtAddress(id);
+        if (!nodeId.has_value()) {
+            return nullptr;
+        }
+        const auto it = this->contactsById.find(nodeId.value());
         if (it == this->contactsById.end()) {
             return nullptr;
         }
@@ -1,20 +1,32 @@
 // Module streamr.dht.KBucket
 // Ported from the npm `k-bucket` library (v5.1.0, MIT, Tristan Slominski),
-// which the TS DHT uses via `import KBucket from 'k-bucket'`. A Kademlia
-// k-bucket stored as a binary tree of nodes.
+// which the TS DHT uses via `import KBucket from 'k-bucket'`.
 //
 // Sized to what the DHT actually uses (PeerManager / DhtNode): the default
 // XOR distance and the default vectorClock arbiter are built in rather
 // than exposed as constructor options, and the `metadata` option and the
 // `toIterable` generator are omitted. The events are wired to
 // streamr-eventemitter instead of Node's EventEmitter.
+//
+// Adaptations: the library's binary tree of buckets is replaced by a flat
+// array of buckets indexed by the length of the prefix an id shares with
+// the local node id. The tree only ever splits the bucket that holds the
+// local id, so its leaves are exactly these buckets and the add / ping
+// behaviour is unchanged; lookups index the bucket instead of walking the
+// tree, and closest() visits buckets in distance order. Contacts are kept
+// as compact records keyed by their binary NodeId. Ids may be at most
+// kademliaIdLengthInBytes long.
 module;
 
 #include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -32,7 +44,10 @@ using streamr::eventemitter::EventEmitter;
 export namespace streamr::dht::contact {
 
 using streamr::dht::DhtAddressRaw;
+using streamr::dht::kademliaIdLengthInBytes;
+using streamr::dht::NodeId;
 using streamr::dht::helpers::getPeerDistance;
+using streamr::dht::helpers::PeerDistance;
 
 // The element type a KBucket holds: it reports its id (for the XOR metric
 // and identity) and a vector clock (for the default arbiter — the larger
@@ -81,27 +96,29 @@ struct KBucketOptions {
 template <KBucketContact C>
 class KBucket : public EventEmitter<KBucketEvents<C>> {
 private:
-    // A tree node: a leaf holds `contacts`; an inner node has `contacts`
-    // empty-of-value (nullopt) and two children.
-    struct Node {
-        std::optional<std::vector<std::shared_ptr<C>>> contacts =
-            std::vector<std::shared_ptr<C>>{};
-        bool dontSplit = false;
-        std::unique_ptr<Node> left;
-        std::unique_ptr<Node> right;
-
-        [[nodiscard]] bool isInner() const {
-            return !this->contacts.has_value();
-        }
+    struct Entry {
+        NodeId id;
+        std::shared_ptr<C> contact;
     };
 
+    // Bucket i holds the contacts whose ids share exactly i leading bits
+    // with the local node id; the last one holds the local id itself.
+    // Each is ordered from least to most recently contacted.
+    using Bucket = std::vector<Entry>;
+
+    static constexpr size_t idBitCount = kademliaIdLengthInBytes * 8;
+    static constexpr size_t bucketCount = idBitCount + 1;
     static constexpr size_t defaultNodesPerKBucket = 20;
     static constexpr size_t defaultNodesToPing = 3;
 
-    DhtAddressRaw localNodeId;
+    NodeId localNodeId;
     size_t numberOfNodesPerKBucket;
     size_t numberOfNodesToPing;
-    Node root;
+    std::vector<Bucket> buckets;
+    size_t contactCount = 0;
+    // Contacts whose ids are shorter than a kademlia id. While there are
+    // none, closest() can walk the buckets instead of sorting them all.
+    size_t shortIdCount = 0;
 
     // The default vectorClock arbiter: the contact with the larger vector
     // clock wins; ties go to the candidate (the more recent contact).
@@ -113,203 +130,230 @@ private:
             : candidate;
     }
 
-    // Returns the child to descend into for `id` at `bitIndex`. An id too
-    // short to have the bit is treated as having a 0 bit (goes left),
-    // matching the library's out-of-range/undefined byte handling.
-    Node* determineNode(Node* node, const DhtAddressRaw& id, size_t bitIndex) {
-        const size_t bytesDescribedByBitIndex = bitIndex >> 3U;
-        const size_t bitIndexWithinByte = bitIndex % 8U;
-        if (bytesDescribedByBitIndex >= id.size()) {
-            return node->left.get();
+    // The NodeId pads a short id with 0 bits, matching the library's
+    // out-of-range/undefined byte handling.
+    static std::optional<NodeId> toNodeId(const DhtAddressRaw& id) {
+        if (id.size() > kademliaIdLengthInBytes) {
+            return std::nullopt;
         }
-        const auto byteUnderConsideration =
-            static_cast<unsigned char>(id[bytesDescribedByBitIndex]);
-        if ((byteUnderConsideration & (1U << (7U - bitIndexWithinByte))) != 0) {
-            return node->right.get();
-        }
-        return node->left.get();
+        return NodeId::fromRaw(id);
     }
 
-    // Index of the contact with `id` in a leaf node, or -1.
-    static int indexOf(const Node* node, const DhtAddressRaw& id) {
-        for (size_t i = 0; i < node->contacts->size(); ++i) {
-            if ((*node->contacts)[i]->getId() == id) {
-                return static_cast<int>(i);
+    static size_t commonPrefixLength(
+        const NodeId& firstId, const NodeId& secondId) {
+        const auto& first = firstId.getBytes();
+        const auto& second = secondId.getBytes();
+        for (size_t i = 0; i < kademliaIdLengthInBytes; ++i) {
+            const auto diff = static_cast<uint8_t>(first[i] ^ second[i]);
+            if (diff != 0) {
+                return (i * 8) + static_cast<size_t>(std::countl_zero(diff));
             }
         }
-        return -1;
+        return idBitCount;
     }
 
-    // Splits a full leaf into two children, redistributes its contacts, and
-    // marks the child NOT containing the local node id as dontSplit (the
-    // "far away" bucket does not split further).
-    void split(Node* node, size_t bitIndex) {
-        node->left = std::make_unique<Node>();
-        node->right = std::make_unique<Node>();
-        for (const auto& contact : *node->contacts) {
-            this->determineNode(node, contact->getId(), bitIndex)
-                ->contacts->push_back(contact);
-        }
-        node->contacts = std::nullopt; // mark as inner node
-        Node* detNode = this->determineNode(node, this->localNodeId, bitIndex);
-        Node* otherNode = (node->left.get() == detNode) ? node->right.get()
-                                                        : node->left.get();
-        otherNode->dontSplit = true;
+    Bucket& bucketOf(const NodeId& id) {
+        return this->buckets[commonPrefixLength(id, this->localNodeId)];
+    }
+
+    static typename Bucket::iterator find(Bucket& bucket, const NodeId& id) {
+        return std::ranges::find(bucket, id, &Entry::id);
     }
 
-    // Updates the contact at `index` using the arbiter. If the incumbent is
+    // Updates the contact at `it` using the arbiter. If the incumbent is
     // kept and the candidate is a different object, nothing changes;
     // otherwise the selection replaces it at the most-recently-contacted
     // (end) position and an `updated` event is emitted.
-    void update(Node* node, size_t index, const std::shared_ptr<C>& contact) {
-        const std::shared_ptr<C> incumbent = (*node->contacts)[index];
+    void update(
+        Bucket& bucket,
+        typename Bucket::iterator it,
+        const std::shared_ptr<C>& contact) {
+        const std::shared_ptr<C> incumbent = it->contact;
         const std::shared_ptr<C> selection = arbiter(incumbent, contact);
         if (selection == incumbent && incumbent != contact) {
             return;
         }
-        node->contacts->erase(
-            node->contacts->begin() + static_cast<std::ptrdiff_t>(index));
-        node->contacts->push_back(selection);
+        Entry entry = std::move(*it);
+        bucket.erase(it);
+        entry.contact = selection;
+        bucket.push_back(std::move(entry));
         this->template emit<kbucketevents::Updated<C>>(incumbent, selection);
     }
 
+    // Appends the buckets [first, last) to `found` as one group sorted by
+    // distance to `target`.
+    void collect(
+        std::vector<std::pair<PeerDistance, std::shared_ptr<C>>>& found,
+        const NodeId& target,
+        size_t first,
+        size_t last) const {
+        const auto groupStart = static_cast<std::ptrdiff_t>(found.size());
+        for (size_t i = first; i < last; ++i) {
+            for (const auto& entry : this->buckets[i]) {
+                found.emplace_back(
+                    getPeerDistance(entry.id, target), entry.contact);
+            }
+        }
+        std::ranges::stable_sort(
+            found.begin() + groupStart,
+            found.end(),
+            std::less<>{},
+            [](const auto& item) { return item.first; });
+    }
+
 public:
     explicit KBucket(KBucketOptions options)
-        : localNodeId(std::move(options.localNodeId)),
-          numberOfNodesPerKBucket(
+        : numberOfNodesPerKBucket(
               options.numberOfNodesPerKBucket.value_or(defaultNodesPerKBucket)),
           numberOfNodesToPing(
-              options.numberOfNodesToPing.value_or(defaultNodesToPing)) {}
+              options.numberOfNodesToPing.value_or(defaultNodesToPing)),
+          buckets(bucketCount) {
+        const auto localId = toNodeId(options.localNodeId);
+        if (!localId.has_value()) {
+            throw std::invalid_argument(
+                "KBucket localNodeId is longer than " +
+                std::to_string(kademliaIdLengthInBytes) + " bytes");
+        }
+        this->localNodeId = localId.value();
+    }
 
-    // Adds a contact. Descends to the owning leaf; updates it in place if
-    // already present; otherwise appends it if there is room; otherwise
-    // either pings (if the leaf cannot split) or splits and retries.
+    // Adds a contact. Updates it in place if already present; otherwise
+    // appends it if its bucket has room; otherwise emits `ping` with the
+    // bucket's least recently contacted nodes. (The library splits the
+    // bucket holding the local id instead; the bucket a contact ends up in
+    // after those splits is the one indexed here directly.)
     void add(const std::shared_ptr<C>& contact) {
-        size_t bitIndex = 0;
-        Node* node = &this->root;
-        while (node->isInner()) {
-            node = this->determineNode(node, contact->getId(), bitIndex++);
+        const auto id = toNodeId(contact->getId());
+        if (!id.has_value()) {
+            throw std::invalid_argument(
+                "KBucket contact ids are at most " +
+                std::to_string(kademliaIdLengthInBytes) + " bytes");
         }
-        const int index = indexOf(node, contact->getId());
-        if (index >= 0) {
-            this->update(node, static_cast<size_t>(index), contact);
+        Bucket& bucket = this->bucketOf(id.value());
+        const auto it = find(bucket, id.value());
+        if (it != bucket.end()) {
+            this->update(bucket, it, contact);
             return;
         }
-        if (node->contacts->size() < this->numberOfNodesPerKBucket) {
-            node->contacts->push_back(contact);
+        if (bucket.size() < this->numberOfNodesPerKBucket) {
+            if (bucket.capacity() == 0) {
+                bucket.reserve(this->numberOfNodesPerKBucket);
+            }
+            bucket.push_back(Entry{.id = id.value(), .contact = contact});
+            this->contactCount++;
+            if (!id->isFullLength()) {
+                this->shortIdCount++;
+            }
             this->template emit<kbucketevents::Added<C>>(contact);
             return;
         }
-        if (node->dontSplit) {
-            const size_t pingCount =
-                std::min(this->numberOfNodesToPing, node->contacts->size());
-            std::vector<std::shared_ptr<C>> toPing(
-                node->contacts->begin(),
-                node->contacts->begin() +
-                    static_cast<std::ptrdiff_t>(pingCount));
-            this->template emit<kbucketevents::Ping<C>>(toPing, contact);
-            return;
+        const size_t pingCount =
+            std::min(this->numberOfNodesToPing, bucket.size());
+        std::vector<std::shared_ptr<C>> toPing;
+        toPing.reserve(pingCount);
+        for (size_t i = 0; i < pingCount; ++i) {
+            toPing.push_back(bucket[i].contact);
         }
-        this->split(node, bitIndex);
-        this->add(contact);
+        this->template emit<kbucketevents::Ping<C>>(toPing, contact);
     }
 
     // The contact with the exact id, or nullptr.
     [[nodiscard]] std::shared_ptr<C> get(const DhtAddressRaw& id) {
-        size_t bitIndex = 0;
-        Node* node = &this->root;
-        while (node->isInner()) {
-            node = this->determineNode(node, id, bitIndex++);
+        const auto nodeId = toNodeId(id);
+        if (!nodeId.has_value()) {
+            return nullptr;
         }
-        const int index = indexOf(node, id);
-        return index >= 0 ? (*node->contacts)[static_cast<size_t>(index)]
-                          : nullptr;
+        Bucket& bucket = this->bucketOf(nodeId.value());
+        const auto it = find(bucket, nodeId.value());
+        return it != bucket.end() ? it->contact : nullptr;
     }
 
     // Removes the contact with the id (emitting `removed` if it was present).
     void remove(const DhtAddressRaw& id) {
-        size_t bitIndex = 0;
-        Node* node = &this->root;
-        while (node->isInner()) {
-            node = this->determineNode(node, id, bitIndex++);
+        const auto nodeId = toNodeId(id);
+        if (!nodeId.has_value()) {
+            return;
         }
-        const int index = indexOf(node, id);
-        if (index >= 0) {
-            const std::shared_ptr<C> contact =
-                (*node->contacts)[static_cast<size_t>(index)];
-            node->contacts->erase(node->contacts->begin() + index);
-            this->template emit<kbucketevents::Removed<C>>(contact);
+        Bucket& bucket = this->bucketOf(nodeId.value());
+        const auto it = find(bucket, nodeId.value());
+        if (it == bucket.end()) {
+            return;
+        }
+        const std::shared_ptr<C> contact = it->contact;
+        bucket.erase(it);
+        this->contactCount--;
+        if (!nodeId->isFullLength()) {
+            this->shortIdCount--;
         }
+        this->template emit<kbucketevents::Removed<C>>(contact);
     }
 
     // The up-to-`n` closest contacts to `id` by the XOR metric, nearest
     // first. Without a limit, all contacts are returned in that order.
+    //
+    // With full-length ids the bucket index orders the buckets: if the
+    // target shares c leading bits with the local id, bucket c is nearest
+    // to it, then the buckets above c (all differ from it first at bit c),
+    // then buckets c - 1 down to 0. Only the groups needed to reach `n`
+    // are visited and sorted.
     [[nodiscard]] std::vector<std::shared_ptr<C>> closest(
         const DhtAddressRaw& id, std::optional<size_t> n = std::nullopt) {
         const size_t limit = n.value_or(SIZE_MAX);
         std::vector<std::shared_ptr<C>> contacts;
-        std::vector<Node*> nodes{&this->root};
-        size_t bitIndex = 0;
-        while (!nodes.empty() && contacts.size() < limit) {
-            Node* node = nodes.back();
-            nodes.pop_back();
-            if (node->isInner()) {
-                Node* detNode = this->determineNode(node, id, bitIndex++);
-                nodes.push_back(
-                    node->left.get() == detNode ? node->right.get()
-                                                : node->left.get());
-                nodes.push_back(detNode);
-            } else {
-                contacts.insert(
-                    contacts.end(),
-                    node->contacts->begin(),
-                    node->contacts->end());
+        if (limit == 0) {
+            return contacts;
+        }
+        std::vector<std::pair<PeerDistance, std::shared_ptr<C>>> found;
+        const auto targetId = toNodeId(id);
+        if (this->shortIdCount == 0 && this->localNodeId.isFullLength() &&
+            targetId.has_value() && targetId->isFullLength()) {
+            const NodeId& target = targetId.value();
+            const size_t c = commonPrefixLength(target, this->localNodeId);
+            this->collect(found, target, c, c + 1);
+            if (found.size() < limit) {
+                this->collect(found, target, c + 1, bucketCount);
             }
+            for (size_t i = c; i > 0 && found.size() < limit; --i) {
+                this->collect(found, target, i - 1, i);
+            }
+        } else {
+            // Mixed id lengths use the k-bucket fold of getPeerDistance,
+            // which the bucket order does not follow.
+            found.reserve(this->contactCount);
+            for (const auto& bucket : this->buckets) {
+                for (const auto& entry : bucket) {
+                    found.emplace_back(
+                        targetId.has_value()
+                            ? getPeerDistance(entry.id, targetId.value())
+                            : getPeerDistance(entry.id.toRaw(), id),
+                        entry.contact);
+                }
+            }
+            std::ranges::stable_sort(
+                found, std::less<>{}, [](const auto& item) {
+                    return item.first;
+                });
         }
-        std::ranges::stable_sort(
-            contacts,
-            [&id](const std::shared_ptr<C>& a, const std::shared_ptr<C>& b) {
-                return getPeerDistance(a->getId(), id) <
-                    getPeerDistance(b->getId(), id);
-            });
-        if (contacts.size() > limit) {
-            contacts.resize(limit);
+        if (found.size() > limit) {
+            found.resize(limit);
+        }
+        contacts.reserve(found.size());
+        for (auto& item : found) {
+            contacts.push_back(std::move(item.second));
         }
         return contacts;
     }
 
-    // The total number of contacts held in the tree.
-    [[nodiscard]] size_t count() {
-        size_t count = 0;
-        std::vector<Node*> nodes{&this->root};
-        while (!nodes.empty()) {
-            Node* node = nodes.back();
-            nodes.pop_back();
-            if (node->isInner()) {
-                nodes.push_back(node->right.get());
-                nodes.push_back(node->left.get());
-            } else {
-                count += node->contacts->size();
-            }
-        }
-        return count;
-    }
+    // The total number of contacts held.
+    [[nodiscard]] size_t count() const { return this->contactCount; }
 
-    // All contacts in the tree.
-    [[nodiscard]] std::vector<std::shared_ptr<C>> toArray() {
+    // All contacts, bucket by bucket from the farthest from the local id.
+    [[nodiscard]] std::vector<std::shared_ptr<C>> toArray() const {
         std::vector<std::shared_ptr<C>> result;
-        std::vector<Node*> nodes{&this->root};
-        while (!nodes.empty()) {
-            Node* node = nodes.back();
-            nodes.pop_back();
-            if (node->isInner()) {
-                nodes.push_back(node->right.get());
-                nodes.push_back(node->left.get());
-            } else {
-                result.insert(
-                    result.end(),
-                    node->contacts->begin(),
-                    node->contacts->end());
+        result.reserve(this->contactCount);
+        for (const auto& bucket : this->buckets) {
+            for (const auto& entry : bucket) {
+                result.push_back(entry.contact);
             }
         }
         return result;
@@ -1,6 +1,7 @@
 // Module streamr.dht.RandomContactList
 // Ported from packages/dht/src/dht/contact/RandomContactList.ts
-// (v103.8.0-rc.3).
+// (v103.8.0-rc.3). Contacts whose ids are not hex of at most a kademlia id
+// are not added (see ContactList).
 module;
 
 #include <algorithm>
@@ -8,7 +9,6 @@ module;
 #include <memory>
 #include <optional>
 #include <random>
-#include <utility>
 #include <vector>
 
 export module streamr.dht.RandomContactList;
@@ -19,6 +19,7 @@ import streamr.dht.Identifiers;
 export namespace streamr::dht::contact {
 
 using streamr::dht::DhtAddress;
+using streamr::dht::NodeId;
 
 // Keeps a random sample of the contacts offered to it: each new contact is
 // admitted with probability `randomness`, evicting the oldest once full.
@@ -31,31 +32,39 @@ private:
 
 public:
     RandomContactList(
-        DhtAddress localNodeId,
+        const DhtAddress& localNodeId,
         size_t maxSize,
         double randomness = 0.20) // NOLINT(readability-magic-numbers)
-        : ContactList<C>(std::move(localNodeId), maxSize),
+        : ContactList<C>(localNodeId, maxSize),
           randomness(randomness) {}
 
     void addContact(const std::shared_ptr<C>& contact) {
-        if (this->localNodeId == contact->getNodeId()) {
+        const auto parsedId = NodeId::tryFromDhtAddress(contact->getNodeId());
+        if (!parsedId.has_value()) {
             return;
         }
-        if (this->contactsById.contains(contact->getNodeId())) {
+        const NodeId id = parsedId.value();
+        if (this->localNodeId == id || this->contactsById.contains(id)) {
             return;
         }
         const double roll = this->distribution(this->randomGenerator);
         if (roll < this->randomness) {
             if (this->getSize() == this->maxSize && this->getSize() > 0) {
-                this->removeContact(this->contactIds.front());
+                const NodeId oldestId = this->contactIds.front();
+                this->removeContact(oldestId);
             }
-            this->contactIds.push_back(contact->getNodeId());
-            this->contactsById.emplace(contact->getNodeId(), contact);
+            this->contactIds.push_back(id);
+            this->contactsById.emplace(id, contact);
             this->template emit<contactlistevents::ContactAdded<C>>(contact);
         }
     }
 
     bool removeContact(const DhtAddress& id) {
+        const auto nodeId = NodeId::tryFromDhtAddress(id);
+        return nodeId.has_value() && this->removeContact(nodeId.value());
+    }
+
+    bool removeContact(const NodeId& id) {
         const auto it = this->contactsById.find(id);
         if (it == this->contactsById.end()) {
             return false;
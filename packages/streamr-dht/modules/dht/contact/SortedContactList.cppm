@@ -1,13 +1,23 @@
 // Module streamr.dht.SortedContactList
 // Ported from packages/dht/src/dht/contact/SortedContactList.ts
 // (v103.8.0-rc.3). Unlike RandomContactList it does NOT extend
-// ContactList — it keeps its own contactsById/contactIds and only reuses
-// ContactList's event tuple (matching TS).
+// ContactList — it keeps its own contacts and only reuses ContactList's
+// event tuple (matching TS).
+//
+// Adaptations: instead of TS's contactsById map plus an id array that
+// re-derives distances on every comparison, the contacts live in one
+// array sorted by their distance to the reference id, computed once on
+// add and kept with the contact's binary NodeId. Lookups and removals
+// binary-search that distance. Contacts whose ids are not hex of at most
+// a kademlia id are not added; a reference id or distance limit that
+// malformed is as far as possible from every contact, as in the k-bucket
+// fold of getPeerDistance.
 module;
 
 #include <algorithm>
+#include <compare>
 #include <cstddef>
-#include <map>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <set>
@@ -27,9 +37,9 @@ using streamr::eventemitter::EventEmitter;
 export namespace streamr::dht::contact {
 
 using streamr::dht::DhtAddress;
-using streamr::dht::DhtAddressRaw;
-using streamr::dht::Identifiers;
 using streamr::dht::helpers::getPeerDistance;
+using streamr::dht::helpers::PeerDistance;
+using streamr::dht::NodeId;
 
 struct SortedContactListOptions {
     // all contacts in this list are sorted by the distance to this id
@@ -45,85 +55,148 @@ struct SortedContactListOptions {
 template <HasGetNodeId C>
 class SortedContactList : public EventEmitter<ContactListEvents<C>> {
 private:
+    // A contact with its distance to the reference id, computed once when
+    // it is added.
+    struct Entry {
+        PeerDistance distance;
+        NodeId id;
+        std::shared_ptr<C> contact;
+    };
+
     SortedContactListOptions options;
-    DhtAddressRaw referenceIdRaw;
-    std::map<DhtAddress, std::shared_ptr<C>> contactsById;
-    std::vector<DhtAddress> contactIds; // sorted ascending by distance
-
-    [[nodiscard]] double distanceToReferenceId(const DhtAddress& id) const {
-        return getPeerDistance(
-            this->referenceIdRaw, Identifiers::getRawFromDhtAddress(id));
-    }
-
-    // Lowest index at which contactId keeps contactIds sorted ascending by
-    // distance (lodash sortedIndexBy: leftmost position for equal keys).
-    [[nodiscard]] size_t sortedInsertionIndex(
-        const DhtAddress& contactId) const {
-        const double distance = this->distanceToReferenceId(contactId);
-        const auto it = std::lower_bound(
-            this->contactIds.begin(),
-            this->contactIds.end(),
-            distance,
-            [this](const DhtAddress& existing, double value) {
-                return this->distanceToReferenceId(existing) < value;
-            });
-        return static_cast<size_t>(it - this->contactIds.begin());
+    std::optional<NodeId> referenceId;
+    std::set<NodeId> excludedIds;
+    std::optional<PeerDistance> distanceLimit;
+    std::vector<Entry> entries; // sorted ascending by distance
+
+    static PeerDistance maxDistance() {
+        NodeId::Bytes bytes{};
+        bytes.fill(0xff); // NOLINT(readability-magic-numbers)
+        return PeerDistance::fromBigEndianBytes(bytes);
+    }
+
+    [[nodiscard]] PeerDistance distanceToReferenceId(const NodeId& id) const {
+        return this->referenceId.has_value()
+            ? getPeerDistance(this->referenceId.value(), id)
+            : maxDistance();
+    }
+
+    [[nodiscard]] PeerDistance distanceToReferenceId(
+        const DhtAddress& id) const {
+        const auto nodeId = NodeId::tryFromDhtAddress(id);
+        return nodeId.has_value() ? this->distanceToReferenceId(nodeId.value())
+                                  : maxDistance();
+    }
+
+    // Lowest index at which `distance` keeps the entries sorted (lodash
+    // sortedIndexBy: leftmost position for equal keys).
+    [[nodiscard]] auto lowerBound(const PeerDistance& distance) const {
+        return std::ranges::lower_bound(
+            this->entries, distance, std::less<>{}, &Entry::distance);
+    }
+
+    // The entry of `id`, whose distance to the reference id the caller has
+    // already computed.
+    [[nodiscard]] auto find(
+        const NodeId& id, const PeerDistance& distance) const {
+        // Only ids of differing lengths can share a distance, so the scan
+        // normally stops at the first entry.
+        for (auto it = this->lowerBound(distance);
+             it != this->entries.end() && it->distance == distance;
+             ++it) {
+            if (it->id == id) {
+                return it;
+            }
+        }
+        return this->entries.end();
+    }
+
+    [[nodiscard]] auto find(const DhtAddress& id) const {
+        const auto nodeId = NodeId::tryFromDhtAddress(id);
+        if (!nodeId.has_value()) {
+            return this->entries.end();
+        }
+        return this->find(
+            nodeId.value(), this->distanceToReferenceId(nodeId.value()));
+    }
+
+    void insert(
+        PeerDistance distance,
+        NodeId id,
+        const std::shared_ptr<C>& contact) {
+        const auto position = this->lowerBound(distance);
+        this->entries.insert(
+            position,
+            Entry{.distance = distance, .id = id, .contact = contact});
     }
 
 public:
     explicit SortedContactList(SortedContactListOptions options)
         : options(std::move(options)),
-          referenceIdRaw(
-              Identifiers::getRawFromDhtAddress(this->options.referenceId)) {}
+          referenceId(NodeId::tryFromDhtAddress(this->options.referenceId)) {
+        if (this->options.excludedNodeIds.has_value()) {
+            for (const auto& excludedId :
+                 this->options.excludedNodeIds.value()) {
+                if (const auto id = NodeId::tryFromDhtAddress(excludedId)) {
+                    this->excludedIds.insert(id.value());
+                }
+            }
+            this->options.excludedNodeIds.reset();
+        }
+        if (this->options.nodeIdDistanceLimit.has_value()) {
+            this->distanceLimit = this->distanceToReferenceId(
+                this->options.nodeIdDistanceLimit.value());
+        }
+        if (this->options.maxSize.has_value()) {
+            this->entries.reserve(this->options.maxSize.value() + 1);
+        }
+    }
 
     [[nodiscard]] DhtAddress getClosestContactId() const {
-        return this->contactIds.front();
+        return this->entries.front().id.toDhtAddress();
     }
 
     [[nodiscard]] std::vector<DhtAddress> getContactIds() const {
-        return this->contactIds;
+        std::vector<DhtAddress> ids;
+        ids.reserve(this->entries.size());
+        for (const auto& entry : this->entries) {
+            ids.push_back(entry.id.toDhtAddress());
+        }
+        return ids;
     }
 
     void addContact(const std::shared_ptr<C>& contact) {
-        const DhtAddress contactId = contact->getNodeId();
-        if (this->options.excludedNodeIds.has_value() &&
-            this->options.excludedNodeIds->contains(contactId)) {
+        const auto parsedId = NodeId::tryFromDhtAddress(contact->getNodeId());
+        if (!parsedId.has_value()) {
+            return;
+        }
+        const NodeId contactId = parsedId.value();
+        if (this->excludedIds.contains(contactId)) {
             return;
         }
-        if ((!this->options.allowToContainReferenceId &&
-             this->options.referenceId == contactId) ||
-            (this->options.nodeIdDistanceLimit.has_value() &&
-             this->compareIds(
-                 this->options.nodeIdDistanceLimit.value(), contactId) < 0)) {
+        if (!this->options.allowToContainReferenceId &&
+            this->referenceId == contactId) {
             return;
         }
-        if (this->contactsById.contains(contactId)) {
+        const PeerDistance distance = this->distanceToReferenceId(contactId);
+        if (this->distanceLimit.has_value() &&
+            this->distanceLimit.value() < distance) {
+            return;
+        }
+        if (this->find(contactId, distance) != this->entries.end()) {
             return;
         }
         if (!this->options.maxSize.has_value() ||
-            this->contactIds.size() < this->options.maxSize.value()) {
-            this->contactsById.emplace(contactId, contact);
-            this->contactIds.insert(
-                this->contactIds.begin() +
-                    static_cast<std::ptrdiff_t>(
-                        this->sortedInsertionIndex(contactId)),
-                contactId);
+            this->entries.size() < this->options.maxSize.value()) {
+            this->insert(distance, contactId, contact);
             this->template emit<contactlistevents::ContactAdded<C>>(contact);
         } else if (
-            this->compareIds(
-                this->contactIds[this->options.maxSize.value() - 1],
-                contactId) > 0) {
-            const DhtAddress removedId = this->contactIds.back();
-            this->contactIds.pop_back();
+            distance <
+            this->entries[this->options.maxSize.value() - 1].distance) {
             const std::shared_ptr<C> removedContact =
-                this->contactsById.at(removedId);
-            this->contactsById.erase(removedId);
-            this->contactsById.emplace(contactId, contact);
-            this->contactIds.insert(
-                this->contactIds.begin() +
-                    static_cast<std::ptrdiff_t>(
-                        this->sortedInsertionIndex(contactId)),
-                contactId);
+                std::move(this->entries.back().contact);
+            this->entries.pop_back();
+            this->insert(distance, contactId, contact);
             this->template emit<contactlistevents::ContactRemoved<C>>(
                 removedContact);
             this->template emit<contactlistevents::ContactAdded<C>>(contact);
@@ -137,15 +210,15 @@ public:
     }
 
     [[nodiscard]] std::shared_ptr<C> getContact(const DhtAddress& id) const {
-        const auto it = this->contactsById.find(id);
-        if (it == this->contactsById.end()) {
+        const auto it = this->find(id);
+        if (it == this->entries.end()) {
             return nullptr;
         }
-        return it->second;
+        return it->contact;
     }
 
     [[nodiscard]] bool has(const DhtAddress& id) const {
-        return this->contactsById.contains(id);
+        return this->find(id) != this->entries.end();
     }
 
     // Closest first, then others in ascending distance order.
@@ -153,13 +226,13 @@ public:
         std::optional<int> limit = std::nullopt) const {
         const size_t count = limit.has_value()
             ? std::min(
-                  this->contactIds.size(),
+                  this->entries.size(),
                   static_cast<size_t>(std::max(limit.value(), 0)))
-            : this->contactIds.size();
+            : this->entries.size();
         std::vector<std::shared_ptr<C>> result;
         result.reserve(count);
         for (size_t i = 0; i < count; ++i) {
-            result.push_back(this->contactsById.at(this->contactIds[i]));
+            result.push_back(this->entries[i].contact);
         }
         return result;
     }
@@ -178,23 +251,23 @@ public:
         return reversed;
     }
 
-    [[nodiscard]] double compareIds(
+    // Negative if id1 is closer to the reference id than id2, positive if
+    // it is further away and 0 if they are equally far. (TS returns the
+    // difference of the distances; only its sign is meaningful.)
+    [[nodiscard]] int compareIds(
         const DhtAddress& id1, const DhtAddress& id2) const {
-        return this->distanceToReferenceId(id1) -
+        const auto order = this->distanceToReferenceId(id1) <=>
             this->distanceToReferenceId(id2);
+        return order < 0 ? -1 : (order > 0 ? 1 : 0);
     }
 
     bool removeContact(const DhtAddress& id) {
-        const auto it = this->contactsById.find(id);
-        if (it == this->contactsById.end()) {
+        const auto it = this->find(id);
+        if (it == this->entries.end()) {
             return false;
         }
-        const std::shared_ptr<C> removed = it->second;
-        const auto idIt = std::ranges::find(this->contactIds, id);
-        if (idIt != this->contactIds.end()) {
-            this->contactIds.erase(idIt);
-        }
-        this->contactsById.erase(it);
+        const std::shared_ptr<C> removed = it->contact;
+        this->entries.erase(it);
         this->template emit<contactlistevents::ContactRemoved<C>>(removed);
         return true;
     }
@@ -202,9 +275,9 @@ public:
     [[nodiscard]] std::vector<std::shared_ptr<C>>
     getAllContactsInUndefinedOrder() const {
         std::vector<std::shared_ptr<C>> result;
-        result.reserve(this->contactsById.size());
-        for (const auto& [id, contact] : this->contactsById) {
-            result.push_back(contact);
+        result.reserve(this->entries.size());
+        for (const auto& entry : this->entries) {
+            result.push_back(entry.contact);
         }
         return result;
     }
@@ -220,13 +293,10 @@ public:
                 }
             }
         }
-        return this->contactIds.size() - excludedCount;
+        return this->entries.size() - excludedCount;
     }
 
-    void clear() {
-        this->contactsById.clear();
-        this->contactIds.clear();
-    }
+    void clear() { this->entries.clear(); }
 
     void stop() {
         this->removeAllListeners();
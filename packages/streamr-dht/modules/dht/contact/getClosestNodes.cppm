@@ -1,49 +1,106 @@
 // Module streamr.dht.getClosestNodes
 // Ported from packages/dht/src/dht/contact/getClosestNodes.ts
-// (v103.8.0-rc.3).
+// (v103.8.0-rc.3). Adaptations: TS adds every descriptor to a throwaway
+// SortedContactList; this port drops duplicate ids with a hash set,
+// computes one distance key per remaining descriptor and selects the
+// closest maxCount with a partial sort, without creating a Contact per
+// descriptor.
 module;
 
+#include <algorithm>
+#include <compare>
 #include <cstddef>
-#include <memory>
 #include <optional>
 #include <set>
+#include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
 export module streamr.dht.getClosestNodes;
 
 import streamr.dht.protos;
 
-import streamr.dht.Contact;
 import streamr.dht.Identifiers;
-import streamr.dht.SortedContactList;
+import streamr.dht.getPeerDistance;
 
 export namespace streamr::dht::contact {
 
 using ::dht::PeerDescriptor;
 using streamr::dht::DhtAddress;
+using streamr::dht::DhtAddressRaw;
+using streamr::dht::Identifiers;
+using streamr::dht::kademliaIdLengthInBytes;
+using streamr::dht::NodeId;
+using streamr::dht::helpers::getPeerDistance;
+using streamr::dht::helpers::PeerDistance;
 
 struct GetClosestNodesOptions {
     std::optional<size_t> maxCount;
     std::optional<std::set<DhtAddress>> excludedNodeIds;
 };
 
+namespace detail {
+
+// Ordered by distance, then by input position, so that the result does
+// not depend on the sort algorithm.
+struct ClosestNodeCandidate {
+    PeerDistance distance;
+    size_t index;
+
+    auto operator<=>(const ClosestNodeCandidate&) const = default;
+};
+
+} // namespace detail
+
 inline std::vector<PeerDescriptor> getClosestNodes(
     const DhtAddress& referenceId,
     const std::vector<PeerDescriptor>& contacts,
     const GetClosestNodesOptions& opts = {}) {
-    SortedContactList<Contact> list(
-        SortedContactListOptions{
-            .referenceId = referenceId,
-            .allowToContainReferenceId = true,
-            .maxSize = opts.maxCount,
-            .nodeIdDistanceLimit = std::nullopt,
-            .excludedNodeIds = opts.excludedNodeIds});
-    for (const auto& contact : contacts) {
-        list.addContact(std::make_shared<Contact>(contact));
+    using detail::ClosestNodeCandidate;
+    const DhtAddressRaw referenceIdRaw =
+        Identifiers::getRawFromDhtAddress(referenceId);
+    const bool fullLengthReference =
+        referenceIdRaw.size() == kademliaIdLengthInBytes;
+    const NodeId referenceNodeId =
+        fullLengthReference ? NodeId::fromRaw(referenceIdRaw) : NodeId{};
+    const auto distanceTo = [&](const std::string& nodeId) {
+        if (fullLengthReference && nodeId.size() == kademliaIdLengthInBytes) {
+            return getPeerDistance(referenceNodeId, NodeId::fromRaw(nodeId));
+        }
+        return getPeerDistance(referenceIdRaw, DhtAddressRaw{nodeId});
+    };
+    const bool hasExclusions = opts.excludedNodeIds.has_value() &&
+        !opts.excludedNodeIds->empty();
+
+    // Of two contacts with the same id the first one wins, as
+    // SortedContactList keeps the first one added. The views point into
+    // contacts, which outlives the set.
+    std::unordered_set<std::string_view> seenIds;
+    seenIds.reserve(contacts.size());
+    std::vector<ClosestNodeCandidate> candidates;
+    candidates.reserve(contacts.size());
+    for (size_t i = 0; i < contacts.size(); ++i) {
+        if (!seenIds.insert(contacts[i].nodeid()).second) {
+            continue;
+        }
+        if (hasExclusions &&
+            opts.excludedNodeIds->contains(
+                Identifiers::getNodeIdFromPeerDescriptor(contacts[i]))) {
+            continue;
+        }
+        candidates.push_back(ClosestNodeCandidate{
+            .distance = distanceTo(contacts[i].nodeid()), .index = i});
     }
+
+    const size_t count =
+        std::min(opts.maxCount.value_or(candidates.size()), candidates.size());
+    std::ranges::partial_sort(
+        candidates, candidates.begin() + static_cast<std::ptrdiff_t>(count));
     std::vector<PeerDescriptor> result;
-    for (const auto& contact : list.getClosestContacts()) {
-        result.push_back(contact->getPeerDescriptor());
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        result.push_back(contacts[candidates[i].index]);
     }
     return result;
 }
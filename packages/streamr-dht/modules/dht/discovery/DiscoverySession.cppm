@@ -21,11 +21,31 @@
 // computing), so unlike the Router's routing-table work it is not offloaded to
 // a dedicated worker executor; the fan-out runs on whatever executor drives the
 // join and yields at every RPC await.
+//
+// Native additions (all off in DiscoverySessionOptions by default, so a
+// session configured like the TS one behaves like it; DhtNode turns on one
+// hedged request for its joins through joinMaxHedgedRequests):
+// - With a latencyTracker, each request's round trip or failure is recorded,
+//   and contacts that keep failing are queried after the others.
+// - maxHedgedRequests hedger coroutines watch the requests in flight. Once
+//   one has been waiting longer than the tracker's hedge delay (the recent
+//   p95 round trip), a hedger queries the next candidate next to it rather
+//   than leaving the lookup waiting on one slow peer. When the workers have
+//   run out of candidates and returned, the hedgers also carry on the walk
+//   from the contacts later responses bring.
+// - With a closestSetSize, the session finishes once its closestSetSize
+//   closest neighbours have stayed the same over `parallelism` consecutive
+//   responses, instead of waiting for noProgressLimit.
+// Finishing cancels the requests still in flight; TS likewise ignores their
+// responses once the Gate has closed. getStats() reports the request
+// counts, the hop count and the duration of the lookup.
 module;
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -48,6 +68,7 @@ import streamr.dht.DhtNodeRpcRemote;
 import streamr.dht.getClosestNodes;
 import streamr.dht.getPeerDistance;
 import streamr.dht.Identifiers;
+import streamr.dht.LookupLatencyTracker;
 import streamr.dht.PeerManager;
 
 // Hoisted from the former header (file scope, NOT exported).
@@ -79,17 +100,76 @@ struct DiscoverySessionOptions {
     AbortSignal& abortSignal;
     std::function<std::shared_ptr<DhtNodeRpcRemote>(const PeerDescriptor&)>
         createDhtNodeRpcRemote;
+    // Shared with the node's other sessions; null disables the latency
+    // tracking (and with it hedging).
+    std::shared_ptr<LookupLatencyTracker> latencyTracker = nullptr;
+    // Extra requests the session may have in flight next to ones that are
+    // slower than the tracker's hedge delay.
+    size_t maxHedgedRequests = 0;
+    // Finish once this many closest neighbours are stable for a round of
+    // responses (0 waits for noProgressLimit instead).
+    size_t closestSetSize = 0;
+};
+
+struct DiscoverySessionStats {
+    // getClosestPeers requests sent, hedged ones included.
+    size_t requestCount = 0;
+    size_t hedgedRequestCount = 0;
+    size_t failedRequestCount = 0;
+    // The longest chain of referrals the lookup followed: the contacts it
+    // started from are one hop away, the contacts they returned two, etc.
+    size_t hopCount = 0;
+    std::chrono::milliseconds duration{0};
+    // Whether the closest set settled before the lookup ran out of progress.
+    bool stoppedEarly = false;
 };
 
 class DiscoverySession {
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct OngoingRequest {
+        Clock::time_point startedAt;
+        size_t hop;
+        bool hedged = false;
+    };
+
     std::string id = Uuid::v4();
     size_t noProgressCounter = 0;
-    std::set<DhtAddress> ongoingRequests;
+    std::map<DhtAddress, OngoingRequest> ongoingRequests;
     bool done = false; // the single-shot Gate, guarded by the mutex
+    // Requested when the session finishes: wakes the hedgers and cancels
+    // the requests still in flight.
+    folly::CancellationSource finished;
+    // The hop each contact was learned on (see DiscoverySessionStats).
+    std::map<DhtAddress, size_t> contactHops;
+    std::vector<DhtAddress> closestSet;
+    size_t stableResponseCount = 0;
+    Clock::time_point startedAt;
+    std::optional<Clock::time_point> endedAt;
+    DiscoverySessionStats stats;
     std::recursive_mutex mutex;
     DiscoverySessionOptions options;
 
+    void finish() {
+        std::scoped_lock lock(this->mutex);
+        this->done = true;
+        this->finished.requestCancellation();
+    }
+
+    // Whether the session is over; finishes it when it ran out of progress.
+    [[nodiscard]] bool shouldStop() {
+        std::scoped_lock lock(this->mutex);
+        if (this->options.abortSignal.aborted || this->done) {
+            return true;
+        }
+        if (this->noProgressCounter >= this->options.noProgressLimit) {
+            this->finish();
+            return true;
+        }
+        return false;
+    }
+
     void addContacts(const std::vector<PeerDescriptor>& contacts) {
         std::scoped_lock lock(this->mutex);
         if (this->options.abortSignal.aborted || this->done) {
@@ -113,8 +193,11 @@ private:
         SLogger::trace("Getting closest neighbors from remote: " + nodeId);
         const auto remote =
             this->options.createDhtNodeRpcRemote(peerDescriptor);
-        auto returnedContacts =
-            co_await remote->getClosestPeers(this->options.targetId);
+        auto returnedContacts = co_await streamr::utils::co_withCancellation(
+            streamr::utils::cancellationTokenMerge(
+                co_await streamr::utils::co_currentCancellationToken(),
+                this->finished.getToken()),
+            remote->getClosestPeers(this->options.targetId));
         {
             std::scoped_lock lock(this->mutex);
             this->options.peerManager.setContactActive(nodeId);
@@ -122,32 +205,73 @@ private:
         co_return returnedContacts;
     }
 
-    // Returns nullopt when there are no neighbours yet (TS would index [0] of
-    // an empty array; guarding avoids the undefined access).
-    [[nodiscard]] std::optional<PeerDescriptor> getClosestNeighbor() {
+    [[nodiscard]] std::vector<PeerDescriptor> getClosestNeighbors(
+        size_t maxCount) {
         std::vector<PeerDescriptor> neighborDescriptors;
         const auto neighbors = this->options.peerManager.getNeighbors();
         neighborDescriptors.reserve(neighbors.size());
         for (const auto& neighbor : neighbors) {
             neighborDescriptors.push_back(neighbor->getPeerDescriptor());
         }
-        const auto closest = getClosestNodes(
+        return getClosestNodes(
             this->options.targetId,
             neighborDescriptors,
-            GetClosestNodesOptions{.maxCount = 1});
+            GetClosestNodesOptions{.maxCount = maxCount});
+    }
+
+    // Returns nullopt when there are no neighbours yet (TS would index [0] of
+    // an empty array; guarding avoids the undefined access).
+    [[nodiscard]] std::optional<PeerDescriptor> getClosestNeighbor() {
+        const auto closest = this->getClosestNeighbors(1);
         if (closest.empty()) {
             return std::nullopt;
         }
         return closest.front();
     }
 
+    // Counts the responses after which the closestSetSize closest neighbours
+    // were unchanged, and finishes the session after a round of them.
+    void checkClosestSetStable() {
+        if (this->options.closestSetSize == 0) {
+            return;
+        }
+        std::vector<DhtAddress> current;
+        for (const auto& neighbor :
+             this->getClosestNeighbors(this->options.closestSetSize)) {
+            current.push_back(
+                Identifiers::getNodeIdFromPeerDescriptor(neighbor));
+        }
+        if (current.empty() || current != this->closestSet) {
+            this->closestSet = std::move(current);
+            this->stableResponseCount = 0;
+            return;
+        }
+        this->stableResponseCount++;
+        if (this->stableResponseCount >= this->options.parallelism) {
+            this->stats.stoppedEarly = true;
+            this->finish();
+        }
+    }
+
     void onRequestSucceeded(
         const DhtAddress& nodeId, const std::vector<PeerDescriptor>& contacts) {
         std::scoped_lock lock(this->mutex);
-        if (!this->ongoingRequests.contains(nodeId)) {
+        const auto request = this->ongoingRequests.find(nodeId);
+        if (request == this->ongoingRequests.end()) {
             return;
         }
-        this->ongoingRequests.erase(nodeId);
+        if (this->options.latencyTracker != nullptr) {
+            this->options.latencyTracker->recordSuccess(
+                nodeId,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    Clock::now() - request->second.startedAt));
+        }
+        for (const auto& contact : contacts) {
+            this->contactHops.emplace(
+                Identifiers::getNodeIdFromPeerDescriptor(contact),
+                request->second.hop + 1);
+        }
+        this->ongoingRequests.erase(request);
         const auto targetIdRaw =
             Identifiers::getRawFromDhtAddress(this->options.targetId);
         const auto oldClosestNeighbor = this->getClosestNeighbor();
@@ -166,6 +290,7 @@ private:
         } else if (!newClosestNeighbor.has_value()) {
             this->noProgressCounter++;
         }
+        this->checkClosestSetStable();
     }
 
     void onRequestFailed(const DhtAddress& nodeId) {
@@ -174,9 +299,75 @@ private:
             return;
         }
         this->ongoingRequests.erase(nodeId);
+        this->stats.failedRequestCount++;
+        if (this->options.latencyTracker != nullptr) {
+            this->options.latencyTracker->recordFailure(nodeId);
+        }
         this->options.peerManager.removeContact(nodeId);
     }
 
+    // Claims the closest uncontacted node that is not being queried (one
+    // the tracker does not consider unreliable, if there is one), or
+    // returns nullopt. The caller holds the mutex.
+    [[nodiscard]] std::optional<PeerDescriptor> claimNextNode() {
+        const auto uncontacted = getClosestNodes(
+            this->options.targetId,
+            this->options.peerManager.getNearbyContacts(),
+            GetClosestNodesOptions{
+                .maxCount = this->options.parallelism +
+                    this->options.maxHedgedRequests,
+                .excludedNodeIds = this->options.contactedPeers});
+        std::optional<PeerDescriptor> node;
+        for (const auto& candidate : uncontacted) {
+            const auto candidateId =
+                Identifiers::getNodeIdFromPeerDescriptor(candidate);
+            if (this->ongoingRequests.contains(candidateId)) {
+                continue;
+            }
+            if (this->options.latencyTracker == nullptr ||
+                !this->options.latencyTracker->isUnreliable(candidateId)) {
+                node = candidate;
+                break;
+            }
+            if (!node.has_value()) {
+                node = candidate;
+            }
+        }
+        if (!node.has_value()) {
+            return std::nullopt;
+        }
+        const auto nodeId = Identifiers::getNodeIdFromPeerDescriptor(*node);
+        const auto hop = this->contactHops.contains(nodeId)
+            ? this->contactHops.at(nodeId)
+            : 1;
+        this->ongoingRequests.emplace(
+            nodeId, OngoingRequest{.startedAt = Clock::now(), .hop = hop});
+        // TS adds to contactedPeers synchronously at the start of
+        // fetchClosestNeighborsFromRemote, before the await; claiming it here
+        // (under the lock) keeps sibling workers from picking the same node.
+        this->options.contactedPeers.insert(nodeId);
+        this->stats.requestCount++;
+        this->stats.hopCount = std::max(this->stats.hopCount, hop);
+        return node;
+    }
+
+    folly::coro::Task<void> query(PeerDescriptor node) {
+        const auto nodeId = Identifiers::getNodeIdFromPeerDescriptor(node);
+        try {
+            const auto contacts =
+                co_await this->fetchClosestNeighborsFromRemote(node);
+            this->onRequestSucceeded(nodeId, contacts);
+        } catch (const folly::OperationCancelled&) {
+            // The session finished (or was stopped) while waiting: the
+            // contact did nothing wrong.
+            std::scoped_lock lock(this->mutex);
+            this->ongoingRequests.erase(nodeId);
+        } catch (const std::exception& e) {
+            SLogger::trace("getClosestPeers failed: " + std::string(e.what()));
+            this->onRequestFailed(nodeId);
+        }
+    }
+
     // One worker of the rolling fan-out: repeatedly claim the closest
     // uncontacted node and query it, until the session is done.
     folly::coro::Task<void> worker() {
@@ -184,61 +375,109 @@ private:
             std::optional<PeerDescriptor> node;
             {
                 std::scoped_lock lock(this->mutex);
-                if (this->options.abortSignal.aborted || this->done) {
+                if (this->shouldStop()) {
                     co_return;
                 }
-                if (this->noProgressCounter >= this->options.noProgressLimit) {
-                    this->done = true;
+                node = this->claimNextNode();
+                if (!node.has_value()) {
+                    if (this->ongoingRequests.empty()) {
+                        this->finish();
+                    }
                     co_return;
                 }
-                const auto uncontacted = getClosestNodes(
-                    this->options.targetId,
-                    this->options.peerManager.getNearbyContacts(),
-                    GetClosestNodesOptions{
-                        .maxCount = this->options.parallelism,
-                        .excludedNodeIds = this->options.contactedPeers});
-                for (const auto& candidate : uncontacted) {
-                    const auto candidateId =
-                        Identifiers::getNodeIdFromPeerDescriptor(candidate);
-                    if (!this->ongoingRequests.contains(candidateId)) {
-                        node = candidate;
-                        break;
+            }
+            co_await this->query(std::move(*node));
+        }
+    }
+
+    // Sends the extra requests: queries the next candidate whenever the
+    // oldest unhedged request in flight outlasts the hedge delay, and
+    // carries on the walk if nothing is in flight, until the session is done.
+    folly::coro::Task<void> hedger() {
+        while (true) {
+            std::optional<PeerDescriptor> node;
+            auto wait = this->options.latencyTracker->getHedgeDelay();
+            {
+                std::scoped_lock lock(this->mutex);
+                if (this->shouldStop()) {
+                    co_return;
+                }
+                const auto now = Clock::now();
+                OngoingRequest* oldest = nullptr;
+                for (auto& item : this->ongoingRequests) {
+                    auto& request = item.second;
+                    if (!request.hedged &&
+                        (oldest == nullptr ||
+                         request.startedAt < oldest->startedAt)) {
+                        oldest = &request;
                     }
                 }
-                if (!node.has_value()) {
-                    if (this->ongoingRequests.empty()) {
-                        this->done = true;
+                if (this->ongoingRequests.empty()) {
+                    node = this->claimNextNode();
+                    if (!node.has_value()) {
+                        this->finish();
+                        co_return;
                     }
-                    co_return;
+                } else if (
+                    oldest != nullptr && oldest->startedAt + wait <= now) {
+                    node = this->claimNextNode();
+                    if (node.has_value()) {
+                        oldest->hedged = true;
+                        this->stats.hedgedRequestCount++;
+                    }
+                } else if (oldest != nullptr) {
+                    wait = std::chrono::ceil<std::chrono::milliseconds>(
+                        oldest->startedAt + wait - now);
                 }
-                const auto nodeId =
-                    Identifiers::getNodeIdFromPeerDescriptor(*node);
-                this->ongoingRequests.insert(nodeId);
-                // TS adds to contactedPeers synchronously at the start of
-                // fetchClosestNeighborsFromRemote, before the await; claiming
-                // it here (under the lock) keeps sibling workers from picking
-                // the same node.
-                this->options.contactedPeers.insert(nodeId);
             }
-            const auto nodeId = Identifiers::getNodeIdFromPeerDescriptor(*node);
+            if (node.has_value()) {
+                co_await this->query(std::move(*node));
+                continue;
+            }
             try {
-                const auto contacts =
-                    co_await this->fetchClosestNeighborsFromRemote(*node);
-                this->onRequestSucceeded(nodeId, contacts);
-            } catch (const std::exception& e) {
-                SLogger::trace(
-                    "getClosestPeers failed: " + std::string(e.what()));
-                this->onRequestFailed(nodeId);
+                co_await streamr::utils::co_withCancellation(
+                    streamr::utils::cancellationTokenMerge(
+                        co_await streamr::utils::co_currentCancellationToken(),
+                        this->finished.getToken()),
+                    folly::coro::sleep(wait));
+            } catch (const folly::OperationCancelled&) {
+                co_return;
             }
         }
     }
 
+    void onEnded() {
+        {
+            std::scoped_lock lock(this->mutex);
+            this->endedAt = Clock::now();
+        }
+        const auto result = this->getStats();
+        SLogger::debug(
+            "Discovery session " + this->id + " ended after " +
+            std::to_string(result.duration.count()) + " ms, " +
+            std::to_string(result.hopCount) + " hops, " +
+            std::to_string(result.requestCount) + " requests (" +
+            std::to_string(result.hedgedRequestCount) + " hedged, " +
+            std::to_string(result.failedRequestCount) + " failed)");
+    }
+
 public:
     explicit DiscoverySession(DiscoverySessionOptions options)
         : options(std::move(options)) {}
 
     [[nodiscard]] const std::string& getId() const { return this->id; }
 
+    [[nodiscard]] DiscoverySessionStats getStats() {
+        std::scoped_lock lock(this->mutex);
+        auto result = this->stats;
+        if (this->stats.requestCount > 0) {
+            result.duration =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    this->endedAt.value_or(Clock::now()) - this->startedAt);
+        }
+        return result;
+    }
+
     folly::coro::Task<void> findClosestNodes(
         std::chrono::milliseconds timeout) {
         {
@@ -247,23 +486,36 @@ public:
                     this->options.contactedPeers) == 0) {
                 co_return;
             }
+            this->startedAt = Clock::now();
         }
+        const size_t hedgerCount = this->options.latencyTracker != nullptr
+            ? this->options.maxHedgedRequests
+            : 0;
         std::vector<folly::coro::Task<void>> workers;
-        workers.reserve(this->options.parallelism);
+        workers.reserve(this->options.parallelism + hedgerCount);
         for (size_t i = 0; i < this->options.parallelism; ++i) {
             workers.push_back(this->worker());
         }
+        for (size_t i = 0; i < hedgerCount; ++i) {
+            workers.push_back(this->hedger());
+        }
         // MERGE the caller's (ambient) cancellation token with the node's
         // abort signal instead of replacing it: a stop()-time cancellation
         // of the detached join must reach the workers' RPC awaits, or the
         // scope drain waits a full session timeout for them (the full-node
         // teardown hang).
-        co_await streamr::utils::co_withCancellation(
-            streamr::utils::cancellationTokenMerge(
-                co_await streamr::utils::co_currentCancellationToken(),
-                this->options.abortSignal.getCancellationToken()),
-            folly::coro::timeout(
-                folly::coro::collectAllRange(std::move(workers)), timeout));
+        try {
+            co_await streamr::utils::co_withCancellation(
+                streamr::utils::cancellationTokenMerge(
+                    co_await streamr::utils::co_currentCancellationToken(),
+                    this->options.abortSignal.getCancellationToken()),
+                folly::coro::timeout(
+                    folly::coro::collectAllRange(std::move(workers)), timeout));
+        } catch (const std::exception&) {
+            this->onEnded();
+            throw;
+        }
+        this->onEnded();
     }
 };
 
@@ -0,0 +1,155 @@
+// Module streamr.dht.LookupLatencyTracker
+// Native-only (no TS counterpart): the getClosestPeers round trips and
+// failures of recent lookups, shared by the DiscoverySessions of a node.
+//
+// Each contact keeps a moving average of its failure rate, so a lookup can
+// pass over contacts that keep failing; the least recently used contacts
+// are forgotten beyond maxTrackedContacts. The last sampleCount round
+// trips of all contacts give the hedge delay: the
+// p95 round trip, after which a DiscoverySession stops waiting for a slow
+// request alone and queries another contact next to it.
+module;
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+export module streamr.dht.LookupLatencyTracker;
+
+import streamr.dht.Identifiers;
+
+export namespace streamr::dht::discovery {
+
+using streamr::dht::DhtAddress;
+
+struct LookupLatencyTrackerOptions {
+    // Recent round trips the hedge delay is computed from.
+    size_t sampleCount = 256;
+    // The hedge delay until minSampleCount round trips have been seen.
+    std::chrono::milliseconds defaultHedgeDelay{1000};
+    size_t minSampleCount = 16;
+    std::chrono::milliseconds minHedgeDelay{20};
+    std::chrono::milliseconds maxHedgeDelay{5000};
+    // Contacts whose failures are remembered (at least one is kept).
+    size_t maxTrackedContacts = 1024;
+};
+
+class LookupLatencyTracker {
+private:
+    // Weight of the newest observation in the moving averages.
+    static constexpr double smoothing = 0.25;
+    static constexpr uint32_t minAttemptsForFailureRate = 3;
+    static constexpr double unreliableFailureRate = 0.5;
+    static constexpr double hedgePercentile = 0.95;
+
+    struct ContactStats {
+        DhtAddress nodeId;
+        double failureRate = 0;
+        uint32_t attempts = 0;
+    };
+
+    LookupLatencyTrackerOptions options;
+    std::mutex mutex;
+    std::vector<std::chrono::milliseconds> samples;
+    size_t nextSample = 0;
+    std::list<ContactStats> contacts; // front = most recently used
+    std::map<DhtAddress, std::list<ContactStats>::iterator> index;
+
+    // Moves the contact to the front, evicting the least recently used one
+    // before a new contact is added, so the returned stats stay valid.
+    ContactStats& touch(const DhtAddress& nodeId) {
+        const auto it = this->index.find(nodeId);
+        if (it != this->index.end()) {
+            this->contacts.splice(
+                this->contacts.begin(), this->contacts, it->second);
+        } else {
+            if (!this->contacts.empty() &&
+                this->contacts.size() >= this->options.maxTrackedContacts) {
+                this->index.erase(this->contacts.back().nodeId);
+                this->contacts.pop_back();
+            }
+            this->contacts.push_front(ContactStats{.nodeId = nodeId});
+            this->index.emplace(nodeId, this->contacts.begin());
+        }
+        auto& stats = this->contacts.front();
+        stats.attempts++;
+        return stats;
+    }
+
+    [[nodiscard]] const ContactStats* find(const DhtAddress& nodeId) const {
+        const auto it = this->index.find(nodeId);
+        return it == this->index.end() ? nullptr : &*it->second;
+    }
+
+public:
+    explicit LookupLatencyTracker(LookupLatencyTrackerOptions options = {})
+        : options(options) {
+        this->samples.reserve(this->options.sampleCount);
+    }
+
+    void recordSuccess(
+        const DhtAddress& nodeId, std::chrono::milliseconds rtt) {
+        std::scoped_lock lock(this->mutex);
+        if (this->options.sampleCount > 0) {
+            if (this->samples.size() < this->options.sampleCount) {
+                this->samples.push_back(rtt);
+            } else {
+                this->samples[this->nextSample] = rtt;
+            }
+            this->nextSample =
+                (this->nextSample + 1) % this->options.sampleCount;
+        }
+        this->touch(nodeId).failureRate *= 1 - smoothing;
+    }
+
+    void recordFailure(const DhtAddress& nodeId) {
+        std::scoped_lock lock(this->mutex);
+        auto& stats = this->touch(nodeId);
+        stats.failureRate = ((1 - smoothing) * stats.failureRate) + smoothing;
+    }
+
+    // The p95 of the recent round trips, within the configured bounds.
+    [[nodiscard]] std::chrono::milliseconds getHedgeDelay() {
+        std::vector<std::chrono::milliseconds> sorted;
+        {
+            std::scoped_lock lock(this->mutex);
+            if (this->samples.size() < this->options.minSampleCount ||
+                this->samples.empty()) {
+                return this->options.defaultHedgeDelay;
+            }
+            sorted = this->samples;
+        }
+        const auto percentileIndex = std::min(
+            sorted.size() - 1,
+            static_cast<size_t>(
+                hedgePercentile * static_cast<double>(sorted.size())));
+        std::ranges::nth_element(sorted, sorted.begin() + percentileIndex);
+        return std::clamp(
+            sorted[percentileIndex],
+            this->options.minHedgeDelay,
+            this->options.maxHedgeDelay);
+    }
+
+    // The moving average of the contact's failures, between 0 and 1.
+    [[nodiscard]] double getFailureRate(const DhtAddress& nodeId) {
+        std::scoped_lock lock(this->mutex);
+        const auto* stats = this->find(nodeId);
+        return stats == nullptr ? 0 : stats->failureRate;
+    }
+
+    // Whether most of the contact's recent requests have failed.
+    [[nodiscard]] bool isUnreliable(const DhtAddress& nodeId) {
+        std::scoped_lock lock(this->mutex);
+        const auto* stats = this->find(nodeId);
+        return stats != nullptr &&
+            stats->attempts >= minAttemptsForFailureRate &&
+            stats->failureRate >= unreliableFailureRate;
+    }
+};
+
+} // namespace streamr::dht::discovery
@@ -18,6 +18,10 @@
 // driven; running the fan-out on a multi-threaded executor would need the
 // shared sets synchronised. This is exercised by the phase A8 integration
 // tests (DhtJoinPeerDiscovery, MultipleEntryPointJoining).
+//
+// Native addition: the sessions share one LookupLatencyTracker, so the
+// round trips and failures seen by earlier joins steer the hedging and the
+// contact choice of later ones (see DiscoverySession).
 module;
 
 #include <chrono>
@@ -52,6 +56,7 @@ import streamr.dht.DhtNodeRpcRemote;
 import streamr.dht.DiscoverySession;
 import streamr.dht.getClosestNodes;
 import streamr.dht.Identifiers;
+import streamr.dht.LookupLatencyTracker;
 import streamr.dht.PeerManager;
 import streamr.dht.RingDiscoverySession;
 import streamr.dht.ringIdentifiers;
@@ -103,6 +108,9 @@ struct PeerDiscoveryOptions {
     AbortSignal& abortSignal;
     std::function<std::shared_ptr<DhtNodeRpcRemote>(const PeerDescriptor&)>
         createDhtNodeRpcRemote;
+    // See DiscoverySessionOptions::maxHedgedRequests / closestSetSize.
+    size_t maxHedgedRequests = 0;
+    size_t stableClosestCount = 0;
 };
 
 // The distant-join arm of joinDht (TS models it as a discriminated union).
@@ -133,6 +141,8 @@ private:
     // (sharedFromThis) and bail on the abort signal, exactly as before.
     streamr::utils::SharedSerialExecutor recoveryExecutor{
         streamr::utils::SharedExecutors::worker()};
+    std::shared_ptr<LookupLatencyTracker> latencyTracker =
+        std::make_shared<LookupLatencyTracker>();
     PeerDiscoveryOptions options;
 
     explicit PeerDiscovery(PeerDiscoveryOptions options)
@@ -156,7 +166,10 @@ private:
             .peerManager = this->options.peerManager,
             .contactedPeers = contactedPeers,
             .abortSignal = this->options.abortSignal,
-            .createDhtNodeRpcRemote = this->options.createDhtNodeRpcRemote});
+            .createDhtNodeRpcRemote = this->options.createDhtNodeRpcRemote,
+            .latencyTracker = this->latencyTracker,
+            .maxHedgedRequests = this->options.maxHedgedRequests,
+            .closestSetSize = this->options.stableClosestCount});
     }
 
     [[nodiscard]] std::shared_ptr<RingDiscoverySession> createRingSession(
@@ -479,6 +492,10 @@ public:
         std::scoped_lock lock(this->mutex);
         return this->joinCalled;
     }
+
+    [[nodiscard]] LookupLatencyTracker& getLatencyTracker() {
+        return *this->latencyTracker;
+    }
 };
 
 } // namespace streamr::dht::discovery
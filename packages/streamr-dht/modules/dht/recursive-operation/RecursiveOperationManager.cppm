@@ -42,6 +42,7 @@ import streamr.protorpc.RpcCommunicator;
 import streamr.dht.DhtCallContext;
 import streamr.dht.DhtNodeRpcRemote;
 import streamr.dht.DhtRpcClient;
+import streamr.dht.getClosestNodes;
 import streamr.dht.getPeerDistance;
 import streamr.dht.Identifiers;
 import streamr.dht.ListeningRpcCommunicator;
@@ -51,7 +52,6 @@ import streamr.dht.RecursiveOperationSession;
 import streamr.dht.RecursiveOperationSessionRpcRemote;
 import streamr.dht.RouterRpcLocal;
 import streamr.dht.RoutingSession;
-import streamr.dht.SortedContactList;
 import streamr.dht.Transport;
 import streamr.dht.ConnectionsView;
 
@@ -74,8 +74,8 @@ using streamr::dht::DhtNodeRpcRemote;
 using streamr::dht::Identifiers;
 using streamr::dht::ServiceID;
 using streamr::dht::connection::ConnectionsView;
-using streamr::dht::contact::SortedContactList;
-using streamr::dht::contact::SortedContactListOptions;
+using streamr::dht::contact::getClosestNodes;
+using streamr::dht::contact::GetClosestNodesOptions;
 using streamr::dht::helpers::getPeerDistance;
 using streamr::dht::routing::createRouteMessageAck;
 using streamr::dht::routing::RoutingMode;
@@ -99,8 +99,9 @@ struct RecursiveOperationManagerOptions {
     std::function<void(const PeerDescriptor&)> addContact;
     std::function<std::shared_ptr<DhtNodeRpcRemote>(const PeerDescriptor&)>
         createDhtNodeRpcRemote;
-    // The Router operations (see the module comment).
-    std::function<RouteMessageAck(
+    // The Router operations (see the module comment). doRouteMessage
+    // completes with the ack once the routing executor has sent the hop.
+    std::function<folly::coro::Task<RouteMessageAck>(
         const RouteMessageWrapper&, RoutingMode, std::optional<DhtAddress>)>
         doRouteMessage;
     std::function<bool(const std::string&)> isMostLikelyDuplicate;
@@ -186,51 +187,44 @@ private:
                     }});
         std::weak_ptr<RecursiveOperationManager> weakSelf =
             this->sharedFromThis<RecursiveOperationManager>();
-        this->options.rpcCommunicator
-            .template registerRpcMethod<RouteMessageWrapper, RouteMessageAck>(
-                "routeRequest",
-                [weakSelf](
-                    const RouteMessageWrapper& routedMessage,
-                    const DhtCallContext& callContext) -> RouteMessageAck {
-                    auto self = weakSelf.lock();
-                    if (!self || self->stopped) {
-                        return createRouteMessageAck(
-                            routedMessage, RouteMessageError::STOPPED);
-                    }
-                    return self->rpcLocal->routeRequest(
-                        routedMessage, callContext);
-                });
+        // An async handler: forwarding awaits the Router, so the delivery
+        // coroutine suspends instead of blocking a worker. `self` keeps the
+        // manager alive across the suspension.
+        this->options.rpcCommunicator.template registerRpcMethodAsync<
+            RouteMessageWrapper,
+            RouteMessageAck>(
+            "routeRequest",
+            [weakSelf](
+                const RouteMessageWrapper& routedMessage,
+                const DhtCallContext& callContext)
+                -> folly::coro::Task<RouteMessageAck> {
+                auto self = weakSelf.lock();
+                if (!self || self->stopped) {
+                    co_return createRouteMessageAck(
+                        routedMessage, RouteMessageError::STOPPED);
+                }
+                co_return co_await self->rpcLocal->routeRequest(
+                    routedMessage, callContext);
+            });
     }
 
     [[nodiscard]] std::vector<PeerDescriptor> getClosestConnectedNodes(
         const DhtAddress& referenceId, size_t limit) {
-        std::vector<std::shared_ptr<DhtNodeRpcRemote>> connectedNodes;
-        for (const auto& connection :
-             this->options.connectionsView.getConnections()) {
-            connectedNodes.push_back(
-                this->options.createDhtNodeRpcRemote(connection));
-        }
-        SortedContactList<DhtNodeRpcRemote> sorted(
-            SortedContactListOptions{
-                .referenceId = referenceId,
-                .allowToContainReferenceId = true,
-                .maxSize = limit});
-        sorted.addContacts(connectedNodes);
-        std::vector<PeerDescriptor> result;
-        for (const auto& peer :
-             sorted.getClosestContacts(static_cast<int>(limit))) {
-            result.push_back(peer->getPeerDescriptor());
-        }
-        return result;
+        // TS wraps each connection in a DhtNodeRpcRemote to sort them; only
+        // the descriptors are needed.
+        return getClosestNodes(
+            referenceId,
+            this->options.connectionsView.getConnections(),
+            GetClosestNodesOptions{.maxCount = limit});
     }
 
     [[nodiscard]] bool isPeerCloserToIdThanSelf(
         const PeerDescriptor& peer, const DhtAddress& nodeIdOrDataKey) {
         const DhtAddressRaw raw =
             Identifiers::getRawFromDhtAddress(nodeIdOrDataKey);
-        const double distance1 =
+        const auto distance1 =
             getPeerDistance(DhtAddressRaw{peer.nodeid()}, raw);
-        const double distance2 = getPeerDistance(
+        const auto distance2 = getPeerDistance(
             DhtAddressRaw{this->options.localPeerDescriptor.nodeid()}, raw);
         return distance1 < distance2;
     }
@@ -358,49 +352,58 @@ private:
         }
     }
 
-    RouteMessageAck doRouteRequest(
-        const RouteMessageWrapper& routedMessage,
+    // The manager's state is read under this->mutex, but the lock is
+    // released while the Router routes the hop: the routing executor may
+    // be busy, and waiting for it under the lock would stall every other
+    // recursive operation on this node.
+    folly::coro::Task<RouteMessageAck> doRouteRequest(
+        RouteMessageWrapper routedMessage,
         std::optional<DhtAddress> excludedPeer) {
-        std::scoped_lock lock(this->mutex);
-        if (this->stopped) {
-            return createRouteMessageAck(
-                routedMessage, RouteMessageError::STOPPED);
-        }
-        if (!routedMessage.message().has_recursiveoperationrequest()) {
-            throw std::runtime_error(
-                "routeRequest payload is not a RecursiveOperationRequest");
-        }
         const DhtAddress targetId = Identifiers::getDhtAddressFromRaw(
             DhtAddressRaw{routedMessage.target()});
-        const RecursiveOperationRequest& request =
-            routedMessage.message().recursiveoperationrequest();
-        const auto closestConnectedNodes = this->getClosestConnectedNodes(
-            targetId, closestConnectedNodesCount);
-        std::vector<DataEntry> dataEntries;
-        if (request.operation() == RecursiveOperation::FETCH_DATA) {
-            dataEntries = this->options.localDataStore.values(targetId);
-        }
-        if (request.operation() == RecursiveOperation::DELETE_DATA) {
-            this->options.localDataStore.markAsDeleted(
-                targetId,
-                Identifiers::getNodeIdFromPeerDescriptor(
-                    routedMessage.sourcepeer()));
-        }
         const std::vector<PeerDescriptor> routingPath(
             routedMessage.routingpath().begin(),
             routedMessage.routingpath().end());
-        if (this->options.localPeerDescriptor.nodeid() ==
-            routedMessage.target()) {
-            this->sendResponse(
-                routingPath,
-                routedMessage.sourcepeer(),
-                ServiceID{request.sessionid()},
-                closestConnectedNodes,
-                dataEntries,
-                true);
-            return createRouteMessageAck(routedMessage);
+        std::string sessionId;
+        std::vector<PeerDescriptor> closestConnectedNodes;
+        std::vector<DataEntry> dataEntries;
+        {
+            std::scoped_lock lock(this->mutex);
+            if (this->stopped) {
+                co_return createRouteMessageAck(
+                    routedMessage, RouteMessageError::STOPPED);
+            }
+            if (!routedMessage.message().has_recursiveoperationrequest()) {
+                throw std::runtime_error(
+                    "routeRequest payload is not a RecursiveOperationRequest");
+            }
+            const RecursiveOperationRequest& request =
+                routedMessage.message().recursiveoperationrequest();
+            sessionId = request.sessionid();
+            closestConnectedNodes = this->getClosestConnectedNodes(
+                targetId, closestConnectedNodesCount);
+            if (request.operation() == RecursiveOperation::FETCH_DATA) {
+                dataEntries = this->options.localDataStore.values(targetId);
+            }
+            if (request.operation() == RecursiveOperation::DELETE_DATA) {
+                this->options.localDataStore.markAsDeleted(
+                    targetId,
+                    Identifiers::getNodeIdFromPeerDescriptor(
+                        routedMessage.sourcepeer()));
+            }
+            if (this->options.localPeerDescriptor.nodeid() ==
+                routedMessage.target()) {
+                this->sendResponse(
+                    routingPath,
+                    routedMessage.sourcepeer(),
+                    ServiceID{sessionId},
+                    closestConnectedNodes,
+                    dataEntries,
+                    true);
+                co_return createRouteMessageAck(routedMessage);
+            }
         }
-        const RouteMessageAck ack = this->options.doRouteMessage(
+        const RouteMessageAck ack = co_await this->options.doRouteMessage(
             routedMessage, RoutingMode::RECURSIVE, excludedPeer);
         if (!ack.has_error() || ack.error() == RouteMessageError::NO_TARGETS) {
             const bool noCloserContactsFound =
@@ -410,15 +413,19 @@ private:
                  getPreviousPeer(routedMessage).has_value() &&
                  !this->isPeerCloserToIdThanSelf(
                      closestConnectedNodes[0], targetId));
+            std::scoped_lock lock(this->mutex);
+            if (this->stopped) {
+                co_return ack;
+            }
             this->sendResponse(
                 routingPath,
                 routedMessage.sourcepeer(),
-                ServiceID{request.sessionid()},
+                ServiceID{sessionId},
                 closestConnectedNodes,
                 dataEntries,
                 noCloserContactsFound);
         }
-        return ack;
+        co_return ack;
     }
 
 public:
@@ -490,7 +497,7 @@ public:
             this->ongoingSessions.emplace(session->getId(), session);
         }
         if (waitForCompletion) {
-            session->start(this->options.serviceId);
+            co_await session->start(this->options.serviceId);
             if (!session->isCompletionEmitted()) {
                 try {
                     co_await streamr::utils::waitForEvent<
@@ -501,7 +508,7 @@ public:
                 }
             }
         } else {
-            session->start(this->options.serviceId);
+            co_await session->start(this->options.serviceId);
             // Give the router time to send the delete out.
             co_await folly::coro::sleep(deleteWaitTime);
         }
@@ -4,17 +4,24 @@
 // RecursiveOperationRpc service: routeRequest forwards a recursive
 // operation onward (dropping duplicates), delegating the actual routing to
 // the manager's doRouteRequest.
+//
+// The handler is a coroutine, not an implementation of the generated
+// (synchronous) RecursiveOperationRpc interface: forwarding awaits the
+// Router's routing executor, so it must SUSPEND rather than block — the
+// manager registers it with registerRpcMethodAsync.
 module;
 
 #include <functional>
 #include <string>
 
+#include <coroutine> // IWYU pragma: keep
+
 export module streamr.dht.RecursiveOperationRpcLocal;
 
 import streamr.dht.protos;
 
+import streamr.utils.CoroutineHelper;
 import streamr.logger.SLogger;
-import streamr.dht.DhtRpcServer;
 import streamr.dht.DhtCallContext;
 import streamr.dht.Identifiers;
 import streamr.dht.RouterRpcLocal;
@@ -35,16 +42,16 @@ using streamr::dht::routing::createRouteMessageAck;
 using streamr::dht::routing::getPreviousPeer;
 using streamr::dht::rpcprotocol::DhtCallContext;
 
-using RecursiveOperationRpc = ::dht::RecursiveOperationRpc<DhtCallContext>;
-
 struct RecursiveOperationRpcLocalOptions {
-    std::function<RouteMessageAck(const RouteMessageWrapper&)> doRouteRequest;
+    std::function<folly::coro::Task<RouteMessageAck>(
+        const RouteMessageWrapper&)>
+        doRouteRequest;
     std::function<void(const PeerDescriptor&, bool)> addContact;
     std::function<bool(const std::string&)> isMostLikelyDuplicate;
     std::function<void(const std::string&)> addToDuplicateDetector;
 };
 
-class RecursiveOperationRpcLocal : public RecursiveOperationRpc {
+class RecursiveOperationRpcLocal {
 private:
     RecursiveOperationRpcLocalOptions options;
 
@@ -53,13 +60,10 @@ public:
         RecursiveOperationRpcLocalOptions options)
         : options(std::move(options)) {}
 
-    ~RecursiveOperationRpcLocal() override = default;
-
-    RouteMessageAck routeRequest(
-        const RouteMessageWrapper& routedMessage,
-        const DhtCallContext& /*callContext*/) override {
+    folly::coro::Task<RouteMessageAck> routeRequest(
+        RouteMessageWrapper routedMessage, DhtCallContext /*callContext*/) {
         if (this->options.isMostLikelyDuplicate(routedMessage.requestid())) {
-            return createRouteMessageAck(
+            co_return createRouteMessageAck(
                 routedMessage, RouteMessageError::DUPLICATE);
         }
         const auto previousPeer = getPreviousPeer(routedMessage);
@@ -69,7 +73,7 @@ public:
                                          : routedMessage.sourcepeer());
         SLogger::trace("Received routeRequest call from " + remoteNodeId);
         this->options.addToDuplicateDetector(routedMessage.requestid());
-        return this->options.doRouteRequest(routedMessage);
+        co_return co_await this->options.doRouteRequest(routedMessage);
     }
 };
 
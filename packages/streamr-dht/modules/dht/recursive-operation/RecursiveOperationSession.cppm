@@ -8,9 +8,11 @@
 //
 // RecursiveOperationResult is defined here (TS keeps it in
 // RecursiveOperationManager) to break the Session <-> Manager import cycle
-// that C++ modules cannot express.
+// that C++ modules cannot express. Native addition: the result also carries
+// the operation's hop count and duration.
 module;
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <functional>
@@ -23,6 +25,8 @@ module;
 #include <utility>
 #include <vector>
 
+#include <coroutine> // IWYU pragma: keep
+
 export module streamr.dht.RecursiveOperationSession;
 
 import streamr.dht.protos;
@@ -30,6 +34,7 @@ import streamr.dht.protos;
 import streamr.eventemitter.EventEmitter;
 import streamr.utils.AbortController;
 import streamr.utils.AbortableTimers;
+import streamr.utils.CoroutineHelper;
 import streamr.utils.EnableSharedFromThis;
 import streamr.utils.Uuid;
 import streamr.logger.SLogger;
@@ -73,6 +78,10 @@ using streamr::protorpc::RpcCommunicatorOptions;
 struct RecursiveOperationResult {
     std::vector<PeerDescriptor> closestNodes;
     std::vector<DataEntry> dataEntries;
+    // The longest routing path a report came back over, in remote nodes.
+    size_t hopCount = 0;
+    // From start() to completion (or to the read, if still running).
+    std::chrono::milliseconds duration{0};
 };
 
 namespace recursiveoperationsessionevents {
@@ -90,13 +99,17 @@ struct RecursiveOperationSessionOptions {
     PeerDescriptor localPeerDescriptor;
     size_t waitedRoutingPathCompletions;
     RecursiveOperation operation;
-    std::function<RouteMessageAck(const RouteMessageWrapper&)> doRouteRequest;
+    std::function<folly::coro::Task<RouteMessageAck>(
+        const RouteMessageWrapper&)>
+        doRouteRequest;
 };
 
 class RecursiveOperationSession
     : public EventEmitter<RecursiveOperationSessionEvents>,
       public EnableSharedFromThis {
 private:
+    using Clock = std::chrono::steady_clock;
+
     static constexpr int resultsMaxSize = 10;
     static constexpr std::chrono::milliseconds noCloserNodesTimeout{4000};
 
@@ -113,6 +126,9 @@ private:
     bool completionEventEmitted = false;
     bool timeoutScheduled = false;
     int noCloserNodesReceivedCounter = 0;
+    size_t hopCount = 0;
+    Clock::time_point startedAt = Clock::now();
+    std::optional<Clock::time_point> completedAt;
 
     explicit RecursiveOperationSession(RecursiveOperationSessionOptions options)
         : options(std::move(options)),
@@ -188,18 +204,22 @@ private:
     void addKnownHops(const std::vector<PeerDescriptor>& routingPath) {
         const DhtAddress localNodeId = Identifiers::getNodeIdFromPeerDescriptor(
             this->options.localPeerDescriptor);
+        size_t remoteHops = 0;
         for (const auto& descriptor : routingPath) {
             const DhtAddress newNodeId =
                 Identifiers::getNodeIdFromPeerDescriptor(descriptor);
             if (localNodeId != newNodeId) {
                 this->allKnownHops.insert(newNodeId);
+                remoteHops++;
             }
         }
+        this->hopCount = std::max(this->hopCount, remoteHops);
     }
 
     void emitCompleted() {
         this->abortController.abort();
         this->completionEventEmitted = true;
+        this->completedAt = Clock::now();
         this->emit<recursiveoperationsessionevents::Completed>();
     }
 
@@ -290,10 +310,15 @@ public:
 
     ~RecursiveOperationSession() override = default;
 
-    void start(const ServiceID& serviceId) {
-        std::scoped_lock lock(this->mutex);
-        const auto routeMessage = this->wrapRequest(serviceId);
-        this->options.doRouteRequest(routeMessage);
+    // Sends the request out; completes once the first hop has acked it.
+    folly::coro::Task<void> start(ServiceID serviceId) {
+        RouteMessageWrapper routeMessage;
+        {
+            std::scoped_lock lock(this->mutex);
+            this->startedAt = Clock::now();
+            routeMessage = this->wrapRequest(serviceId);
+        }
+        co_await this->options.doRouteRequest(routeMessage);
     }
 
     void onResponseReceived(
@@ -326,13 +351,17 @@ public:
         for (const auto& [creator, entry] : this->foundData) {
             result.dataEntries.push_back(entry);
         }
+        result.hopCount = this->hopCount;
+        result.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            this->completedAt.value_or(Clock::now()) - this->startedAt);
         return result;
     }
 
     [[nodiscard]] const std::string& getId() const { return this->id; }
 
-    // Lets the manager skip waiting when start() completed synchronously
-    // (e.g. this node is the target), avoiding a missed 'completed' event.
+    // Lets the manager skip waiting when the session completed during
+    // start() (e.g. this node is the target), avoiding a missed 'completed'
+    // event.
     [[nodiscard]] bool isCompletionEmitted() {
         std::scoped_lock lock(this->mutex);
         return this->completionEventEmitted;
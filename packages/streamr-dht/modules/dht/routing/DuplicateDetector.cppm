@@ -2,54 +2,234 @@
 // CONSOLIDATED from the former header
 // streamr-dht/dht/routing/DuplicateDetector.hpp (MODERNIZATION.md Phase 2.6):
 // this file is now the source of truth.
+//
+// Adaptations: values are remembered as 128-bit digests, not strings. In
+// the default Exact mode the last maxItemCount digests sit in a ring
+// buffer next to a hashed count of each, so add() is O(1) once full. The
+// Probabilistic mode instead keeps two rotating bloom filters sized for
+// the configured false-positive rate: it can cover a far larger window in
+// a fixed amount of memory, at the cost of an occasional false "likely
+// duplicate" (which the method name already allows for).
 module;
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <numbers>
 #include <string>
-#include <unordered_set>
+#include <string_view>
+#include <utility>
 #include <vector>
+#include <folly/container/F14Map.h>
+#include <folly/hash/SpookyHashV2.h>
 
 export module streamr.dht.DuplicateDetector;
 export namespace streamr::dht::routing {
 
+enum class DuplicateDetectorMode : uint8_t { Exact, Probabilistic };
+
+inline constexpr double DEFAULT_DUPLICATE_FALSE_POSITIVE_RATE = 0.0001;
+
+struct DuplicateDetectorOptions {
+    // The number of most recent values remembered. In Probabilistic mode
+    // the window is between maxItemCount / 2 and maxItemCount values.
+    size_t maxItemCount;
+    DuplicateDetectorMode mode = DuplicateDetectorMode::Exact;
+    // Probabilistic mode only.
+    double falsePositiveRate = DEFAULT_DUPLICATE_FALSE_POSITIVE_RATE;
+};
+
 class DuplicateDetector {
 private:
-    std::unordered_set<std::string> values;
-    std::recursive_mutex valuesMutex;
-    std::vector<std::string> queue;
-    std::recursive_mutex queueMutex;
-    size_t maxItemCount;
+    struct Digest {
+        uint64_t high;
+        uint64_t low;
+
+        bool operator==(const Digest&) const = default;
+    };
+
+    struct DigestHash {
+        // The digest is already uniformly distributed.
+        size_t operator()(const Digest& digest) const noexcept {
+            return static_cast<size_t>(digest.low);
+        }
+    };
+
+    // A bloom filter probed by double hashing over the digest halves.
+    class BloomFilter {
+    private:
+        std::vector<uint64_t> bits;
+        uint64_t bitCount;
+        uint32_t hashCount;
+
+    public:
+        BloomFilter(size_t capacity, double falsePositiveRate) {
+            const double ln2 = std::numbers::ln2;
+            const double optimalBits = -static_cast<double>(capacity) *
+                std::log(falsePositiveRate) / (ln2 * ln2);
+            this->bitCount = std::max<uint64_t>(
+                64, static_cast<uint64_t>(std::ceil(optimalBits)));
+            this->bits.assign((this->bitCount + 63) / 64, 0); // NOLINT
+            this->hashCount = std::max<uint32_t>(
+                1,
+                static_cast<uint32_t>(std::lround(
+                    static_cast<double>(this->bitCount) /
+                    static_cast<double>(std::max<size_t>(capacity, 1)) *
+                    ln2)));
+        }
+
+        void add(const Digest& digest) {
+            for (uint32_t i = 0; i < this->hashCount; ++i) {
+                const uint64_t bit =
+                    (digest.high + (i * digest.low)) % this->bitCount;
+                this->bits[bit / 64] |= uint64_t{1} << (bit % 64); // NOLINT
+            }
+        }
+
+        [[nodiscard]] bool contains(const Digest& digest) const {
+            for (uint32_t i = 0; i < this->hashCount; ++i) {
+                const uint64_t bit =
+                    (digest.high + (i * digest.low)) % this->bitCount;
+                const uint64_t mask = uint64_t{1} << (bit % 64); // NOLINT
+                if ((this->bits[bit / 64] & mask) == 0) { // NOLINT
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void clear() { std::ranges::fill(this->bits, 0); }
+    };
+
+    DuplicateDetectorOptions options;
+    std::mutex mutex;
+
+    // Exact mode: a FIFO ring of the last maxItemCount digests and how
+    // many times each digest occurs in it.
+    std::vector<Digest> ring;
+    size_t ringHead = 0; // the oldest entry once the ring is full
+    size_t ringSize = 0;
+    folly::F14FastMap<Digest, uint32_t, DigestHash> counts;
+
+    // Probabilistic mode: values go into `current`; when it has taken
+    // generationCapacity values it becomes `previous` and the old
+    // `previous`, cleared, takes its place.
+    std::vector<BloomFilter> generations;
+    size_t current = 0;
+    size_t generationCapacity = 0;
+    size_t currentCount = 0;
+    size_t previousCount = 0;
+
+    static Digest digestOf(std::string_view value) {
+        Digest digest{.high = 0, .low = 0};
+        folly::hash::SpookyHashV2::Hash128(
+            value.data(), value.size(), &digest.high, &digest.low);
+        return digest;
+    }
+
+    [[nodiscard]] bool isProbabilistic() const {
+        return this->options.mode == DuplicateDetectorMode::Probabilistic;
+    }
+
+    void addExact(const Digest& digest) {
+        if (this->options.maxItemCount == 0) {
+            return;
+        }
+        this->counts[digest]++;
+        if (this->ringSize < this->options.maxItemCount) {
+            this->ring[(this->ringHead + this->ringSize) %
+                       this->options.maxItemCount] = digest;
+            this->ringSize++;
+            return;
+        }
+        const Digest removed = this->ring[this->ringHead];
+        this->ring[this->ringHead] = digest;
+        this->ringHead = (this->ringHead + 1) % this->options.maxItemCount;
+        const auto it = this->counts.find(removed);
+        if (--it->second == 0) {
+            this->counts.erase(it);
+        }
+    }
+
+    void addProbabilistic(const Digest& digest) {
+        if (this->currentCount >= this->generationCapacity) {
+            this->current = 1 - this->current;
+            this->generations[this->current].clear();
+            this->previousCount = this->currentCount;
+            this->currentCount = 0;
+        }
+        this->generations[this->current].add(digest);
+        this->currentCount++;
+    }
 
 public:
     explicit DuplicateDetector(size_t maxItemCount)
-        : maxItemCount(maxItemCount) {}
+        : DuplicateDetector(
+              DuplicateDetectorOptions{.maxItemCount = maxItemCount}) {}
+
+    explicit DuplicateDetector(DuplicateDetectorOptions options)
+        : options(options) {
+        if (this->isProbabilistic()) {
+            this->generationCapacity =
+                std::max<size_t>(1, this->options.maxItemCount / 2);
+            // A lookup checks both generations, so each gets half the rate.
+            for (int i = 0; i < 2; ++i) {
+                this->generations.emplace_back(
+                    this->generationCapacity,
+                    this->options.falsePositiveRate / 2);
+            }
+        } else {
+            this->ring.resize(this->options.maxItemCount);
+            this->counts.reserve(this->options.maxItemCount);
+        }
+    }
     virtual ~DuplicateDetector() = default;
 
     void add(const std::string& value) {
-        std::scoped_lock lock(this->valuesMutex, this->queueMutex);
-        this->values.insert(value);
-        this->queue.push_back(value);
-        if (this->queue.size() > this->maxItemCount) {
-            const auto removed = this->queue.front();
-            this->values.erase(removed);
-            this->queue.erase(this->queue.begin());
+        const Digest digest = digestOf(value);
+        std::scoped_lock lock(this->mutex);
+        if (this->isProbabilistic()) {
+            this->addProbabilistic(digest);
+        } else {
+            this->addExact(digest);
         }
     }
 
     [[nodiscard]] bool isMostLikelyDuplicate(const std::string& value) {
-        std::scoped_lock lock(this->valuesMutex);
-        return this->values.contains(value);
+        const Digest digest = digestOf(value);
+        std::scoped_lock lock(this->mutex);
+        if (this->isProbabilistic()) {
+            return std::ranges::any_of(
+                this->generations,
+                [&digest](const BloomFilter& filter) {
+                    return filter.contains(digest);
+                });
+        }
+        return this->counts.contains(digest);
     }
 
+    // The number of distinct values remembered; in Probabilistic mode the
+    // number of values added to the live generations.
     [[nodiscard]] size_t size() {
-        std::scoped_lock lock(this->valuesMutex);
-        return this->values.size();
+        std::scoped_lock lock(this->mutex);
+        if (this->isProbabilistic()) {
+            return this->currentCount + this->previousCount;
+        }
+        return this->counts.size();
     }
 
     void clear() {
-        std::scoped_lock lock(this->valuesMutex, this->queueMutex);
-        this->values.clear();
-        this->queue.clear();
+        std::scoped_lock lock(this->mutex);
+        this->ringHead = 0;
+        this->ringSize = 0;
+        this->counts.clear();
+        for (auto& filter : this->generations) {
+            filter.clear();
+        }
+        this->currentCount = 0;
+        this->previousCount = 0;
     }
 };
 
@@ -8,8 +8,8 @@
 // owns a dedicated single-thread worker executor and runs ALL routing work
 // on it — the routeMessage/forwardMessage RPC handlers co_await onto the
 // worker (async, see below), the session send-completions resume on the
-// worker, and the cross-thread entry points (onNodeConnected/Disconnected,
-// resetCache, stop, the duplicate-detector accessors) dispatch onto it too.
+// worker, and the cross-thread entry points (send, onNodeConnected/
+// Disconnected, resetCache, stop) dispatch onto it too.
 // Because every access to the routing state (routing-tables cache, ongoing
 // sessions, forwarding table, duplicate detector) happens on that one
 // worker thread, the state needs no additional locks, and the heavy routing
@@ -27,12 +27,19 @@
 // and sent later. The worker is additionally given a low OS thread priority
 // (a positive nice value, best-effort per-platform) so routing yields the
 // CPU to our own work under contention.
+//
+// The other entry points do not block their caller on the worker either:
+// send() and the connection events are posted to it (the serial executor
+// runs them in posting order), doRouteMessageAsync() is awaited, and the
+// duplicate detector, which has its own lock, is used directly. Only
+// stop() still waits, so the Router is quiescent when it returns.
 module;
 
 #include <coroutine> // IWYU pragma: keep
 
 #include <chrono>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <map>
 #include <memory>
@@ -54,6 +61,7 @@ import streamr.utils.CoroutineHelper;
 import streamr.utils.SharedExecutors;
 import streamr.utils.EnableSharedFromThis;
 import streamr.utils.ExecutorHelper;
+import streamr.utils.GuardedAsyncScope;
 import streamr.utils.Uuid;
 import streamr.logger.SLogger;
 import streamr.protorpc.RpcCommunicator;
@@ -112,6 +120,9 @@ private:
     // this executor, not by a mutex.
     streamr::utils::SharedSerialExecutor routingExecutor{
         streamr::utils::SharedExecutors::background()};
+    // The jobs post() queues on the routing executor. Declared after it,
+    // so the destructor's join runs while the executor is still alive.
+    streamr::utils::GuardedAsyncScope postedJobs;
     AbortController abortController; // cancels the session-cleanup timeouts
     std::map<DhtAddress, ForwardingTableEntry> forwardingTable;
     RoutingTablesCache routingTablesCache;
@@ -123,21 +134,57 @@ private:
 
     explicit Router(RouterOptions options) : options(std::move(options)) {}
 
-    // Runs `fn` on the routing worker and blocks for its result. Callers
-    // must NOT already be on this serial executor (that would self-deadlock
-    // it); every caller here is an off-worker entry point.
+    // A task that runs `fn` on the routing worker. `fn` must keep what it
+    // uses alive (capture values, and `self` for the Router).
     template <typename Fn>
-    auto runOnWorker(Fn fn) -> decltype(fn()) {
+    auto onWorker(Fn fn) {
         using Ret = decltype(fn());
-        return streamr::utils::blockingWait(
+        return streamr::utils::co_withExecutor(
+            &this->routingExecutor,
+            folly::coro::co_invoke(
+                [fn = std::move(fn)]() mutable -> folly::coro::Task<Ret> {
+                    co_return fn();
+                }));
+    }
+
+    // Queues `fn(router)` on the routing worker without waiting for it.
+    // stop() waits for the queued jobs; a job that throws is logged and
+    // dropped. A queued job holds the Router weakly, like the RPC
+    // handlers: otherwise the job could hold the last reference, and
+    // ~Router would then close postedJobs from inside one of its own
+    // tasks and wait for itself.
+    template <typename Fn>
+    void post(Fn fn) {
+        std::weak_ptr<Router> weakSelf = this->sharedFromThis<Router>();
+        this->postedJobs.add(
             streamr::utils::co_withExecutor(
                 &this->routingExecutor,
                 folly::coro::co_invoke(
-                    [fn = std::move(fn)]() -> folly::coro::Task<Ret> {
-                        co_return fn();
+                    [weakSelf,
+                     fn = std::move(fn)]() mutable -> folly::coro::Task<void> {
+                        auto self = weakSelf.lock();
+                        if (!self) {
+                            co_return;
+                        }
+                        try {
+                            fn(*self);
+                        } catch (const std::exception& err) {
+                            SLogger::warn(
+                                "Routing job failed: " +
+                                std::string(err.what()));
+                        }
+                        co_return;
                     })));
     }
 
+    // Runs `fn` on the routing worker and blocks for its result. Callers
+    // must NOT already be on this serial executor (that would self-deadlock
+    // it); only stop() uses it.
+    template <typename Fn>
+    auto runOnWorker(Fn fn) -> decltype(fn()) {
+        return streamr::utils::blockingWait(this->onWorker(std::move(fn)));
+    }
+
     void registerLocalRpcMethods() {
         this->routerRpcLocal =
             std::make_unique<RouterRpcLocal>(RouterRpcLocalOptions{
@@ -325,8 +372,8 @@ public:
 
     ~Router() override = default;
 
-    // Runs on the routing worker (called from the RPC handlers and, via
-    // runOnWorker, from send()).
+    // Runs on the routing worker (called from the RPC handlers, from
+    // send() and from doRouteMessageAsync()).
     RouteMessageAck doRouteMessage(
         const RouteMessageWrapper& routedMessage,
         RoutingMode mode = RoutingMode::ROUTE,
@@ -370,28 +417,43 @@ public:
         return createRouteMessageAck(routedMessage);
     }
 
+    // Routes the message from any thread, without blocking the caller.
+    folly::coro::Task<RouteMessageAck> doRouteMessageAsync(
+        RouteMessageWrapper routedMessage,
+        RoutingMode mode = RoutingMode::ROUTE,
+        std::optional<DhtAddress> excludedPeer = std::nullopt) {
+        auto self = this->sharedFromThis<Router>();
+        co_return co_await this->onWorker(
+            [self,
+             routedMessage = std::move(routedMessage),
+             mode,
+             excludedPeer = std::move(excludedPeer)]() {
+                return self->doRouteMessage(routedMessage, mode, excludedPeer);
+            });
+    }
+
+    // Queued on the routing worker; returns immediately.
     void send(
         const Message& msg,
         const std::vector<PeerDescriptor>& reachableThrough) {
-        auto self = this->sharedFromThis<Router>();
         Message message = msg;
         *message.mutable_sourcedescriptor() = this->options.localPeerDescriptor;
-        this->runOnWorker([&]() -> std::monostate {
+        this->post([message = std::move(message),
+                    reachableThrough](Router& self) {
             const DhtAddress targetNodeId =
                 Identifiers::getNodeIdFromPeerDescriptor(
                     message.targetdescriptor());
-            const auto forwardingEntry =
-                this->forwardingTable.find(targetNodeId);
+            const auto forwardingEntry = self.forwardingTable.find(targetNodeId);
             RouteMessageWrapper routedMessage;
             *routedMessage.mutable_message() = message;
             routedMessage.set_requestid(Uuid::v4());
             *routedMessage.mutable_sourcepeer() =
-                this->options.localPeerDescriptor;
+                self.options.localPeerDescriptor;
             for (const auto& peer : reachableThrough) {
                 *routedMessage.add_reachablethrough() = peer;
             }
             RoutingMode mode = RoutingMode::ROUTE;
-            if (forwardingEntry != this->forwardingTable.end() &&
+            if (forwardingEntry != self.forwardingTable.end() &&
                 !forwardingEntry->second.peerDescriptors.empty()) {
                 routedMessage.set_target(
                     forwardingEntry->second.peerDescriptors[0].nodeid());
@@ -399,49 +461,41 @@ public:
             } else {
                 routedMessage.set_target(message.targetdescriptor().nodeid());
             }
-            this->doRouteMessage(routedMessage, mode, std::nullopt);
-            return std::monostate{};
+            self.doRouteMessage(routedMessage, mode, std::nullopt);
         });
     }
 
+    // The detector is thread-safe; no hop to the worker is needed.
     [[nodiscard]] bool isMostLikelyDuplicate(const std::string& requestId) {
-        return this->runOnWorker([&]() {
-            return this->duplicateRequestDetector.isMostLikelyDuplicate(
-                requestId);
-        });
+        return this->duplicateRequestDetector.isMostLikelyDuplicate(requestId);
     }
 
     void addToDuplicateDetector(const std::string& requestId) {
-        this->runOnWorker([&]() -> std::monostate {
-            this->duplicateRequestDetector.add(requestId);
-            return std::monostate{};
-        });
+        this->duplicateRequestDetector.add(requestId);
     }
 
+    // Queued on the routing worker; returns immediately.
     void onNodeConnected(const PeerDescriptor& peerDescriptor) {
-        this->runOnWorker([&]() -> std::monostate {
+        this->post([peerDescriptor](Router& self) {
             auto remote = std::make_shared<RoutingRemoteContact>(
                 peerDescriptor,
-                this->options.localPeerDescriptor,
-                this->options.rpcCommunicator);
-            this->routingTablesCache.onNodeConnected(remote);
-            return std::monostate{};
+                self.options.localPeerDescriptor,
+                self.options.rpcCommunicator);
+            self.routingTablesCache.onNodeConnected(remote);
         });
     }
 
+    // Queued on the routing worker; returns immediately.
     void onNodeDisconnected(const PeerDescriptor& peerDescriptor) {
-        this->runOnWorker([&]() -> std::monostate {
-            this->routingTablesCache.onNodeDisconnected(
-                Identifiers::getNodeIdFromPeerDescriptor(peerDescriptor));
-            return std::monostate{};
+        this->post([nodeId = Identifiers::getNodeIdFromPeerDescriptor(
+                        peerDescriptor)](Router& self) {
+            self.routingTablesCache.onNodeDisconnected(nodeId);
         });
     }
 
+    // Queued on the routing worker; returns immediately.
     void resetCache() {
-        this->runOnWorker([&]() -> std::monostate {
-            this->routingTablesCache.reset();
-            return std::monostate{};
-        });
+        this->post([](Router& self) { self.routingTablesCache.reset(); });
     }
 
     void stop() {
@@ -460,6 +514,9 @@ public:
             this->routingTablesCache.reset();
             return std::monostate{};
         });
+        // Jobs posted while stopping see `stopped` set; later ones are
+        // dropped.
+        this->postedJobs.close();
         this->abortController.abort();
     }
 };
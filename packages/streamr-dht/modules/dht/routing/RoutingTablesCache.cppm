@@ -9,10 +9,21 @@
 // keeping the hottest tables in memory and updating them on connect/
 // disconnect is a large win. TS uses the npm lru-cache (max 1000, 15 s
 // TTL); this file ports that with a small internal LRU-with-TTL.
+//
+// Adaptations: TS applies every connect/disconnect to all cached tables
+// at once. Here the cache counts connection changes in a version number
+// and logs them; each table records the version it has caught up to,
+// and get() replays only the changes that table has not seen. Tables
+// that are never fetched again cost nothing, and a change far from a
+// table's target is rejected by its distance check on replay. A table
+// too far behind for the bounded log is dropped and rebuilt by the
+// caller.
 module;
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <list>
 #include <memory>
 #include <optional>
@@ -66,21 +77,33 @@ public:
     LruCache(size_t maxSize, std::chrono::milliseconds maxAge)
         : maxSize(maxSize), maxAge(maxAge) {}
 
-    std::optional<Value> get(const std::string& key) {
+    // The cached value (valid until the next call that modifies the
+    // cache), or nullptr.
+    Value* get(const std::string& key) {
         const auto it = this->index.find(key);
         if (it == this->index.end()) {
-            return std::nullopt;
+            return nullptr;
         }
         const auto now = std::chrono::steady_clock::now();
         if (this->expired(*it->second, now)) {
             this->entries.erase(it->second);
             this->index.erase(it);
-            return std::nullopt;
+            return nullptr;
         }
         this->entries.splice(this->entries.begin(), this->entries, it->second);
-        return it->second->value;
+        return &it->second->value;
+    }
+
+    void remove(const std::string& key) {
+        const auto it = this->index.find(key);
+        if (it != this->index.end()) {
+            this->entries.erase(it->second);
+            this->index.erase(it);
+        }
     }
 
+    [[nodiscard]] size_t size() const { return this->index.size(); }
+
     [[nodiscard]] bool has(const std::string& key) {
         const auto it = this->index.find(key);
         if (it == this->index.end()) {
@@ -131,8 +154,25 @@ class RoutingTablesCache {
 private:
     static constexpr size_t defaultMaxTables = 1000;
     static constexpr std::chrono::milliseconds defaultMaxAge{15000};
+    static constexpr size_t maxLoggedChanges = 1024;
 
-    detail::LruCache<RoutingTable> tables{defaultMaxTables, defaultMaxAge};
+    struct CachedTable {
+        RoutingTable table;
+        // Changes below this version are applied to the table.
+        uint64_t version;
+    };
+
+    // A connect (remote set) or a disconnect (remote null) of nodeId.
+    struct ConnectionChange {
+        DhtAddress nodeId;
+        std::shared_ptr<RoutingRemoteContact> remote;
+    };
+
+    detail::LruCache<CachedTable> tables{defaultMaxTables, defaultMaxAge};
+    // The number of connection changes seen so far.
+    uint64_t version = 0;
+    // The most recent changes; the last one has version `version - 1`.
+    std::deque<ConnectionChange> changes;
 
     static std::string createRoutingTableId(
         const DhtAddress& targetId,
@@ -142,19 +182,65 @@ private:
                                     : std::string());
     }
 
+    void logChange(ConnectionChange change) {
+        this->version++;
+        if (this->tables.size() == 0) {
+            // No table needs it; tables set later start at `version`.
+            this->changes.clear();
+            return;
+        }
+        this->changes.push_back(std::move(change));
+        if (this->changes.size() > maxLoggedChanges) {
+            this->changes.pop_front();
+        }
+    }
+
+    // Replays the changes the table has not seen. False if some of them
+    // are no longer logged.
+    bool catchUp(CachedTable& cached) {
+        const uint64_t firstLogged = this->version - this->changes.size();
+        if (cached.version < firstLogged) {
+            return false;
+        }
+        for (auto i = static_cast<size_t>(cached.version - firstLogged);
+             i < this->changes.size();
+             ++i) {
+            const auto& change = this->changes[i];
+            if (change.remote != nullptr) {
+                cached.table->addContact(change.remote);
+            } else {
+                cached.table->removeContact(change.nodeId);
+            }
+        }
+        cached.version = this->version;
+        return true;
+    }
+
 public:
     [[nodiscard]] RoutingTable get(
         const DhtAddress& targetId,
         const std::optional<DhtAddress>& previousId = std::nullopt) {
-        return this->tables.get(createRoutingTableId(targetId, previousId))
-            .value_or(nullptr);
+        const auto id = createRoutingTableId(targetId, previousId);
+        CachedTable* cached = this->tables.get(id);
+        if (cached == nullptr) {
+            return nullptr;
+        }
+        if (!this->catchUp(*cached)) {
+            cached->table->stop();
+            this->tables.remove(id);
+            return nullptr;
+        }
+        return cached->table;
     }
 
+    // The table must reflect the connections as of now.
     void set(
         const DhtAddress& targetId,
         const RoutingTable& table,
         const std::optional<DhtAddress>& previousId = std::nullopt) {
-        this->tables.set(createRoutingTableId(targetId, previousId), table);
+        this->tables.set(
+            createRoutingTableId(targetId, previousId),
+            CachedTable{.table = table, .version = this->version});
     }
 
     [[nodiscard]] bool has(
@@ -164,20 +250,24 @@ public:
     }
 
     void onNodeDisconnected(const DhtAddress& nodeId) {
-        this->tables.forEach([&nodeId](const RoutingTable& table) {
-            table->removeContact(nodeId);
-        });
+        this->logChange(ConnectionChange{.nodeId = nodeId, .remote = nullptr});
     }
 
     void onNodeConnected(const std::shared_ptr<RoutingRemoteContact>& remote) {
-        this->tables.forEach([&remote](const RoutingTable& table) {
-            table->addContact(remote);
-        });
+        this->logChange(
+            ConnectionChange{.nodeId = remote->getNodeId(), .remote = remote});
+    }
+
+    // Connection changes not yet applied to every cached table.
+    [[nodiscard]] size_t getLoggedChangeCount() const {
+        return this->changes.size();
     }
 
     void reset() {
-        this->tables.forEach([](const RoutingTable& table) { table->stop(); });
+        this->tables.forEach(
+            [](const CachedTable& cached) { cached.table->stop(); });
         this->tables.clear();
+        this->changes.clear();
     }
 };
 
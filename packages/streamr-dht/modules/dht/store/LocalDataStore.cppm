@@ -6,20 +6,37 @@
 // RecursiveOperationManager reads it to answer FIND queries and the A5 unit
 // test constructs a real one. Each node can store one value per (data key,
 // creator) pair; entries expire after min(entry.ttl, maxTtl).
+//
+// Adaptations:
+// - Expiry is proactive. Each entry gets a timer in a TimerWheel, which
+//   every call (and the owner's periodic expire()) advances, so an entry
+//   is dropped when it expires even if its key is never read again. TS
+//   gets the same effect from a setTimeout per entry.
+// - The store has a memory budget (maxBytes, an estimate of the entries'
+//   in-memory size). Storing past it evicts the oldest stored entries.
+// - Entries are held as immutable shared snapshots: getEntries() hands
+//   them out without copying the protobufs, and the rare updates
+//   (markAsDeleted, setAllEntriesAsStale) replace the snapshot.
+// - Calls are serialized on an internal mutex: the store is shared by the
+//   RPC handlers, StoreManager and the expiry timer.
 module;
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <utility>
 #include <vector>
 
 export module streamr.dht.LocalDataStore;
 
 import streamr.dht.protos;
 
-import streamr.utils.MapWithTtl;
+import streamr.utils.TimerWheel;
 import streamr.dht.Identifiers;
 
 export namespace streamr::dht::store {
@@ -27,13 +44,49 @@ export namespace streamr::dht::store {
 using ::dht::DataEntry;
 using streamr::dht::DhtAddress;
 using streamr::dht::Identifiers;
-using streamr::utils::MapWithTtl;
+using streamr::utils::TimerWheel;
+
+inline constexpr size_t DEFAULT_LOCAL_DATA_STORE_MAX_BYTES =
+    size_t{64} * 1024 * 1024; // NOLINT(readability-magic-numbers)
+
+struct LocalDataStoreOptions {
+    uint32_t maxTtl;
+    // The estimated in-memory size of the stored entries above which the
+    // oldest ones are evicted.
+    size_t maxBytes = DEFAULT_LOCAL_DATA_STORE_MAX_BYTES;
+};
 
 class LocalDataStore {
 private:
-    uint32_t maxTtl;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::milliseconds expiryTick{100};
+
+    struct Record {
+        std::shared_ptr<const DataEntry> entry;
+        Clock::time_point expiresAt;
+        // Identifies this version of the entry in storeOrder and in its
+        // expiry timer; a newer store of the same entry gets a new one.
+        uint64_t sequence;
+        size_t bytes;
+    };
+
+    struct Location {
+        DhtAddress key;
+        DhtAddress creator;
+    };
+
+    LocalDataStoreOptions options;
+    std::mutex mutex;
     // The outer key is the data key, the inner key is the creator's node id.
-    std::map<DhtAddress, MapWithTtl<DhtAddress, DataEntry>> store;
+    std::map<DhtAddress, std::map<DhtAddress, Record>> store;
+    // Every stored record by sequence, i.e. oldest first.
+    std::map<uint64_t, Location> storeOrder;
+    // Fires record sequences; a fired sequence that is no longer in
+    // storeOrder belongs to a replaced or removed record.
+    TimerWheel<uint64_t> expiryWheel{expiryTick};
+    uint64_t nextSequence = 0;
+    size_t usedBytes = 0;
 
     template <typename Timestamp>
     [[nodiscard]] static int64_t toMillis(const Timestamp& timestamp) {
@@ -43,8 +96,79 @@ private:
             (timestamp.nanos() / nanosPerMilli);
     }
 
+    [[nodiscard]] static size_t estimateBytes(const DataEntry& entry) {
+        return entry.SpaceUsedLong() + sizeof(Record) + sizeof(Location) +
+            (2 * entry.key().size()) + (2 * entry.creator().size());
+    }
+
+    [[nodiscard]] static bool isLive(
+        const Record& record, Clock::time_point now) {
+        return now < record.expiresAt;
+    }
+
+    // Drops the record at `it` from `inner` (and `inner` from the store if
+    // it became empty).
+    void eraseRecord(
+        std::map<DhtAddress, std::map<DhtAddress, Record>>::iterator outer,
+        std::map<DhtAddress, Record>::iterator it) {
+        this->usedBytes -= it->second.bytes;
+        this->storeOrder.erase(it->second.sequence);
+        outer->second.erase(it);
+        if (outer->second.empty()) {
+            this->store.erase(outer);
+        }
+    }
+
+    // Drops the record with `sequence` if it is still stored.
+    void eraseSequence(uint64_t sequence) {
+        const auto location = this->storeOrder.find(sequence);
+        if (location == this->storeOrder.end()) {
+            return;
+        }
+        const auto outer = this->store.find(location->second.key);
+        this->eraseRecord(outer, outer->second.find(location->second.creator));
+    }
+
+    size_t expireLocked(Clock::time_point now) {
+        size_t expired = 0;
+        this->expiryWheel.advance(now, [this, &expired](uint64_t sequence) {
+            if (this->storeOrder.contains(sequence)) {
+                this->eraseSequence(sequence);
+                expired++;
+            }
+        });
+        return expired;
+    }
+
+    void evictOverBudget() {
+        while (this->usedBytes > this->options.maxBytes &&
+               !this->storeOrder.empty()) {
+            this->eraseSequence(this->storeOrder.begin()->first);
+        }
+    }
+
+    // The live record for (key, creator), or nullptr.
+    Record* findLive(
+        const DhtAddress& key,
+        const DhtAddress& creator,
+        Clock::time_point now) {
+        const auto outer = this->store.find(key);
+        if (outer == this->store.end()) {
+            return nullptr;
+        }
+        const auto it = outer->second.find(creator);
+        if (it == outer->second.end() || !isLive(it->second, now)) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
 public:
-    explicit LocalDataStore(uint32_t maxTtl) : maxTtl(maxTtl) {}
+    explicit LocalDataStore(uint32_t maxTtl)
+        : LocalDataStore(LocalDataStoreOptions{.maxTtl = maxTtl}) {}
+
+    explicit LocalDataStore(LocalDataStoreOptions options)
+        : options(options) {}
 
     // Virtual so tests can substitute a mock store (StoreManager /
     // StoreRpcLocal hold it by reference).
@@ -59,92 +183,178 @@ public:
             Identifiers::getDhtAddressFromRaw(DhtAddressRaw{dataEntry.key()});
         const DhtAddress creatorNodeId = Identifiers::getDhtAddressFromRaw(
             DhtAddressRaw{dataEntry.creator()});
-        if (!this->store.contains(key)) {
-            const uint32_t maxTtlCapture = this->maxTtl;
-            this->store.emplace(
-                key,
-                MapWithTtl<DhtAddress, DataEntry>(
-                    [maxTtlCapture](const DataEntry& entry) {
-                        return std::chrono::milliseconds(
-                            std::min(entry.ttl(), maxTtlCapture));
-                    }));
+        const size_t bytes = estimateBytes(dataEntry);
+        if (bytes > this->options.maxBytes) {
+            return false;
         }
-        auto& inner = this->store.at(key);
-        if (inner.has(creatorNodeId)) {
-            const int64_t storedMillis = toMillis(dataEntry.createdat());
-            const int64_t oldStoredMillis =
-                toMillis(inner.get(creatorNodeId)->createdat());
-            // Do nothing if the local entry is newer than the replicated one.
-            if (oldStoredMillis >= storedMillis) {
-                return false;
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        this->expireLocked(now);
+        auto& inner = this->store[key];
+        const auto existing = inner.find(creatorNodeId);
+        if (existing != inner.end()) {
+            if (isLive(existing->second, now)) {
+                const int64_t storedMillis = toMillis(dataEntry.createdat());
+                const int64_t oldStoredMillis =
+                    toMillis(existing->second.entry->createdat());
+                // Do nothing if the local entry is newer than the
+                // replicated one.
+                if (oldStoredMillis >= storedMillis) {
+                    return false;
+                }
             }
+            this->usedBytes -= existing->second.bytes;
+            this->storeOrder.erase(existing->second.sequence);
+            inner.erase(existing);
         }
-        inner.set(creatorNodeId, dataEntry);
+        const uint64_t sequence = this->nextSequence++;
+        const auto expiresAt = now +
+            std::chrono::milliseconds(
+                std::min(dataEntry.ttl(), this->options.maxTtl));
+        inner.emplace(
+            creatorNodeId,
+            Record{
+                .entry = std::make_shared<const DataEntry>(dataEntry),
+                .expiresAt = expiresAt,
+                .sequence = sequence,
+                .bytes = bytes});
+        this->storeOrder.emplace(
+            sequence, Location{.key = key, .creator = creatorNodeId});
+        this->expiryWheel.schedule(expiresAt, sequence);
+        this->usedBytes += bytes;
+        this->evictOverBudget();
         return true;
     }
 
     virtual bool markAsDeleted(
         const DhtAddress& key, const DhtAddress& creator) {
-        const auto it = this->store.find(key);
-        if (it == this->store.end() || !it->second.has(creator)) {
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        this->expireLocked(now);
+        Record* record = this->findLive(key, creator, now);
+        if (record == nullptr) {
             return false;
         }
-        it->second.get(creator)->set_deleted(true);
+        auto updated = std::make_shared<DataEntry>(*record->entry);
+        updated->set_deleted(true);
+        record->entry = std::move(updated);
         return true;
     }
 
-    [[nodiscard]] virtual std::vector<DataEntry> values(
-        const std::optional<DhtAddress>& key = std::nullopt) {
-        std::vector<DataEntry> result;
+    // The stored entries (of one data key, or all), shared rather than
+    // copied. The snapshots stay valid after the store drops them.
+    [[nodiscard]] virtual std::vector<std::shared_ptr<const DataEntry>>
+    getEntries(const std::optional<DhtAddress>& key = std::nullopt) {
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        this->expireLocked(now);
+        std::vector<std::shared_ptr<const DataEntry>> result;
+        const auto append = [&result, now](
+                                const std::map<DhtAddress, Record>& inner) {
+            for (const auto& [creator, record] : inner) {
+                if (isLive(record, now)) {
+                    result.push_back(record.entry);
+                }
+            }
+        };
         if (key.has_value()) {
             const auto it = this->store.find(key.value());
             if (it != this->store.end()) {
-                auto entries = it->second.values();
-                result.insert(result.end(), entries.begin(), entries.end());
+                append(it->second);
             }
         } else {
-            for (auto& [dataKey, map] : this->store) {
-                auto entries = map.values();
-                result.insert(result.end(), entries.begin(), entries.end());
+            result.reserve(this->storeOrder.size());
+            for (const auto& [dataKey, inner] : this->store) {
+                append(inner);
             }
         }
         return result;
     }
 
+    // Copies of the stored entries, for callers that hand them on in a
+    // protobuf message anyway.
+    [[nodiscard]] std::vector<DataEntry> values(
+        const std::optional<DhtAddress>& key = std::nullopt) {
+        const auto entries = this->getEntries(key);
+        std::vector<DataEntry> result;
+        result.reserve(entries.size());
+        for (const auto& entry : entries) {
+            result.push_back(*entry);
+        }
+        return result;
+    }
+
     [[nodiscard]] virtual std::vector<DhtAddress> keys() {
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        this->expireLocked(now);
         std::vector<DhtAddress> result;
         result.reserve(this->store.size());
-        for (const auto& [key, map] : this->store) {
-            result.push_back(key);
+        for (const auto& [key, inner] : this->store) {
+            if (std::ranges::any_of(inner, [now](const auto& item) {
+                    return isLive(item.second, now);
+                })) {
+                result.push_back(key);
+            }
         }
         return result;
     }
 
     virtual void setAllEntriesAsStale(const DhtAddress& key) {
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        this->expireLocked(now);
         const auto it = this->store.find(key);
-        if (it != this->store.end()) {
-            it->second.forEach(
-                [](DataEntry& value, const DhtAddress& /*creator*/) {
-                    value.set_stale(true);
-                });
+        if (it == this->store.end()) {
+            return;
+        }
+        for (auto& [creator, record] : it->second) {
+            if (isLive(record, now) && !record.entry->stale()) {
+                auto updated = std::make_shared<DataEntry>(*record.entry);
+                updated->set_stale(true);
+                record.entry = std::move(updated);
+            }
         }
     }
 
     virtual void deleteEntry(const DhtAddress& key, const DhtAddress& creator) {
-        const auto it = this->store.find(key);
-        if (it != this->store.end() && it->second.get(creator) != nullptr) {
-            it->second.remove(creator);
-            if (it->second.size() == 0) {
-                this->store.erase(it);
-            }
+        std::scoped_lock lock(this->mutex);
+        const auto outer = this->store.find(key);
+        if (outer == this->store.end()) {
+            return;
+        }
+        const auto it = outer->second.find(creator);
+        if (it != outer->second.end()) {
+            this->eraseRecord(outer, it);
         }
     }
 
+    // Drops the expired entries. Every call does this too; the owner also
+    // calls it periodically so an idle store releases them.
+    size_t expire() {
+        const auto now = Clock::now();
+        std::scoped_lock lock(this->mutex);
+        return this->expireLocked(now);
+    }
+
+    // The estimated in-memory size of the stored entries.
+    [[nodiscard]] size_t getUsedBytes() {
+        std::scoped_lock lock(this->mutex);
+        return this->usedBytes;
+    }
+
+    // Stored entries, including any expired ones not yet dropped.
+    [[nodiscard]] size_t getEntryCount() {
+        std::scoped_lock lock(this->mutex);
+        return this->storeOrder.size();
+    }
+
     virtual void clear() {
-        for (auto& [key, map] : this->store) {
-            map.clear();
-        }
+        std::scoped_lock lock(this->mutex);
         this->store.clear();
+        this->storeOrder.clear();
+        this->expiryWheel.clear();
+        this->usedBytes = 0;
     }
 };
 
@@ -0,0 +1,121 @@
+// Module streamr.dht.ReplicationBatch
+// Native-only (no TS counterpart): helpers for the batched store
+// replication between native nodes (see StoreManager). The messages
+// (ReplicateDataBatch, ReplicaDigests, ReplicaKeys) and the StoreRpc
+// methods carrying them are declared in the NATIVE-ONLY section of
+// DhtRpc.proto.
+//
+// A replica digest summarizes the entries a node holds for one data key:
+// the sum of a 64-bit hash of each entry's (creator, createdAt, deleted),
+// so it does not depend on the order the entries are listed in. Two nodes
+// whose digests for a key are equal hold the same versions of its entries.
+// The hashed bytes have a fixed little-endian layout, so nodes of any
+// endianness agree on the digest.
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <span>
+#include <string>
+#include <folly/hash/SpookyHashV2.h>
+
+export module streamr.dht.ReplicationBatch;
+
+import streamr.dht.protos;
+
+import streamr.dht.Identifiers;
+
+export namespace streamr::dht::store {
+
+using ::dht::DataEntry;
+using ::dht::ReplicaDigests;
+using ::dht::ReplicaKeys;
+using ::dht::ReplicateDataBatch;
+using streamr::dht::DhtAddress;
+using streamr::dht::DhtAddressRaw;
+using streamr::dht::Identifiers;
+
+namespace detail {
+
+inline void appendLittleEndian(std::string& out, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+        out.push_back(static_cast<char>((value >> (i * 8)) & 0xffU));
+    }
+}
+
+} // namespace detail
+
+inline uint64_t computeReplicaDigest(
+    std::span<const std::shared_ptr<const DataEntry>> entries) {
+    uint64_t digest = 0;
+    for (const auto& entry : entries) {
+        std::string version = entry->creator();
+        const int64_t seconds = entry->createdat().seconds();
+        const int32_t nanos = entry->createdat().nanos();
+        detail::appendLittleEndian(
+            version, static_cast<uint64_t>(seconds), sizeof(seconds));
+        detail::appendLittleEndian(
+            version,
+            static_cast<uint64_t>(static_cast<uint32_t>(nanos)),
+            sizeof(nanos));
+        version.push_back(entry->deleted() ? 1 : 0);
+        digest += folly::hash::SpookyHashV2::Hash64(
+            version.data(), version.size(), 0);
+    }
+    return digest;
+}
+
+inline ReplicateDataBatch packReplicateDataBatch(
+    std::span<const std::shared_ptr<const DataEntry>> entries) {
+    ReplicateDataBatch batch;
+    batch.mutable_entries()->Reserve(static_cast<int>(entries.size()));
+    for (const auto& entry : entries) {
+        *batch.add_entries() = *entry;
+    }
+    return batch;
+}
+
+inline ReplicaDigests packReplicaDigests(
+    const std::map<DhtAddress, uint64_t>& digests) {
+    ReplicaDigests result;
+    result.mutable_digests()->Reserve(static_cast<int>(digests.size()));
+    for (const auto& [key, digest] : digests) {
+        auto* item = result.add_digests();
+        item->set_key(Identifiers::getRawFromDhtAddress(key));
+        item->set_digest(digest);
+    }
+    return result;
+}
+
+inline std::map<DhtAddress, uint64_t> unpackReplicaDigests(
+    const ReplicaDigests& digests) {
+    std::map<DhtAddress, uint64_t> result;
+    for (const auto& item : digests.digests()) {
+        result.emplace(
+            Identifiers::getDhtAddressFromRaw(DhtAddressRaw{item.key()}),
+            item.digest());
+    }
+    return result;
+}
+
+inline ReplicaKeys packReplicaKeys(const std::set<DhtAddress>& keys) {
+    ReplicaKeys result;
+    result.mutable_keys()->Reserve(static_cast<int>(keys.size()));
+    for (const auto& key : keys) {
+        result.add_keys(Identifiers::getRawFromDhtAddress(key));
+    }
+    return result;
+}
+
+inline std::set<DhtAddress> unpackReplicaKeys(const ReplicaKeys& keys) {
+    std::set<DhtAddress> result;
+    for (const auto& key : keys.keys()) {
+        result.insert(Identifiers::getDhtAddressFromRaw(DhtAddressRaw{key}));
+    }
+    return result;
+}
+
+} // namespace streamr::dht::store
@@ -9,6 +9,14 @@
 // unit test mock them); the fire-and-forget replications TS runs via
 // setImmediate are dispatched onto a small worker executor here, so
 // StoreManager is owned through a shared_ptr.
+//
+// Native addition: replication is batched per contact. Entries queued for
+// the same contact are sent together: a syncReplicas request first
+// exchanges a digest of each key's entries (see ReplicationBatch), then one
+// replicateDataBatch notification carries the entries of the keys whose
+// digests differ. Contacts that do not know syncReplicas (TS and older
+// native nodes), and contacts whose syncReplicas fails, get one
+// replicateData per entry, as in TS.
 module;
 
 #include <coroutine> // IWYU pragma: keep
@@ -17,6 +25,8 @@ module;
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -35,12 +45,14 @@ import streamr.utils.SharedExecutors;
 import streamr.utils.EnableSharedFromThis;
 import streamr.utils.ExecutorHelper;
 import streamr.logger.SLogger;
+import streamr.protorpc.Errors;
 import streamr.protorpc.RpcCommunicator;
 import streamr.dht.DhtCallContext;
 import streamr.dht.getClosestNodes;
 import streamr.dht.Identifiers;
 import streamr.dht.LocalDataStore;
 import streamr.dht.RecursiveOperationSession;
+import streamr.dht.ReplicationBatch;
 import streamr.dht.StoreRpcLocal;
 import streamr.dht.StoreRpcRemote;
 
@@ -53,6 +65,9 @@ export namespace streamr::dht::store {
 using ::dht::DataEntry;
 using ::dht::PeerDescriptor;
 using ::dht::RecursiveOperation;
+using ::dht::ReplicaDigests;
+using ::dht::ReplicaKeys;
+using ::dht::ReplicateDataBatch;
 using ::dht::ReplicateDataRequest;
 using ::dht::StoreDataRequest;
 using ::dht::StoreDataResponse;
@@ -64,6 +79,7 @@ using streamr::dht::contact::GetClosestNodesOptions;
 using streamr::dht::recursiveoperation::RecursiveOperationResult;
 using streamr::dht::rpcprotocol::DhtCallContext;
 using streamr::protorpc::RpcCommunicator;
+using streamr::protorpc::UnknownRpcMethod;
 
 struct StoreManagerOptions {
     RpcCommunicator<DhtCallContext>& rpcCommunicator;
@@ -101,6 +117,24 @@ private:
     folly::CancellationSource replicationCancellation;
     std::unique_ptr<StoreRpcLocal> rpcLocal;
 
+    // Well below the transports' 1 MiB message limit.
+    static constexpr size_t maxReplicationBatchBytes = size_t{256} * 1024;
+
+    using Entries = std::vector<std::shared_ptr<const DataEntry>>;
+
+    struct PendingReplication {
+        PeerDescriptor target;
+        Entries entries;
+    };
+
+    std::mutex replicationMutex;
+    // Entries queued per contact. A contact is in the map from its first
+    // queued entry until its flush task takes them.
+    std::map<DhtAddress, PendingReplication> pendingReplications;
+    // Contacts that answered syncReplicas with UnknownRpcMethod, until
+    // they disconnect (see onContactDisconnected).
+    std::set<DhtAddress> legacyReplicationTargets;
+
     explicit StoreManager(StoreManagerOptions options)
         : options(std::move(options)) {}
 
@@ -109,36 +143,172 @@ private:
             peer, this->options.localPeerDescriptor);
     }
 
-    // The actual async replication of one entry to one contact.
-    folly::coro::Task<void> doReplicate(
-        DataEntry dataEntry, PeerDescriptor contact) {
+    // The newest version of each (key, creator) among `entries`, by key.
+    static std::map<DhtAddress, Entries> groupByKey(const Entries& entries) {
+        using ByCreator =
+            std::map<std::string, std::shared_ptr<const DataEntry>>;
+        std::map<DhtAddress, ByCreator> newest;
+        for (const auto& entry : entries) {
+            const DhtAddress key =
+                Identifiers::getDhtAddressFromRaw(DhtAddressRaw{entry->key()});
+            auto& current = newest[key][entry->creator()];
+            if (!current ||
+                std::pair(
+                    current->createdat().seconds(),
+                    current->createdat().nanos()) <
+                    std::pair(
+                        entry->createdat().seconds(),
+                        entry->createdat().nanos())) {
+                current = entry;
+            }
+        }
+        std::map<DhtAddress, Entries> result;
+        for (auto& [key, byCreator] : newest) {
+            auto& group = result[key];
+            for (auto& [creator, entry] : byCreator) {
+                group.push_back(std::move(entry));
+            }
+        }
+        return result;
+    }
+
+    // Asks the contact which keys it holds in other versions and returns
+    // the entries of those keys. Throws UnknownRpcMethod if the contact
+    // does not support syncReplicas, and any other RPC error as is.
+    folly::coro::Task<Entries> selectDifferingEntries(
+        StoreRpcRemote& rpcRemote, const Entries& entries, bool connect) {
+        const auto byKey = groupByKey(entries);
+        std::map<DhtAddress, uint64_t> digests;
+        for (const auto& [key, group] : byKey) {
+            digests.emplace(key, computeReplicaDigest(group));
+        }
+        const auto differingKeys =
+            co_await rpcRemote.syncReplicas(std::move(digests), connect);
+        Entries result;
+        for (const auto& [key, group] : byKey) {
+            if (differingKeys.contains(key)) {
+                result.insert(result.end(), group.begin(), group.end());
+            }
+        }
+        co_return result;
+    }
+
+    folly::coro::Task<void> sendReplicateDataBatches(
+        StoreRpcRemote& rpcRemote, const Entries& entries, bool connect) {
+        Entries batch;
+        size_t batchBytes = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            batch.push_back(entries[i]);
+            batchBytes += entries[i]->ByteSizeLong();
+            if (i + 1 < entries.size() &&
+                batchBytes + entries[i + 1]->ByteSizeLong() <=
+                    maxReplicationBatchBytes) {
+                continue;
+            }
+            try {
+                co_await rpcRemote.replicateDataBatch(
+                    std::exchange(batch, {}), connect);
+            } catch (const std::exception& err) {
+                SLogger::trace(
+                    "replicateDataBatch() threw an exception " +
+                    std::string(err.what()));
+            }
+            batchBytes = 0;
+        }
+    }
+
+    // The actual async replication of `entries` to one contact.
+    folly::coro::Task<void> replicateEntries(
+        PeerDescriptor contact, Entries entries, bool connect) {
         auto rpcRemote = this->options.createRpcRemote(contact);
-        ReplicateDataRequest request;
-        *request.mutable_entry() = std::move(dataEntry);
-        try {
-            co_await rpcRemote->replicateData(std::move(request), true);
-        } catch (const std::exception& err) {
-            SLogger::trace(
-                "replicateData() threw an exception " +
-                std::string(err.what()));
+        const DhtAddress nodeId =
+            Identifiers::getNodeIdFromPeerDescriptor(contact);
+        bool legacy = false;
+        {
+            std::scoped_lock lock(this->replicationMutex);
+            legacy = this->legacyReplicationTargets.contains(nodeId);
+        }
+        if (!legacy) {
+            std::optional<Entries> differing;
+            try {
+                differing = co_await this->selectDifferingEntries(
+                    *rpcRemote, entries, connect);
+            } catch (const UnknownRpcMethod&) {
+                std::scoped_lock lock(this->replicationMutex);
+                this->legacyReplicationTargets.insert(nodeId);
+            } catch (const std::exception& err) {
+                // Fall back to replicateData for this round only: a
+                // timeout does not tell whether the contact is legacy.
+                SLogger::trace(
+                    "syncReplicas() threw an exception " +
+                    std::string(err.what()));
+            }
+            if (differing.has_value()) {
+                co_await this->sendReplicateDataBatches(
+                    *rpcRemote, differing.value(), connect);
+                co_return;
+            }
+        }
+        for (const auto& entry : entries) {
+            ReplicateDataRequest request;
+            *request.mutable_entry() = *entry;
+            try {
+                co_await rpcRemote->replicateData(std::move(request), connect);
+            } catch (const std::exception& err) {
+                SLogger::trace(
+                    "replicateData() threw an exception " +
+                    std::string(err.what()));
+            }
         }
     }
 
-    // Fire-and-forget the async replication onto the worker executor,
-    // tracked by replicationScope (see the member comment).
+    folly::coro::Task<void> flushReplications(DhtAddress nodeId) {
+        PendingReplication pending;
+        {
+            std::scoped_lock lock(this->replicationMutex);
+            const auto it = this->pendingReplications.find(nodeId);
+            if (it == this->pendingReplications.end()) {
+                co_return;
+            }
+            pending = std::move(it->second);
+            this->pendingReplications.erase(it);
+        }
+        co_await this->replicateEntries(
+            std::move(pending.target), std::move(pending.entries), true);
+    }
+
+    // Queues `entries` for the contact; the first entries queued for it
+    // fire-and-forget a flush onto the worker executor, tracked by
+    // replicationScope (see the member comment), which sends everything
+    // queued by the time it runs.
     void replicateDataToContact(
-        const DataEntry& dataEntry, const PeerDescriptor& contact) {
+        Entries entries, const PeerDescriptor& contact) {
+        if (entries.empty()) {
+            return;
+        }
+        DhtAddress nodeId = Identifiers::getNodeIdFromPeerDescriptor(contact);
+        {
+            std::scoped_lock lock(this->replicationMutex);
+            auto [it, inserted] = this->pendingReplications.try_emplace(
+                nodeId, PendingReplication{.target = contact, .entries = {}});
+            auto& pending = it->second.entries;
+            pending.insert(
+                pending.end(),
+                std::make_move_iterator(entries.begin()),
+                std::make_move_iterator(entries.end()));
+            if (!inserted) {
+                return;
+            }
+        }
         auto self = this->sharedFromThis<StoreManager>();
-        DataEntry entry = dataEntry;
-        PeerDescriptor target = contact;
         this->replicationScope.add(
             streamr::utils::co_withExecutor(
                 &this->replicationExecutor,
                 streamr::utils::co_withCancellation(
                     this->replicationCancellation.getToken(),
                     folly::coro::co_invoke(
-                        [self, entry, target]() -> folly::coro::Task<void> {
-                            co_await self->doReplicate(entry, target);
+                        [self, nodeId]() -> folly::coro::Task<void> {
+                            co_await self->flushReplications(nodeId);
                         }))));
     }
 
@@ -150,7 +320,9 @@ private:
             .replicateDataToContact =
                 [this](
                     const DataEntry& dataEntry, const PeerDescriptor& contact) {
-                    this->replicateDataToContact(dataEntry, contact);
+                    this->replicateDataToContact(
+                        {std::make_shared<const DataEntry>(dataEntry)},
+                        contact);
                 },
             .getStorers =
                 [this](const DhtAddress& dataKey) {
@@ -180,6 +352,30 @@ private:
                         locked->rpcLocal->replicateData(request, callContext);
                     }
                 });
+        this->options.rpcCommunicator
+            .template registerRpcMethod<ReplicaDigests, ReplicaKeys>(
+                "syncReplicas",
+                [weakSelf](
+                    const ReplicaDigests& request,
+                    const DhtCallContext& callContext) -> ReplicaKeys {
+                    auto locked = weakSelf.lock();
+                    if (!locked) {
+                        return ReplicaKeys{};
+                    }
+                    return locked->rpcLocal->syncReplicas(request, callContext);
+                });
+        this->options.rpcCommunicator
+            .template registerRpcNotification<ReplicateDataBatch>(
+                "replicateDataBatch",
+                [weakSelf](
+                    const ReplicateDataBatch& request,
+                    const DhtCallContext& callContext) {
+                    auto locked = weakSelf.lock();
+                    if (locked) {
+                        locked->rpcLocal->replicateDataBatch(
+                            request, callContext);
+                    }
+                });
     }
 
     void replicateAndUpdateStaleState(
@@ -199,24 +395,8 @@ private:
             });
         if (selfWasPrimaryStorer) {
             if (newNodeIsStorer) {
-                auto self = this->sharedFromThis<StoreManager>();
-                DhtAddress key = dataKey;
-                PeerDescriptor node = newNode;
-                this->replicationScope.add(
-                    streamr::utils::co_withExecutor(
-                        &this->replicationExecutor,
-                        streamr::utils::co_withCancellation(
-                            this->replicationCancellation.getToken(),
-                            folly::coro::co_invoke(
-                                [self, key, node]() -> folly::coro::Task<void> {
-                                    const auto dataEntries =
-                                        self->options.localDataStore.values(
-                                            key);
-                                    for (const auto& dataEntry : dataEntries) {
-                                        co_await self->doReplicate(
-                                            dataEntry, node);
-                                    }
-                                }))));
+                this->replicateDataToContact(
+                    this->options.localDataStore.getEntries(dataKey), newNode);
             }
         } else if (!std::ranges::any_of(
                        storers, [this](const PeerDescriptor& peer) {
@@ -239,30 +419,34 @@ private:
         return getClosestNodes(dataKey, nodes, opts);
     }
 
+    // Hands every entry to the closest neighbors of its key: one
+    // replication per neighbor, all neighbors at once.
     folly::coro::Task<void> replicateDataToClosestNodes() {
-        const auto dataEntries = this->options.localDataStore.values();
-        for (const auto& dataEntry : dataEntries) {
-            const DhtAddress dataKey = Identifiers::getDhtAddressFromRaw(
-                DhtAddressRaw{dataEntry.key()});
-            const auto neighbors = getClosestNodes(
+        const auto neighbors = this->options.getNeighbors();
+        std::map<DhtAddress, PendingReplication> byNeighbor;
+        for (const auto& [dataKey, entries] :
+             groupByKey(this->options.localDataStore.getEntries())) {
+            const auto closest = getClosestNodes(
                 dataKey,
-                this->options.getNeighbors(),
+                neighbors,
                 GetClosestNodesOptions{
                     .maxCount = this->options.redundancyFactor});
-            for (const auto& neighbor : neighbors) {
-                auto rpcRemote = this->options.createRpcRemote(neighbor);
-                ReplicateDataRequest request;
-                *request.mutable_entry() = dataEntry;
-                try {
-                    co_await rpcRemote->replicateData(
-                        std::move(request), false);
-                } catch (const std::exception& err) {
-                    SLogger::trace(
-                        "Failed to replicate in replicateDataToClosestNodes " +
-                        std::string(err.what()));
-                }
+            for (const auto& neighbor : closest) {
+                const DhtAddress nodeId =
+                    Identifiers::getNodeIdFromPeerDescriptor(neighbor);
+                auto& pending = byNeighbor[nodeId];
+                pending.target = neighbor;
+                pending.entries.insert(
+                    pending.entries.end(), entries.begin(), entries.end());
             }
         }
+        std::vector<folly::coro::Task<void>> replications;
+        replications.reserve(byNeighbor.size());
+        for (auto& [nodeId, pending] : byNeighbor) {
+            replications.push_back(this->replicateEntries(
+                std::move(pending.target), std::move(pending.entries), false));
+        }
+        co_await folly::coro::collectAllRange(std::move(replications));
     }
 
 public:
@@ -285,6 +469,15 @@ public:
         }
     }
 
+    // Forgets that the contact is legacy, so a contact that reconnects
+    // (possibly upgraded) is asked with syncReplicas again.
+    void onContactDisconnected(const PeerDescriptor& peerDescriptor) {
+        const DhtAddress nodeId =
+            Identifiers::getNodeIdFromPeerDescriptor(peerDescriptor);
+        std::scoped_lock lock(this->replicationMutex);
+        this->legacyReplicationTargets.erase(nodeId);
+    }
+
     folly::coro::Task<std::vector<PeerDescriptor>> storeDataToDht(
         DhtAddress key, ::google::protobuf::Any data, DhtAddress creator) {
         auto self = this->sharedFromThis<StoreManager>();
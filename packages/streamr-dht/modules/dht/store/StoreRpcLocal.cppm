@@ -9,12 +9,17 @@
 // (fire and forget). Here replicateDataToContact is a synchronous void
 // callback that the manager wires to kick off the async replication itself,
 // so the local side calls it directly.
+//
+// Native additions (see ReplicationBatch): replicateDataBatch handles each
+// entry of a batch as replicateData would, and syncReplicas returns the
+// keys whose local entries do not match the caller's digests.
 module;
 
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <functional>
+#include <set>
 #include <vector>
 
 export module streamr.dht.StoreRpcLocal;
@@ -26,6 +31,7 @@ import streamr.dht.DhtRpcServer;
 import streamr.dht.DhtCallContext;
 import streamr.dht.Identifiers;
 import streamr.dht.LocalDataStore;
+import streamr.dht.ReplicationBatch;
 
 // Hoisted from the former header (file scope, NOT exported).
 using streamr::logger::SLogger;
@@ -34,6 +40,9 @@ export namespace streamr::dht::store {
 
 using ::dht::DataEntry;
 using ::dht::PeerDescriptor;
+using ::dht::ReplicaDigests;
+using ::dht::ReplicaKeys;
+using ::dht::ReplicateDataBatch;
 using ::dht::ReplicateDataRequest;
 using ::dht::StoreDataRequest;
 using ::dht::StoreDataResponse;
@@ -76,6 +85,20 @@ private:
         });
     }
 
+    void replicateEntry(
+        const DataEntry& dataEntry, const PeerDescriptor& requestor) {
+        const bool wasStored =
+            this->options.localDataStore.storeEntry(dataEntry);
+        if (wasStored) {
+            this->replicateDataToNeighbors(requestor, dataEntry);
+        }
+        const DhtAddress key =
+            Identifiers::getDhtAddressFromRaw(DhtAddressRaw{dataEntry.key()});
+        if (!this->isLocalNodeStorer(key)) {
+            this->options.localDataStore.setAllEntriesAsStale(key);
+        }
+    }
+
     void replicateDataToNeighbors(
         const PeerDescriptor& requestor, const DataEntry& dataEntry) {
         const DhtAddress dataKey =
@@ -134,18 +157,32 @@ public:
         const ReplicateDataRequest& request,
         const DhtCallContext& callContext) override {
         SLogger::trace("server-side replicateData()");
-        const DataEntry& dataEntry = request.entry();
-        const bool wasStored =
-            this->options.localDataStore.storeEntry(dataEntry);
-        if (wasStored) {
-            this->replicateDataToNeighbors(
-                callContext.incomingSourceDescriptor.value(), request.entry());
+        this->replicateEntry(
+            request.entry(), callContext.incomingSourceDescriptor.value());
+    }
+
+    void replicateDataBatch(
+        const ReplicateDataBatch& request,
+        const DhtCallContext& callContext) override {
+        SLogger::trace("server-side replicateDataBatch()");
+        const auto& requestor = callContext.incomingSourceDescriptor.value();
+        for (const auto& dataEntry : request.entries()) {
+            this->replicateEntry(dataEntry, requestor);
         }
-        const DhtAddress key =
-            Identifiers::getDhtAddressFromRaw(DhtAddressRaw{dataEntry.key()});
-        if (!this->isLocalNodeStorer(key)) {
-            this->options.localDataStore.setAllEntriesAsStale(key);
+    }
+
+    ReplicaKeys syncReplicas(
+        const ReplicaDigests& request,
+        const DhtCallContext& /*callContext*/) override {
+        SLogger::trace("server-side syncReplicas()");
+        std::set<DhtAddress> differingKeys;
+        for (const auto& [key, digest] : unpackReplicaDigests(request)) {
+            if (computeReplicaDigest(
+                    this->options.localDataStore.getEntries(key)) != digest) {
+                differingKeys.insert(key);
+            }
         }
+        return packReplicaKeys(differingKeys);
     }
 };
 
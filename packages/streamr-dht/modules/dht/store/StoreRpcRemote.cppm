@@ -3,14 +3,22 @@
 // (v103.8.0-rc.3). The client used to store data on, and replicate data to,
 // a peer. storeData/replicateData are virtual so a test can substitute a
 // counting mock.
+//
+// Native addition: syncReplicas and replicateDataBatch, the client side of
+// the batched replication between native nodes (see ReplicationBatch).
 module;
 
 #include <coroutine> // IWYU pragma: keep
 
 #include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 export module streamr.dht.StoreRpcRemote;
 
@@ -21,6 +29,7 @@ import streamr.logger.SLogger;
 import streamr.dht.DhtRpcClient;
 import streamr.dht.DhtCallContext;
 import streamr.dht.Identifiers;
+import streamr.dht.ReplicationBatch;
 import streamr.dht.RpcRemote;
 
 // Hoisted from the former header (file scope, NOT exported).
@@ -28,6 +37,7 @@ using streamr::logger::SLogger;
 
 export namespace streamr::dht::store {
 
+using ::dht::DataEntry;
 using ::dht::PeerDescriptor;
 using ::dht::ReplicateDataRequest;
 using ::dht::StoreDataRequest;
@@ -83,6 +93,34 @@ public:
             std::move(options),
             RpcRemote<StoreRpcClient>::existingConnectionTimeout);
     }
+
+    // The keys of `digests` (see computeReplicaDigest) whose entries the
+    // peer holds in other versions or not at all. Throws UnknownRpcMethod
+    // if the peer does not support batched replication.
+    virtual folly::coro::Task<std::set<DhtAddress>> syncReplicas(
+        std::map<DhtAddress, uint64_t> digests, bool connect) {
+        DhtCallContext context;
+        context.connect = connect;
+        context.sendIfStopped = true;
+        auto options = this->formDhtRpcOptions(context);
+        const auto keys = co_await this->getClient().syncReplicas(
+            packReplicaDigests(digests),
+            std::move(options),
+            RpcRemote<StoreRpcClient>::existingConnectionTimeout);
+        co_return unpackReplicaKeys(keys);
+    }
+
+    virtual folly::coro::Task<void> replicateDataBatch(
+        std::vector<std::shared_ptr<const DataEntry>> entries, bool connect) {
+        DhtCallContext context;
+        context.connect = connect;
+        context.sendIfStopped = true;
+        auto options = this->formDhtRpcOptions(context);
+        co_await this->getClient().replicateDataBatch(
+            packReplicateDataBatch(entries),
+            std::move(options),
+            RpcRemote<StoreRpcClient>::existingConnectionTimeout);
+    }
 };
 
 } // namespace streamr::dht::store
@@ -76,6 +76,12 @@ public:
     folly::coro::Task<void> replicateData(ReplicateDataRequest&& request, CallContextType&& callContext, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
         return communicator.template notify<ReplicateDataRequest>("replicateData", std::move(request), std::move(callContext), timeout);
     }
+    folly::coro::Task<ReplicaKeys> syncReplicas(ReplicaDigests&& request, CallContextType&& callContext, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+        return communicator.template request<ReplicaKeys, ReplicaDigests>("syncReplicas", std::move(request), std::move(callContext), timeout);
+    }
+    folly::coro::Task<void> replicateDataBatch(ReplicateDataBatch&& request, CallContextType&& callContext, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+        return communicator.template notify<ReplicateDataBatch>("replicateDataBatch", std::move(request), std::move(callContext), timeout);
+    }
 }; // class StoreRpcClient
 template <typename CallContextType>
 class RecursiveOperationSessionRpcClient {
@@ -43,6 +43,8 @@ public:
    virtual ~StoreRpc() = default;
    virtual StoreDataResponse storeData(const StoreDataRequest& request, const CallContextType& callContext) = 0;
    virtual void replicateData(const ReplicateDataRequest& request, const CallContextType& callContext) = 0;
+   virtual ReplicaKeys syncReplicas(const ReplicaDigests& request, const CallContextType& callContext) = 0;
+   virtual void replicateDataBatch(const ReplicateDataBatch& request, const CallContextType& callContext) = 0;
 }; // class StoreRpc
 template <typename CallContextType>
 class RecursiveOperationSessionRpc {
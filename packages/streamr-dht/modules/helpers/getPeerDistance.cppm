@@ -1,10 +1,16 @@
 // Module streamr.dht.getPeerDistance
 // Ported from packages/dht/src/dht/helpers/getPeerDistance.ts
-// (v103.8.0-rc.3).
+// (v103.8.0-rc.3). Adaptations: the distance is an exact PeerDistance
+// value instead of a JavaScript Number (see below).
 module;
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
 
 export module streamr.dht.getPeerDistance;
@@ -14,32 +20,121 @@ import streamr.dht.Identifiers;
 export namespace streamr::dht::helpers {
 
 using streamr::dht::DhtAddressRaw;
+using streamr::dht::kademliaIdLengthInBytes;
+using streamr::dht::NodeId;
 
-// XOR distance between two raw ids, computed exactly as the npm `k-bucket`
-// library's KBucket.distance (which the TS getPeerDistance wraps): the
-// bytes are folded into a single number, most-significant byte first. The
-// accumulator is a double, matching JavaScript's Number, so for the full
-// 20-byte kademlia ids the low bits are lost the same way they are in TS
-// — the value is only used as a sort key, and both this port and the TS
-// tests fold with the identical IEEE-754 operations, so the ordering
-// matches. (KBucket itself arrives in phase A2; only this distance
-// function is needed here.)
-inline double getPeerDistance(
-    const DhtAddressRaw& first, const DhtAddressRaw& second) {
-    double distance = 0;
-    const size_t min = std::min(first.size(), second.size());
-    const size_t max = std::max(first.size(), second.size());
+/**
+ * The XOR distance between two kademlia ids as an exact 160-bit number.
+ * TS (npm `k-bucket`) folds the bytes into a double, which drops the low
+ * bits of 20-byte ids, so ids that differ only there compared as equally
+ * far. Here the value is held as big-endian words — the top 32 bits in
+ * the first — and distances order by a lexicographic word compare.
+ */
+class PeerDistance {
+private:
+    static constexpr size_t highWordBytes = 4;
+    static constexpr size_t wordBytes = 8;
+    static_assert(
+        highWordBytes + (2 * wordBytes) == kademliaIdLengthInBytes,
+        "the words cover a kademlia id exactly");
+
+    std::array<uint64_t, 3> words{};
+
+    template <typename Word>
+    static Word loadBigEndian(const uint8_t* bytes) {
+        Word word = 0;
+        std::memcpy(&word, bytes, sizeof(word));
+        if constexpr (std::endian::native == std::endian::little) {
+            word = std::byteswap(word);
+        }
+        return word;
+    }
+
+    static std::array<uint64_t, 3> load(const uint8_t* bytes) {
+        return {
+            loadBigEndian<uint32_t>(bytes),
+            loadBigEndian<uint64_t>(bytes + highWordBytes),
+            loadBigEndian<uint64_t>(bytes + highWordBytes + wordBytes)};
+    }
+
+public:
+    constexpr PeerDistance() = default;
+
+    // The distance as a big-endian number of kademliaIdLengthInBytes bytes.
+    static PeerDistance fromBigEndianBytes(const NodeId::Bytes& bytes) {
+        PeerDistance distance;
+        distance.words = load(bytes.data());
+        return distance;
+    }
+
+    // The XOR of two full-length ids.
+    static PeerDistance between(const NodeId& first, const NodeId& second) {
+        const auto a = load(first.getBytes().data());
+        const auto b = load(second.getBytes().data());
+        PeerDistance distance;
+        for (size_t i = 0; i < a.size(); ++i) {
+            distance.words[i] = a[i] ^ b[i];
+        }
+        return distance;
+    }
+
+    constexpr auto operator<=>(const PeerDistance&) const = default;
+    constexpr bool operator==(const PeerDistance&) const = default;
+};
+
+namespace detail {
+
+// The npm `k-bucket` distance of two ids of at most kademliaIdLengthInBytes
+// bytes: the bytes the ids share are XORed, each byte only the longer id
+// has counts as 255, and the result is read as one big-endian number.
+inline PeerDistance foldDistance(
+    const uint8_t* first,
+    size_t firstSize,
+    const uint8_t* second,
+    size_t secondSize) {
+    const size_t min = std::min(firstSize, secondSize);
+    const size_t max = std::max(firstSize, secondSize);
+    NodeId::Bytes bytes{};
+    const size_t offset = kademliaIdLengthInBytes - max;
     size_t i = 0;
     for (; i < min; ++i) {
-        const auto a = static_cast<unsigned char>(first[i]);
-        const auto b = static_cast<unsigned char>(second[i]);
-        distance =
-            distance * 256 + (a ^ b); // NOLINT(readability-magic-numbers)
+        bytes[offset + i] = static_cast<uint8_t>(first[i] ^ second[i]);
     }
     for (; i < max; ++i) {
-        distance = distance * 256 + 255; // NOLINT(readability-magic-numbers)
+        bytes[offset + i] = 0xff; // NOLINT(readability-magic-numbers)
+    }
+    return PeerDistance::fromBigEndianBytes(bytes);
+}
+
+} // namespace detail
+
+// The exact XOR of two full-length ids; shorter ids use the k-bucket fold
+// of the raw overload below.
+inline PeerDistance getPeerDistance(const NodeId& first, const NodeId& second) {
+    if (first.isFullLength() && second.isFullLength()) {
+        return PeerDistance::between(first, second);
+    }
+    return detail::foldDistance(
+        first.getBytes().data(),
+        first.size(),
+        second.getBytes().data(),
+        second.size());
+}
+
+// Raw ids of any length up to kademliaIdLengthInBytes, with the semantics
+// of the npm `k-bucket` distance the TS getPeerDistance wraps. A longer
+// (malformed) id is as far as possible from any other id, as it is in
+// the TS fold, so it sorts after every well-formed contact.
+inline PeerDistance getPeerDistance(
+    const DhtAddressRaw& first, const DhtAddressRaw& second) {
+    if (std::max(first.size(), second.size()) > kademliaIdLengthInBytes) {
+        NodeId::Bytes bytes{};
+        if (first != second) {
+            bytes.fill(0xff); // NOLINT(readability-magic-numbers)
+        }
+        return PeerDistance::fromBigEndianBytes(bytes);
     }
-    return distance;
+    return getPeerDistance(NodeId::fromRaw(first), NodeId::fromRaw(second));
 }
 
 } // namespace streamr::dht::helpers
@@ -50,6 +50,10 @@ using ::dht::PingRequest;
 using ::dht::PingResponse;
 using ::dht::RecursiveOperationRequest;
 using ::dht::RecursiveOperationResponse;
+using ::dht::ReplicaDigest;
+using ::dht::ReplicaDigests;
+using ::dht::ReplicaKeys;
+using ::dht::ReplicateDataBatch;
 using ::dht::ReplicateDataRequest;
 using ::dht::RouteMessageAck;
 using ::dht::RouteMessageWrapper;
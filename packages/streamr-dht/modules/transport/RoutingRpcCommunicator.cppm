@@ -7,6 +7,7 @@ module;
 #include "packages/proto-rpc/protos/ProtoRpc.pb.h"
 
 #include <string>
+#include <utility>
 
 export module streamr.dht.RoutingRpcCommunicator;
 
@@ -48,8 +49,10 @@ public:
         : RpcCommunicator(options),
           ownServiceId(std::move(ownServiceId)),
           sendFn(std::move(sendFn)) {
+        // msg arrives by value and is moved into the envelope: its body
+        // may be a large payload shared by a whole fan-out.
         this->setOutgoingMessageCallback([this](
-                                             const RpcMessage& msg,
+                                             RpcMessage msg,
                                              const std::string& /*requestId*/,
                                              const DhtCallContext&
                                                  callContext) {
@@ -84,8 +87,6 @@ public:
             SLogger::debug("Set message ID " + message.messageid());
             message.set_serviceid(this->ownServiceId);
             SLogger::debug("Set service ID");
-            message.mutable_rpcmessage()->CopyFrom(msg);
-            SLogger::debug("Copied RpcMessage to message");
             message.mutable_targetdescriptor()->CopyFrom(targetDescriptor);
             SLogger::debug("Copied targetDescriptor to message");
 
@@ -110,8 +111,10 @@ public:
                     SLogger::debug("Set sendOpts.sendIfStopped to true");
                 }
             }
+            *message.mutable_rpcmessage() = std::move(msg);
+            SLogger::debug("Moved RpcMessage to message");
             SLogger::debug("Calling sendFn with message and sendOpts");
-            this->sendFn(message, sendOpts);
+            this->sendFn(std::move(message), sendOpts);
         });
     }
 
@@ -178,6 +178,22 @@ class RecursiveOperationResponse;
 struct RecursiveOperationResponseDefaultTypeInternal;
 extern RecursiveOperationResponseDefaultTypeInternal _RecursiveOperationResponse_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull RecursiveOperationResponse_class_data_;
+class ReplicaDigest;
+struct ReplicaDigestDefaultTypeInternal;
+extern ReplicaDigestDefaultTypeInternal _ReplicaDigest_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicaDigest_class_data_;
+class ReplicaDigests;
+struct ReplicaDigestsDefaultTypeInternal;
+extern ReplicaDigestsDefaultTypeInternal _ReplicaDigests_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicaDigests_class_data_;
+class ReplicaKeys;
+struct ReplicaKeysDefaultTypeInternal;
+extern ReplicaKeysDefaultTypeInternal _ReplicaKeys_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicaKeys_class_data_;
+class ReplicateDataBatch;
+struct ReplicateDataBatchDefaultTypeInternal;
+extern ReplicateDataBatchDefaultTypeInternal _ReplicateDataBatch_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicateDataBatch_class_data_;
 class ReplicateDataRequest;
 struct ReplicateDataRequestDefaultTypeInternal;
 extern ReplicateDataRequestDefaultTypeInternal _ReplicateDataRequest_default_instance_;
@@ -1684,6 +1700,347 @@ class RouteMessageAck final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull RouteMessageAck_class_data_;
 // -------------------------------------------------------------------
 
+class ReplicaKeys final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:dht.ReplicaKeys) */ {
+ public:
+  inline ReplicaKeys() : ReplicaKeys(nullptr) {}
+  ~ReplicaKeys() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ReplicaKeys* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicaKeys));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ReplicaKeys(::google::protobuf::internal::ConstantInitialized);
+
+  inline ReplicaKeys(const ReplicaKeys& from) : ReplicaKeys(nullptr, from) {}
+  inline ReplicaKeys(ReplicaKeys&& from) noexcept
+      : ReplicaKeys(nullptr, ::std::move(from)) {}
+  inline ReplicaKeys& operator=(const ReplicaKeys& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaKeys& operator=(ReplicaKeys&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaKeys& default_instance() {
+    return *reinterpret_cast<const ReplicaKeys*>(
+        &_ReplicaKeys_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 41;
+  friend void swap(ReplicaKeys& a, ReplicaKeys& b) { a.Swap(&b); }
+  inline void Swap(ReplicaKeys* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaKeys* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaKeys* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReplicaKeys>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ReplicaKeys* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "dht.ReplicaKeys"; }
+
+  explicit ReplicaKeys(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReplicaKeys(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicaKeys& from);
+  ReplicaKeys(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicaKeys&& from) noexcept
+      : ReplicaKeys(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated bytes keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+
+  public:
+  void clear_keys() ;
+  const ::std::string& keys(int index) const;
+  ::std::string* PROTOBUF_NONNULL mutable_keys(int index);
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_keys(int index, Arg_&& value, Args_... args);
+  ::std::string* PROTOBUF_NONNULL add_keys();
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void add_keys(Arg_&& value, Args_... args);
+  const ::google::protobuf::RepeatedPtrField<::std::string>& keys() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_keys();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_keys() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_keys();
+
+  public:
+  // @@protoc_insertion_point(class_scope:dht.ReplicaKeys)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ReplicaKeys& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField<::std::string> keys_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ReplicaKeys_class_data_;
+// -------------------------------------------------------------------
+
+class ReplicaDigest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:dht.ReplicaDigest) */ {
+ public:
+  inline ReplicaDigest() : ReplicaDigest(nullptr) {}
+  ~ReplicaDigest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ReplicaDigest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicaDigest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ReplicaDigest(::google::protobuf::internal::ConstantInitialized);
+
+  inline ReplicaDigest(const ReplicaDigest& from) : ReplicaDigest(nullptr, from) {}
+  inline ReplicaDigest(ReplicaDigest&& from) noexcept
+      : ReplicaDigest(nullptr, ::std::move(from)) {}
+  inline ReplicaDigest& operator=(const ReplicaDigest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaDigest& operator=(ReplicaDigest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaDigest& default_instance() {
+    return *reinterpret_cast<const ReplicaDigest*>(
+        &_ReplicaDigest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 39;
+  friend void swap(ReplicaDigest& a, ReplicaDigest& b) { a.Swap(&b); }
+  inline void Swap(ReplicaDigest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaDigest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaDigest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReplicaDigest>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ReplicaDigest* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "dht.ReplicaDigest"; }
+
+  explicit ReplicaDigest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReplicaDigest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicaDigest& from);
+  ReplicaDigest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicaDigest&& from) noexcept
+      : ReplicaDigest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kKeyFieldNumber = 1,
+    kDigestFieldNumber = 2,
+  };
+  // bytes key = 1;
+  void clear_key() ;
+  const ::std::string& key() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_key(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_key();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_key();
+  void set_allocated_key(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_key() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_key(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_key();
+
+  public:
+  // fixed64 digest = 2;
+  void clear_digest() ;
+  ::uint64_t digest() const;
+  void set_digest(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_digest() const;
+  void _internal_set_digest(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:dht.ReplicaDigest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ReplicaDigest& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr key_;
+    ::uint64_t digest_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ReplicaDigest_class_data_;
+// -------------------------------------------------------------------
+
 class RecursiveOperationRequest final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:dht.RecursiveOperationRequest) */ {
  public:
@@ -4253,6 +4610,169 @@ class StoreDataRequest final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull StoreDataRequest_class_data_;
 // -------------------------------------------------------------------
 
+class ReplicaDigests final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:dht.ReplicaDigests) */ {
+ public:
+  inline ReplicaDigests() : ReplicaDigests(nullptr) {}
+  ~ReplicaDigests() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ReplicaDigests* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicaDigests));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ReplicaDigests(::google::protobuf::internal::ConstantInitialized);
+
+  inline ReplicaDigests(const ReplicaDigests& from) : ReplicaDigests(nullptr, from) {}
+  inline ReplicaDigests(ReplicaDigests&& from) noexcept
+      : ReplicaDigests(nullptr, ::std::move(from)) {}
+  inline ReplicaDigests& operator=(const ReplicaDigests& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicaDigests& operator=(ReplicaDigests&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaDigests& default_instance() {
+    return *reinterpret_cast<const ReplicaDigests*>(
+        &_ReplicaDigests_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 40;
+  friend void swap(ReplicaDigests& a, ReplicaDigests& b) { a.Swap(&b); }
+  inline void Swap(ReplicaDigests* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaDigests* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicaDigests* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReplicaDigests>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ReplicaDigests* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "dht.ReplicaDigests"; }
+
+  explicit ReplicaDigests(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReplicaDigests(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicaDigests& from);
+  ReplicaDigests(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicaDigests&& from) noexcept
+      : ReplicaDigests(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kDigestsFieldNumber = 1,
+  };
+  // repeated .dht.ReplicaDigest digests = 1;
+  int digests_size() const;
+  private:
+  int _internal_digests_size() const;
+
+  public:
+  void clear_digests() ;
+  ::dht::ReplicaDigest* PROTOBUF_NONNULL mutable_digests(int index);
+  ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>* PROTOBUF_NONNULL mutable_digests();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>& _internal_digests() const;
+  ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>* PROTOBUF_NONNULL _internal_mutable_digests();
+  public:
+  const ::dht::ReplicaDigest& digests(int index) const;
+  ::dht::ReplicaDigest* PROTOBUF_NONNULL add_digests();
+  const ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>& digests() const;
+  // @@protoc_insertion_point(class_scope:dht.ReplicaDigests)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ReplicaDigests& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::dht::ReplicaDigest > digests_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ReplicaDigests_class_data_;
+// -------------------------------------------------------------------
+
 class PeerDescriptor final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:dht.PeerDescriptor) */ {
  public:
@@ -5213,49 +5733,210 @@ class ConnectivityResponse final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ConnectivityResponse& from_msg);
+        const ConnectivityResponse& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::internal::ArenaStringPtr host_;
+    ::google::protobuf::internal::ArenaStringPtr nattype_;
+    ::google::protobuf::internal::ArenaStringPtr protocolversion_;
+    ::dht::ConnectivityMethod* PROTOBUF_NULLABLE websocket_;
+    double latitude_;
+    double longitude_;
+    ::uint32_t ipaddress_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull ConnectivityResponse_class_data_;
+// -------------------------------------------------------------------
+
+class ReplicateDataRequest final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:dht.ReplicateDataRequest) */ {
+ public:
+  inline ReplicateDataRequest() : ReplicateDataRequest(nullptr) {}
+  ~ReplicateDataRequest() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(ReplicateDataRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicateDataRequest));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR ReplicateDataRequest(::google::protobuf::internal::ConstantInitialized);
+
+  inline ReplicateDataRequest(const ReplicateDataRequest& from) : ReplicateDataRequest(nullptr, from) {}
+  inline ReplicateDataRequest(ReplicateDataRequest&& from) noexcept
+      : ReplicateDataRequest(nullptr, ::std::move(from)) {}
+  inline ReplicateDataRequest& operator=(const ReplicateDataRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicateDataRequest& operator=(ReplicateDataRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicateDataRequest& default_instance() {
+    return *reinterpret_cast<const ReplicateDataRequest*>(
+        &_ReplicateDataRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 4;
+  friend void swap(ReplicateDataRequest& a, ReplicateDataRequest& b) { a.Swap(&b); }
+  inline void Swap(ReplicateDataRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicateDataRequest* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicateDataRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReplicateDataRequest>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(ReplicateDataRequest* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "dht.ReplicateDataRequest"; }
+
+  explicit ReplicateDataRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReplicateDataRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicateDataRequest& from);
+  ReplicateDataRequest(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicateDataRequest&& from) noexcept
+      : ReplicateDataRequest(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kEntryFieldNumber = 1,
+  };
+  // .dht.DataEntry entry = 1;
+  bool has_entry() const;
+  void clear_entry() ;
+  const ::dht::DataEntry& entry() const;
+  [[nodiscard]] ::dht::DataEntry* PROTOBUF_NULLABLE release_entry();
+  ::dht::DataEntry* PROTOBUF_NONNULL mutable_entry();
+  void set_allocated_entry(::dht::DataEntry* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_entry(::dht::DataEntry* PROTOBUF_NULLABLE value);
+  ::dht::DataEntry* PROTOBUF_NULLABLE unsafe_arena_release_entry();
+
+  private:
+  const ::dht::DataEntry& _internal_entry() const;
+  ::dht::DataEntry* PROTOBUF_NONNULL _internal_mutable_entry();
+
+  public:
+  // @@protoc_insertion_point(class_scope:dht.ReplicateDataRequest)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const ReplicateDataRequest& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::google::protobuf::internal::ArenaStringPtr host_;
-    ::google::protobuf::internal::ArenaStringPtr nattype_;
-    ::google::protobuf::internal::ArenaStringPtr protocolversion_;
-    ::dht::ConnectivityMethod* PROTOBUF_NULLABLE websocket_;
-    double latitude_;
-    double longitude_;
-    ::uint32_t ipaddress_;
+    ::dht::DataEntry* PROTOBUF_NULLABLE entry_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ConnectivityResponse_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicateDataRequest_class_data_;
 // -------------------------------------------------------------------
 
-class ReplicateDataRequest final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:dht.ReplicateDataRequest) */ {
+class ReplicateDataBatch final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:dht.ReplicateDataBatch) */ {
  public:
-  inline ReplicateDataRequest() : ReplicateDataRequest(nullptr) {}
-  ~ReplicateDataRequest() PROTOBUF_FINAL;
+  inline ReplicateDataBatch() : ReplicateDataBatch(nullptr) {}
+  ~ReplicateDataBatch() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(ReplicateDataRequest* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+  void operator delete(ReplicateDataBatch* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicateDataRequest));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(ReplicateDataBatch));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR ReplicateDataRequest(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ReplicateDataBatch(::google::protobuf::internal::ConstantInitialized);
 
-  inline ReplicateDataRequest(const ReplicateDataRequest& from) : ReplicateDataRequest(nullptr, from) {}
-  inline ReplicateDataRequest(ReplicateDataRequest&& from) noexcept
-      : ReplicateDataRequest(nullptr, ::std::move(from)) {}
-  inline ReplicateDataRequest& operator=(const ReplicateDataRequest& from) {
+  inline ReplicateDataBatch(const ReplicateDataBatch& from) : ReplicateDataBatch(nullptr, from) {}
+  inline ReplicateDataBatch(ReplicateDataBatch&& from) noexcept
+      : ReplicateDataBatch(nullptr, ::std::move(from)) {}
+  inline ReplicateDataBatch& operator=(const ReplicateDataBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ReplicateDataRequest& operator=(ReplicateDataRequest&& from) noexcept {
+  inline ReplicateDataBatch& operator=(ReplicateDataBatch&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -5283,13 +5964,13 @@ class ReplicateDataRequest final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ReplicateDataRequest& default_instance() {
-    return *reinterpret_cast<const ReplicateDataRequest*>(
-        &_ReplicateDataRequest_default_instance_);
+  static const ReplicateDataBatch& default_instance() {
+    return *reinterpret_cast<const ReplicateDataBatch*>(
+        &_ReplicateDataBatch_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 4;
-  friend void swap(ReplicateDataRequest& a, ReplicateDataRequest& b) { a.Swap(&b); }
-  inline void Swap(ReplicateDataRequest* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 38;
+  friend void swap(ReplicateDataBatch& a, ReplicateDataBatch& b) { a.Swap(&b); }
+  inline void Swap(ReplicateDataBatch* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -5297,7 +5978,7 @@ class ReplicateDataRequest final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ReplicateDataRequest* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(ReplicateDataBatch* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -5305,25 +5986,25 @@ class ReplicateDataRequest final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  ReplicateDataRequest* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<ReplicateDataRequest>(arena);
+  ReplicateDataBatch* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<ReplicateDataBatch>(arena);
   }
   int GetCachedSize() const { return _impl_._cached_size_.Get(); }
 
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(ReplicateDataRequest* PROTOBUF_NONNULL other);
+  void InternalSwap(ReplicateDataBatch* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "dht.ReplicateDataRequest"; }
+  static ::absl::string_view FullMessageName() { return "dht.ReplicateDataBatch"; }
 
-  explicit ReplicateDataRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  ReplicateDataRequest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicateDataRequest& from);
-  ReplicateDataRequest(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicateDataRequest&& from) noexcept
-      : ReplicateDataRequest(arena) {
+  explicit ReplicateDataBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  ReplicateDataBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const ReplicateDataBatch& from);
+  ReplicateDataBatch(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, ReplicateDataBatch&& from) noexcept
+      : ReplicateDataBatch(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -5340,24 +6021,26 @@ class ReplicateDataRequest final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kEntryFieldNumber = 1,
+    kEntriesFieldNumber = 1,
   };
-  // .dht.DataEntry entry = 1;
-  bool has_entry() const;
-  void clear_entry() ;
-  const ::dht::DataEntry& entry() const;
-  [[nodiscard]] ::dht::DataEntry* PROTOBUF_NULLABLE release_entry();
-  ::dht::DataEntry* PROTOBUF_NONNULL mutable_entry();
-  void set_allocated_entry(::dht::DataEntry* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_entry(::dht::DataEntry* PROTOBUF_NULLABLE value);
-  ::dht::DataEntry* PROTOBUF_NULLABLE unsafe_arena_release_entry();
-
+  // repeated .dht.DataEntry entries = 1;
+  int entries_size() const;
   private:
-  const ::dht::DataEntry& _internal_entry() const;
-  ::dht::DataEntry* PROTOBUF_NONNULL _internal_mutable_entry();
+  int _internal_entries_size() const;
 
   public:
-  // @@protoc_insertion_point(class_scope:dht.ReplicateDataRequest)
+  void clear_entries() ;
+  ::dht::DataEntry* PROTOBUF_NONNULL mutable_entries(int index);
+  ::google::protobuf::RepeatedPtrField<::dht::DataEntry>* PROTOBUF_NONNULL mutable_entries();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::dht::DataEntry>& _internal_entries() const;
+  ::google::protobuf::RepeatedPtrField<::dht::DataEntry>* PROTOBUF_NONNULL _internal_mutable_entries();
+  public:
+  const ::dht::DataEntry& entries(int index) const;
+  ::dht::DataEntry* PROTOBUF_NONNULL add_entries();
+  const ::google::protobuf::RepeatedPtrField<::dht::DataEntry>& entries() const;
+  // @@protoc_insertion_point(class_scope:dht.ReplicateDataBatch)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
@@ -5380,17 +6063,17 @@ class ReplicateDataRequest final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const ReplicateDataRequest& from_msg);
+        const ReplicateDataBatch& from_msg);
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
-    ::dht::DataEntry* PROTOBUF_NULLABLE entry_;
+    ::google::protobuf::RepeatedPtrField< ::dht::DataEntry > entries_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull ReplicateDataRequest_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull ReplicateDataBatch_class_data_;
 // -------------------------------------------------------------------
 
 class RecursiveOperationResponse final : public ::google::protobuf::Message
@@ -13933,6 +14616,296 @@ ExternalFindClosestNodesResponse::_internal_mutable_closestnodes() {
   return &_impl_.closestnodes_;
 }
 
+// -------------------------------------------------------------------
+
+// ReplicateDataBatch
+
+// repeated .dht.DataEntry entries = 1;
+inline int ReplicateDataBatch::_internal_entries_size() const {
+  return _internal_entries().size();
+}
+inline int ReplicateDataBatch::entries_size() const {
+  return _internal_entries_size();
+}
+inline void ReplicateDataBatch::clear_entries() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.entries_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::dht::DataEntry* PROTOBUF_NONNULL ReplicateDataBatch::mutable_entries(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:dht.ReplicateDataBatch.entries)
+  return _internal_mutable_entries()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::dht::DataEntry>* PROTOBUF_NONNULL ReplicateDataBatch::mutable_entries()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:dht.ReplicateDataBatch.entries)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_entries();
+}
+inline const ::dht::DataEntry& ReplicateDataBatch::entries(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:dht.ReplicateDataBatch.entries)
+  return _internal_entries().Get(index);
+}
+inline ::dht::DataEntry* PROTOBUF_NONNULL ReplicateDataBatch::add_entries()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::dht::DataEntry* _add =
+      _internal_mutable_entries()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:dht.ReplicateDataBatch.entries)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::dht::DataEntry>& ReplicateDataBatch::entries() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:dht.ReplicateDataBatch.entries)
+  return _internal_entries();
+}
+inline const ::google::protobuf::RepeatedPtrField<::dht::DataEntry>&
+ReplicateDataBatch::_internal_entries() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.entries_;
+}
+inline ::google::protobuf::RepeatedPtrField<::dht::DataEntry>* PROTOBUF_NONNULL
+ReplicateDataBatch::_internal_mutable_entries() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// ReplicaDigest
+
+// bytes key = 1;
+inline void ReplicaDigest::clear_key() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.key_.ClearToEmpty();
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline const ::std::string& ReplicaDigest::key() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:dht.ReplicaDigest.key)
+  return _internal_key();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void ReplicaDigest::set_key(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  _impl_.key_.SetBytes(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:dht.ReplicaDigest.key)
+}
+inline ::std::string* PROTOBUF_NONNULL ReplicaDigest::mutable_key()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  ::std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:dht.ReplicaDigest.key)
+  return _s;
+}
+inline const ::std::string& ReplicaDigest::_internal_key() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.key_.Get();
+}
+inline void ReplicaDigest::_internal_set_key(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.key_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL ReplicaDigest::_internal_mutable_key() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _impl_.key_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE ReplicaDigest::release_key() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:dht.ReplicaDigest.key)
+  if (!CheckHasBit(_impl_._has_bits_[0], 0x00000001U)) {
+    return nullptr;
+  }
+  ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  auto* released = _impl_.key_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.key_.Set("", GetArena());
+  }
+  return released;
+}
+inline void ReplicaDigest::set_allocated_key(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    SetHasBit(_impl_._has_bits_[0], 0x00000001U);
+  } else {
+    ClearHasBit(_impl_._has_bits_[0], 0x00000001U);
+  }
+  _impl_.key_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:dht.ReplicaDigest.key)
+}
+
+// fixed64 digest = 2;
+inline void ReplicaDigest::clear_digest() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.digest_ = ::uint64_t{0u};
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000002U);
+}
+inline ::uint64_t ReplicaDigest::digest() const {
+  // @@protoc_insertion_point(field_get:dht.ReplicaDigest.digest)
+  return _internal_digest();
+}
+inline void ReplicaDigest::set_digest(::uint64_t value) {
+  _internal_set_digest(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000002U);
+  // @@protoc_insertion_point(field_set:dht.ReplicaDigest.digest)
+}
+inline ::uint64_t ReplicaDigest::_internal_digest() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.digest_;
+}
+inline void ReplicaDigest::_internal_set_digest(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.digest_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ReplicaDigests
+
+// repeated .dht.ReplicaDigest digests = 1;
+inline int ReplicaDigests::_internal_digests_size() const {
+  return _internal_digests().size();
+}
+inline int ReplicaDigests::digests_size() const {
+  return _internal_digests_size();
+}
+inline void ReplicaDigests::clear_digests() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.digests_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::dht::ReplicaDigest* PROTOBUF_NONNULL ReplicaDigests::mutable_digests(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:dht.ReplicaDigests.digests)
+  return _internal_mutable_digests()->Mutable(index);
+}
+inline ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>* PROTOBUF_NONNULL ReplicaDigests::mutable_digests()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:dht.ReplicaDigests.digests)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_digests();
+}
+inline const ::dht::ReplicaDigest& ReplicaDigests::digests(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:dht.ReplicaDigests.digests)
+  return _internal_digests().Get(index);
+}
+inline ::dht::ReplicaDigest* PROTOBUF_NONNULL ReplicaDigests::add_digests()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::dht::ReplicaDigest* _add =
+      _internal_mutable_digests()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:dht.ReplicaDigests.digests)
+  return _add;
+}
+inline const ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>& ReplicaDigests::digests() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:dht.ReplicaDigests.digests)
+  return _internal_digests();
+}
+inline const ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>&
+ReplicaDigests::_internal_digests() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.digests_;
+}
+inline ::google::protobuf::RepeatedPtrField<::dht::ReplicaDigest>* PROTOBUF_NONNULL
+ReplicaDigests::_internal_mutable_digests() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.digests_;
+}
+
+// -------------------------------------------------------------------
+
+// ReplicaKeys
+
+// repeated bytes keys = 1;
+inline int ReplicaKeys::_internal_keys_size() const {
+  return _internal_keys().size();
+}
+inline int ReplicaKeys::keys_size() const {
+  return _internal_keys_size();
+}
+inline void ReplicaKeys::clear_keys() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.keys_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::std::string* PROTOBUF_NONNULL ReplicaKeys::add_keys()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::std::string* _s =
+      _internal_mutable_keys()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add_mutable:dht.ReplicaKeys.keys)
+  return _s;
+}
+inline const ::std::string& ReplicaKeys::keys(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:dht.ReplicaKeys.keys)
+  return _internal_keys().Get(index);
+}
+inline ::std::string* PROTOBUF_NONNULL ReplicaKeys::mutable_keys(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:dht.ReplicaKeys.keys)
+  return _internal_mutable_keys()->Mutable(index);
+}
+template <typename Arg_, typename... Args_>
+inline void ReplicaKeys::set_keys(int index, Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::AssignToString(*_internal_mutable_keys()->Mutable(index), ::std::forward<Arg_>(value),
+                        args... , ::google::protobuf::internal::BytesTag{});
+  // @@protoc_insertion_point(field_set:dht.ReplicaKeys.keys)
+}
+template <typename Arg_, typename... Args_>
+inline void ReplicaKeys::add_keys(Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::google::protobuf::internal::AddToRepeatedPtrField(
+      ::google::protobuf::MessageLite::internal_visibility(), GetArena(),
+      *_internal_mutable_keys(), ::std::forward<Arg_>(value),
+      args... , ::google::protobuf::internal::BytesTag{});
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:dht.ReplicaKeys.keys)
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>& ReplicaKeys::keys()
+    const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:dht.ReplicaKeys.keys)
+  return _internal_keys();
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ReplicaKeys::mutable_keys() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:dht.ReplicaKeys.keys)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_keys();
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>&
+ReplicaKeys::_internal_keys() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.keys_;
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+ReplicaKeys::_internal_mutable_keys() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.keys_;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -0,0 +1,104 @@
+// Microbenchmark: the KBucket routing table as PeerManager uses it, sized
+// like an entry point's large neighborhood — 100k contacts are offered
+// (most land in a full bucket and only trigger a ping), 100k closest
+// queries run against the filled table, and 100k removals empty it. Not
+// registered with ctest; run the binary directly (a Release build gives
+// meaningful numbers).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "BenchmarkReport.hpp"
+
+import streamr.dht.Identifiers;
+import streamr.dht.KBucket;
+
+using streamr::dht::DhtAddressRaw;
+using streamr::dht::kademliaIdLengthInBytes;
+using streamr::dht::contact::KBucket;
+using streamr::dht::contact::KBucketOptions;
+using streamr::utils::benchmark::note;
+using streamr::utils::benchmark::report;
+
+namespace {
+
+constexpr size_t operationCount = 100000;
+constexpr size_t nodesPerKBucket = 256;
+constexpr size_t closestCount = 20;
+constexpr uint32_t rngSeed = 42;
+
+struct Contact {
+    DhtAddressRaw id;
+    [[nodiscard]] DhtAddressRaw getId() const { return this->id; }
+    [[nodiscard]] int64_t getVectorClock() const { return 0; }
+};
+
+DhtAddressRaw randomId(std::mt19937& rng) {
+    std::string raw(kademliaIdLengthInBytes, '\0');
+    for (auto& byte : raw) {
+        byte = static_cast<char>(rng());
+    }
+    return DhtAddressRaw{raw};
+}
+
+template <typename Fn>
+double measure(Fn fn) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+TEST(KBucketBenchmark, InsertClosestRemove) {
+    std::mt19937 rng(rngSeed);
+    KBucket<Contact> table(
+        KBucketOptions{
+            .localNodeId = randomId(rng),
+            .numberOfNodesPerKBucket = nodesPerKBucket});
+    std::vector<std::shared_ptr<Contact>> contacts;
+    contacts.reserve(operationCount);
+    for (size_t i = 0; i < operationCount; ++i) {
+        contacts.push_back(
+            std::make_shared<Contact>(Contact{.id = randomId(rng)}));
+    }
+
+    const double insertSeconds = measure([&table, &contacts]() {
+        for (const auto& contact : contacts) {
+            table.add(contact);
+        }
+    });
+    report("insert", operationCount, "operations", insertSeconds);
+    const size_t stored = table.count();
+    note("table holds " + std::to_string(stored) + " contacts");
+
+    std::vector<DhtAddressRaw> targets;
+    targets.reserve(operationCount);
+    for (size_t i = 0; i < operationCount; ++i) {
+        targets.push_back(randomId(rng));
+    }
+    size_t found = 0;
+    const double closestSeconds = measure([&table, &targets, &found]() {
+        for (const auto& target : targets) {
+            found += table.closest(target, closestCount).size();
+        }
+    });
+    report("closest", operationCount, "operations", closestSeconds);
+    EXPECT_EQ(found, operationCount * std::min(closestCount, stored));
+
+    const double removeSeconds = measure([&table, &contacts]() {
+        for (const auto& contact : contacts) {
+            table.remove(contact->getId());
+        }
+    });
+    report("remove", operationCount, "operations", removeSeconds);
+    EXPECT_EQ(table.count(), 0U);
+}
@@ -0,0 +1,115 @@
+// Microbenchmark: SortedContactList as recursive-operation and routing
+// sessions use it — each lookup builds a bounded list toward a random
+// target from thousands of candidate contacts, and an unbounded one is
+// churned with removals and membership checks. Not registered with
+// ctest; run the binary directly (a Release build gives meaningful
+// numbers).
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "BenchmarkReport.hpp"
+
+import streamr.dht.Identifiers;
+import streamr.dht.SortedContactList;
+
+using streamr::dht::DhtAddress;
+using streamr::dht::DhtAddressRaw;
+using streamr::dht::Identifiers;
+using streamr::dht::kademliaIdLengthInBytes;
+using streamr::dht::contact::SortedContactList;
+using streamr::dht::contact::SortedContactListOptions;
+using streamr::utils::benchmark::report;
+
+namespace {
+
+constexpr size_t candidateCount = 5000;
+constexpr size_t sessionCount = 200;
+constexpr size_t resultsMaxSize = 10;
+constexpr uint32_t rngSeed = 42;
+
+struct Contact {
+    DhtAddress nodeId;
+    [[nodiscard]] DhtAddress getNodeId() const { return this->nodeId; }
+};
+
+DhtAddress randomId(std::mt19937& rng) {
+    std::string raw(kademliaIdLengthInBytes, '\0');
+    for (auto& byte : raw) {
+        byte = static_cast<char>(rng());
+    }
+    return Identifiers::getDhtAddressFromRaw(DhtAddressRaw{raw});
+}
+
+std::vector<std::shared_ptr<Contact>> createCandidates(std::mt19937& rng) {
+    std::vector<std::shared_ptr<Contact>> candidates;
+    candidates.reserve(candidateCount);
+    for (size_t i = 0; i < candidateCount; ++i) {
+        candidates.push_back(
+            std::make_shared<Contact>(Contact{.nodeId = randomId(rng)}));
+    }
+    return candidates;
+}
+
+} // namespace
+
+TEST(SortedContactListBenchmark, BoundedLookupResults) {
+    std::mt19937 rng(rngSeed);
+    const auto candidates = createCandidates(rng);
+    size_t kept = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t session = 0; session < sessionCount; ++session) {
+        SortedContactList<Contact> results(SortedContactListOptions{
+            .referenceId = randomId(rng),
+            .allowToContainReferenceId = true,
+            .maxSize = resultsMaxSize});
+        results.addContacts(candidates);
+        kept += results.getClosestContacts().size();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    report(
+        "bounded lookup results",
+        sessionCount * candidateCount,
+        "operations",
+        elapsed.count());
+    EXPECT_EQ(kept, sessionCount * resultsMaxSize);
+}
+
+TEST(SortedContactListBenchmark, UnboundedChurn) {
+    std::mt19937 rng(rngSeed);
+    const auto candidates = createCandidates(rng);
+    constexpr size_t rounds = 10;
+    size_t operations = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round) {
+        SortedContactList<Contact> contacts(SortedContactListOptions{
+            .referenceId = randomId(rng),
+            .allowToContainReferenceId = false,
+            .maxSize = std::nullopt});
+        contacts.addContacts(candidates);
+        for (size_t i = 0; i < candidates.size(); i += 2) {
+            contacts.removeContact(candidates[i]->getNodeId());
+        }
+        for (const auto& candidate : candidates) {
+            if (contacts.has(candidate->getNodeId())) {
+                contacts.removeContact(candidate->getNodeId());
+            }
+        }
+        EXPECT_EQ(contacts.getSize(), 0U);
+        operations += candidates.size() * 3;
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    report(
+        "unbounded add/remove/has churn",
+        operations,
+        "operations",
+        elapsed.count());
+}
@@ -9,14 +9,20 @@
 // The TS file's other cases exercise the websocket connectors
 // (connectivity checking, server start, nodeId validation) and are
 // ported in milestone B (trackerless-network-completion-plan.md).
+//
+// Native-only: garbage collection evicts the idle unlocked connections
+// above the limit and keeps the locked one.
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <vector>
 #include <gtest/gtest.h>
 #include "packages/dht/protos/DhtRpc.pb.h"
 
 #include <coroutine> // IWYU pragma: keep
 
+import streamr.dht.ConnectionLockStates;
 import streamr.dht.Identifiers;
 import streamr.dht.Simulator;
 import streamr.dht.SimulatorTransport;
@@ -27,6 +33,8 @@ import streamr.utils.waitForCondition;
 
 using ::dht::Message;
 using ::dht::PeerDescriptor;
+using streamr::dht::Identifiers;
+using streamr::dht::connection::LockID;
 using streamr::dht::connection::simulator::Simulator;
 using streamr::dht::connection::simulator::SimulatorTransport;
 using streamr::dht::testutils::createMockPeerDescriptor;
@@ -117,3 +125,57 @@ TEST(
     connectionManager4->stop();
     simulator2.stop();
 }
+
+TEST(
+    ConnectionManagerIntegrationTest,
+    GarbageCollectionEvictsIdleUnlockedConnections) {
+    constexpr size_t peerCount = 3;
+    Simulator simulator;
+    const auto hubPeerDescriptor = createMockPeerDescriptor();
+    auto hub =
+        std::make_shared<SimulatorTransport>(hubPeerDescriptor, simulator);
+    hub->start();
+    std::vector<PeerDescriptor> peerDescriptors;
+    std::vector<std::shared_ptr<SimulatorTransport>> peers;
+    for (size_t i = 0; i < peerCount; ++i) {
+        peerDescriptors.push_back(createMockPeerDescriptor());
+        peers.push_back(
+            std::make_shared<SimulatorTransport>(
+                peerDescriptors.back(), simulator));
+        peers.back()->start();
+    }
+
+    for (const auto& peerDescriptor : peerDescriptors) {
+        Message msg;
+        msg.set_serviceid(serviceId);
+        msg.set_messageid(Identifiers::getNodeIdFromPeerDescriptor(
+            peerDescriptor));
+        msg.mutable_rpcmessage();
+        msg.mutable_targetdescriptor()->CopyFrom(peerDescriptor);
+        hub->send(msg, SendOptions{});
+    }
+    expectCondition("all connected", [&hub]() {
+        return hub->getConnectionCount() == peerCount;
+    });
+
+    const auto lockedNodeId =
+        Identifiers::getNodeIdFromPeerDescriptor(peerDescriptors.front());
+    hub->weakLockConnection(lockedNodeId, LockID{"gc-test"});
+
+    // Every connection was used just now.
+    EXPECT_EQ(hub->garbageCollectConnections(1, std::chrono::hours(1)), 0U);
+    EXPECT_EQ(
+        hub->garbageCollectConnections(1, std::chrono::milliseconds(0)),
+        peerCount - 1);
+    EXPECT_EQ(hub->getEvictedConnectionCount(), peerCount - 1);
+    expectCondition("idle connections evicted", [&hub]() {
+        return hub->getConnectionCount() == 1;
+    });
+    EXPECT_TRUE(hub->hasConnection(lockedNodeId));
+
+    hub->stop();
+    for (const auto& peer : peers) {
+        peer->stop();
+    }
+    simulator.stop();
+}
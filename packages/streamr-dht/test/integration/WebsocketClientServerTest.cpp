@@ -5,12 +5,14 @@
 #include <rtc/global.hpp>
 
 import streamr.dht.Connection;
+import streamr.dht.SendBuffer;
 import streamr.dht.Transport;
 import streamr.dht.WebsocketClientConnection;
 import streamr.dht.WebsocketServer;
 import streamr.dht.WebsocketServerConnection;
 import streamr.logger.SLogger;
 
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::connectionevents::Connected;
 using streamr::dht::connection::connectionevents::Data;
 using streamr::dht::connection::websocket::WebsocketClientConnection;
@@ -94,7 +96,7 @@ TEST(WebsocketClientServerTest, TestClientCanTrasmitMessageToServer) {
 
     client->on<streamr::dht::connection::connectionevents::Connected>([&]() {
         SLogger::trace("in client onConnected() event handler");
-        client->send(message);
+        client->send(SendBuffer(message));
     });
 
     client->connect("ws://127.0.0.1:10001", false); // NOLINT
@@ -141,7 +143,7 @@ TEST(WebsocketClientServerTest, TestServerClientRoundTripMessageExchange) {
                 [&](const std::vector<std::byte>& message) {
                     serverReceivedPromise.set_value(message);
                 });
-            serverConnection->send(payload);
+            serverConnection->send(SendBuffer(payload));
         });
 
     server.start();
@@ -150,7 +152,7 @@ TEST(WebsocketClientServerTest, TestServerClientRoundTripMessageExchange) {
     client->on<Data>([&](const std::vector<std::byte>& message) {
         clientReceivedPromise.set_value(message);
         // Echo the payload back to the server.
-        client->send(message);
+        client->send(SendBuffer(message));
     });
 
     client->connect("ws://127.0.0.1:" + std::to_string(roundTripPort), false);
@@ -9,6 +9,9 @@
 // the topology and returning its closest neighbours — exactly as the TS
 // Partial<DhtNodeRpcRemote> mock does. createTestTopology is ported here from
 // test/utils/topology.ts.
+//
+// The native-only tests check the hedging of a slow contact and the early
+// stop on a stable closest set.
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
@@ -36,6 +39,7 @@ import streamr.dht.DiscoverySession;
 import streamr.dht.getClosestNodes;
 import streamr.dht.getPeerDistance;
 import streamr.dht.Identifiers;
+import streamr.dht.LookupLatencyTracker;
 import streamr.dht.PeerManager;
 import streamr.dht.protos;
 import streamr.dht.TestUtils;
@@ -54,7 +58,10 @@ using streamr::dht::contact::getClosestNodes;
 using streamr::dht::contact::GetClosestNodesOptions;
 using streamr::dht::discovery::DiscoverySession;
 using streamr::dht::discovery::DiscoverySessionOptions;
+using streamr::dht::discovery::LookupLatencyTracker;
+using streamr::dht::discovery::LookupLatencyTrackerOptions;
 using streamr::dht::helpers::getPeerDistance;
+using streamr::dht::helpers::PeerDistance;
 using streamr::dht::rpcprotocol::DhtCallContext;
 using streamr::dht::testutils::createMockPeerDescriptor;
 using streamr::protorpc::RpcCommunicator;
@@ -74,6 +81,8 @@ constexpr size_t numberOfNodesPerKBucket = 8;
 constexpr size_t maxContactCount = 200;
 constexpr std::chrono::milliseconds queryDelay{10};
 constexpr std::chrono::milliseconds discoverySessionTimeout{1000};
+constexpr std::chrono::milliseconds slowQueryDelay{5000};
+constexpr std::chrono::milliseconds hedgeDelay{50};
 
 // A Multimap<DhtAddress, DhtAddress> from the TS test: node id -> its
 // neighbours (a set, so edges are naturally deduplicated).
@@ -172,7 +181,7 @@ Topology createTestTopology(size_t count, size_t minNeighbors) {
         }
         std::optional<DhtAddress> mergeFrom;
         std::optional<DhtAddress> mergeTo;
-        double bestDistance = 0;
+        PeerDistance bestDistance;
         for (const auto& nodeId : nodeIds) {
             const auto& ownPartition = *std::ranges::find_if(
                 partitions, [&nodeId](const std::set<DhtAddress>& partition) {
@@ -188,7 +197,7 @@ Topology createTestTopology(size_t count, size_t minNeighbors) {
             if (closestOther.empty()) {
                 continue;
             }
-            const double distance = getPeerDistance(
+            const PeerDistance distance = getPeerDistance(
                 Identifiers::getRawFromDhtAddress(nodeId),
                 Identifiers::getRawFromDhtAddress(closestOther.front()));
             if (!mergeFrom.has_value() || distance < bestDistance) {
@@ -211,6 +220,8 @@ protected:
     Topology topology;
     std::shared_ptr<std::vector<DhtAddress>> queriedNodes =
         std::make_shared<std::vector<DhtAddress>>();
+    // Nodes that answer after slowQueryDelay instead of queryDelay.
+    std::set<DhtAddress> slowNodes;
 
     void SetUp() override {
         this->mockCommunicator.setOutgoingMessageCallback(
@@ -227,6 +238,7 @@ protected:
         std::shared_ptr<std::vector<DhtAddress>> queriedNodes;
         std::function<std::vector<PeerDescriptor>(const DhtAddress&)>
             getClosest;
+        std::chrono::milliseconds delay;
 
     public:
         MockDhtNodeRpcRemote(
@@ -235,19 +247,21 @@ protected:
             DhtNodeRpcClient client,
             std::shared_ptr<std::vector<DhtAddress>> queriedNodes,
             std::function<std::vector<PeerDescriptor>(const DhtAddress&)>
-                getClosest)
+                getClosest,
+            std::chrono::milliseconds delay)
             : DhtNodeRpcRemote(
                   std::move(localPeerDescriptor),
                   std::move(remotePeerDescriptor),
                   ServiceID{"mock"},
                   client),
               queriedNodes(std::move(queriedNodes)),
-              getClosest(std::move(getClosest)) {}
+              getClosest(std::move(getClosest)),
+              delay(delay) {}
 
         folly::coro::Task<std::vector<PeerDescriptor>> getClosestPeers(
             const DhtAddress& referenceId) override {
             this->queriedNodes->push_back(this->getNodeId());
-            co_await folly::coro::sleep(queryDelay);
+            co_await folly::coro::sleep(this->delay);
             co_return this->getClosest(referenceId);
         }
 
@@ -283,7 +297,8 @@ protected:
             peerDescriptor,
             DhtNodeRpcClient(this->mockCommunicator),
             this->queriedNodes,
-            std::move(getClosest));
+            std::move(getClosest),
+            this->slowNodes.contains(nodeId) ? slowQueryDelay : queryDelay);
     }
 
     std::shared_ptr<PeerManager> createPeerManager(
@@ -308,14 +323,19 @@ protected:
         }
         return peerManager;
     }
+
+    [[nodiscard]] std::vector<DhtAddress> getNodeIds() const {
+        std::vector<DhtAddress> nodeIds;
+        nodeIds.reserve(this->topology.size());
+        for (const auto& [nodeId, neighbors] : this->topology) {
+            nodeIds.push_back(nodeId);
+        }
+        return nodeIds;
+    }
 };
 
 TEST_F(DiscoverySessionTest, HappyPath) {
-    std::vector<DhtAddress> nodeIds;
-    nodeIds.reserve(this->topology.size());
-    for (const auto& [nodeId, neighbors] : this->topology) {
-        nodeIds.push_back(nodeId);
-    }
+    const auto nodeIds = this->getNodeIds();
     ASSERT_GE(nodeIds.size(), 2U);
     const auto localNodeId = nodeIds.front();
     const auto targetId = nodeIds.at(nodeIds.size() / 2);
@@ -342,7 +362,7 @@ TEST_F(DiscoverySessionTest, HappyPath) {
     // Each queried node is strictly closer to the target than the previous one
     // (parallelism 1, noProgressLimit 1 make the walk monotonic).
     const auto targetRaw = Identifiers::getRawFromDhtAddress(targetId);
-    std::vector<double> distances;
+    std::vector<PeerDistance> distances;
     distances.reserve(this->queriedNodes->size());
     for (const auto& queried : *this->queriedNodes) {
         distances.push_back(getPeerDistance(
@@ -353,3 +373,82 @@ TEST_F(DiscoverySessionTest, HappyPath) {
     }
     peerManager->stop();
 }
+
+TEST_F(DiscoverySessionTest, HedgesSlowRequest) {
+    const auto nodeIds = this->getNodeIds();
+    const auto localNodeId = nodeIds.front();
+    const auto targetId = nodeIds.at(nodeIds.size() / 2);
+    // The first node queried is the local node's neighbour closest to the
+    // target; make it stall.
+    std::vector<PeerDescriptor> neighbors;
+    for (const auto& neighbor : this->topology[localNodeId]) {
+        neighbors.push_back(createPeerDescriptor(neighbor));
+    }
+    const auto slowNodeId = Identifiers::getNodeIdFromPeerDescriptor(
+        getClosestNodes(
+            targetId, neighbors, GetClosestNodesOptions{.maxCount = 1})
+            .front());
+    this->slowNodes.insert(slowNodeId);
+
+    std::set<DhtAddress> contactedPeers;
+    const auto peerManager = this->createPeerManager(localNodeId);
+    AbortController abortController;
+    DiscoverySession session(
+        DiscoverySessionOptions{
+            .targetId = targetId,
+            .parallelism = parallelism,
+            .noProgressLimit = noProgressLimit,
+            .peerManager = *peerManager,
+            .contactedPeers = contactedPeers,
+            .abortSignal = abortController.getSignal(),
+            .createDhtNodeRpcRemote =
+                [this](const PeerDescriptor& peerDescriptor) {
+                    return this->createMockRpcRemote(peerDescriptor);
+                },
+            .latencyTracker = std::make_shared<LookupLatencyTracker>(
+                LookupLatencyTrackerOptions{.defaultHedgeDelay = hedgeDelay}),
+            .maxHedgedRequests = 1});
+
+    blockingWait(session.findClosestNodes(discoverySessionTimeout));
+
+    ASSERT_GE(this->queriedNodes->size(), 2U);
+    EXPECT_EQ(this->queriedNodes->front(), slowNodeId);
+    const auto stats = session.getStats();
+    EXPECT_EQ(stats.hedgedRequestCount, 1U);
+    EXPECT_EQ(stats.requestCount, this->queriedNodes->size());
+    EXPECT_GE(stats.hopCount, 1U);
+    // The lookup went on without the slow node (and did not wait for it).
+    EXPECT_LT(stats.duration, slowQueryDelay);
+    peerManager->stop();
+}
+
+TEST_F(DiscoverySessionTest, StopsWhenClosestSetIsStable) {
+    const auto nodeIds = this->getNodeIds();
+    const auto localNodeId = nodeIds.front();
+    const auto targetId = nodeIds.at(nodeIds.size() / 2);
+
+    std::set<DhtAddress> contactedPeers;
+    const auto peerManager = this->createPeerManager(localNodeId);
+    AbortController abortController;
+    DiscoverySession session(
+        DiscoverySessionOptions{
+            .targetId = targetId,
+            .parallelism = parallelism,
+            .noProgressLimit = nodeCount,
+            .peerManager = *peerManager,
+            .contactedPeers = contactedPeers,
+            .abortSignal = abortController.getSignal(),
+            .createDhtNodeRpcRemote =
+                [this](const PeerDescriptor& peerDescriptor) {
+                    return this->createMockRpcRemote(peerDescriptor);
+                },
+            .closestSetSize = minNeighborCount});
+
+    blockingWait(session.findClosestNodes(discoverySessionTimeout));
+
+    const auto stats = session.getStats();
+    EXPECT_TRUE(stats.stoppedEarly);
+    EXPECT_LT(stats.requestCount, nodeCount);
+    EXPECT_EQ(stats.failedRequestCount, 0U);
+    peerManager->stop();
+}
@@ -1,9 +1,12 @@
+#include <cstddef>
 #include <format>
 #include <gtest/gtest.h>
 
 import streamr.dht.DuplicateDetector;
 
 using streamr::dht::routing::DuplicateDetector;
+using streamr::dht::routing::DuplicateDetectorMode;
+using streamr::dht::routing::DuplicateDetectorOptions;
 
 class DuplicateDetectorTest : public ::testing::Test {
 protected:
@@ -39,3 +42,53 @@ TEST_F(DuplicateDetectorTest, RemovesFromTailWhenFull) {
     EXPECT_FALSE(detector.isMostLikelyDuplicate("test0"));
     EXPECT_TRUE(detector.isMostLikelyDuplicate("test10"));
 }
+
+TEST_F(DuplicateDetectorTest, ValueAddedTwiceSurvivesEvictionOfFirstCopy) {
+    DuplicateDetector detector(maxValueCount);
+    detector.add("repeated");
+    for (int i = 0; i < maxValueCount - 2; i++) {
+        detector.add(std::format("test{}", i));
+    }
+    detector.add("repeated");
+    // Evicts the first copy of "repeated"; the second is still in the window.
+    detector.add("test-last");
+    EXPECT_TRUE(detector.isMostLikelyDuplicate("repeated"));
+    EXPECT_EQ(detector.size(), static_cast<size_t>(maxValueCount));
+}
+
+TEST_F(DuplicateDetectorTest, ClearForgetsEverything) {
+    DuplicateDetector detector(maxValueCount);
+    for (int i = 0; i < maxValueCount * 3; i++) {
+        detector.add(std::format("test{}", i));
+    }
+    detector.clear();
+    EXPECT_EQ(detector.size(), 0);
+    EXPECT_FALSE(detector.isMostLikelyDuplicate("test29"));
+    detector.add("test");
+    EXPECT_TRUE(detector.isMostLikelyDuplicate("test"));
+}
+
+TEST_F(DuplicateDetectorTest, ProbabilisticModeRemembersRecentWindow) {
+    constexpr int windowSize = 10000;
+    DuplicateDetector detector(DuplicateDetectorOptions{
+        .maxItemCount = windowSize,
+        .mode = DuplicateDetectorMode::Probabilistic,
+        .falsePositiveRate = 0.001});
+    for (int i = 0; i < windowSize * 2; i++) {
+        detector.add(std::format("request-{}", i));
+    }
+    // The newest half of the window is always remembered (bloom filters
+    // have no false negatives).
+    for (int i = windowSize * 3 / 2; i < windowSize * 2; i++) {
+        EXPECT_TRUE(
+            detector.isMostLikelyDuplicate(std::format("request-{}", i)));
+    }
+    int falsePositives = 0;
+    for (int i = 0; i < windowSize; i++) {
+        if (detector.isMostLikelyDuplicate(std::format("unseen-{}", i))) {
+            falsePositives++;
+        }
+    }
+    // Well above the configured 0.1% to keep the test stable.
+    EXPECT_LT(falsePositives, windowSize / 100);
+}
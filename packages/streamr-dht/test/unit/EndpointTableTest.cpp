@@ -0,0 +1,94 @@
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.Endpoint;
+import streamr.dht.EndpointTable;
+import streamr.dht.Identifiers;
+import streamr.dht.TestUtils;
+import streamr.dht.protos;
+
+using streamr::dht::Identifiers;
+using streamr::dht::NodeId;
+using streamr::dht::connection::endpoint::Endpoint;
+using streamr::dht::connection::endpoint::EndpointTable;
+using streamr::dht::testutils::createMockPeerDescriptor;
+
+namespace {
+
+std::shared_ptr<Endpoint> createEndpoint() {
+    return Endpoint::newInstance(createMockPeerDescriptor(), []() {});
+}
+
+NodeId getNodeId(const std::shared_ptr<Endpoint>& endpoint) {
+    return NodeId::fromPeerDescriptor(endpoint->getPeerDescriptor());
+}
+
+} // namespace
+
+TEST(EndpointTableTest, FindsInsertedAndForgetsErased) {
+    EndpointTable table;
+    const auto endpoint = createEndpoint();
+    const auto nodeId = getNodeId(endpoint);
+    EXPECT_EQ(table.find(nodeId), nullptr);
+
+    table.update(nodeId, [&](EndpointTable::Shard& shard) {
+        shard.emplace(nodeId, endpoint);
+    });
+    EXPECT_EQ(table.find(nodeId), endpoint);
+    EXPECT_TRUE(table.contains(nodeId));
+    EXPECT_EQ(table.size(), 1U);
+
+    table.erase(nodeId);
+    EXPECT_EQ(table.find(nodeId), nullptr);
+    EXPECT_EQ(table.size(), 0U);
+    table.erase(nodeId);
+}
+
+TEST(EndpointTableTest, RacingInsertsForOnePeerInsertOnce) {
+    EndpointTable table;
+    const auto nodeId =
+        NodeId::fromDhtAddress(Identifiers::createRandomDhtAddress());
+    std::atomic<size_t> insertCount = 0;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&]() {
+            table.update(nodeId, [&](EndpointTable::Shard& shard) {
+                if (!shard.contains(nodeId)) {
+                    shard.emplace(nodeId, createEndpoint());
+                    insertCount++;
+                }
+            });
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(insertCount, 1U);
+    EXPECT_EQ(table.size(), 1U);
+}
+
+TEST(EndpointTableTest, GetEndpointsCoversAllShards) {
+    EndpointTable table;
+    std::vector<std::shared_ptr<Endpoint>> endpoints;
+    for (size_t i = 0; i < 100; ++i) {
+        const auto endpoint = createEndpoint();
+        const auto nodeId = getNodeId(endpoint);
+        table.update(nodeId, [&](EndpointTable::Shard& shard) {
+            shard.emplace(nodeId, endpoint);
+        });
+        endpoints.push_back(endpoint);
+    }
+    const auto result = table.getEndpoints();
+    EXPECT_EQ(result.size(), endpoints.size());
+    for (const auto& endpoint : endpoints) {
+        EXPECT_EQ(table.find(getNodeId(endpoint)), endpoint);
+    }
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -1,9 +1,77 @@
+#include <stdexcept>
+#include <string>
 #include <gtest/gtest.h>
 
 import streamr.dht.Identifiers;
 
+using streamr::dht::DhtAddress;
+using streamr::dht::DhtAddressRaw;
 using streamr::dht::Identifiers;
+using streamr::dht::NodeId;
 
 TEST(Identifiers, ItCanBeConstructed) {
     Identifiers identifiers;
 }
+
+TEST(Identifiers, DhtAddressRoundTripsThroughRaw) {
+    const DhtAddress address{
+        std::string("00ff10a0b1c2d3e4f5a6b7c8d9eafb0c1d2e3f40")};
+    const auto raw = Identifiers::getRawFromDhtAddress(address);
+    EXPECT_EQ(raw.size(), 20U);
+    EXPECT_EQ(Identifiers::getDhtAddressFromRaw(raw), address);
+}
+
+TEST(Identifiers, NodeIdConvertsToAndFromDhtAddress) {
+    const auto address = Identifiers::createRandomDhtAddress();
+    const auto nodeId = NodeId::fromDhtAddress(address);
+    EXPECT_EQ(nodeId.toDhtAddress(), address);
+    EXPECT_EQ(nodeId.toRaw(), Identifiers::getRawFromDhtAddress(address));
+    EXPECT_EQ(
+        NodeId::fromRaw(Identifiers::getRawFromDhtAddress(address)), nodeId);
+    EXPECT_EQ(
+        NodeId::fromDhtAddress(DhtAddress{std::string(
+                                   "ABCDEF0123456789abcdef0123456789ABCDEF01")})
+            .toDhtAddress(),
+        DhtAddress{std::string("abcdef0123456789abcdef0123456789abcdef01")});
+}
+
+TEST(Identifiers, NodeIdRejectsMalformedInput) {
+    EXPECT_THROW(NodeId::fromRaw(std::string(21, 'a')), std::invalid_argument);
+    EXPECT_THROW(
+        NodeId::fromDhtAddress(DhtAddress{std::string("abc")}),
+        std::invalid_argument);
+    EXPECT_THROW(
+        NodeId::fromDhtAddress(DhtAddress{
+            std::string("zz00000000000000000000000000000000000000")}),
+        std::invalid_argument);
+    EXPECT_THROW(
+        NodeId::fromDhtAddress(DhtAddress{std::string(42, '0')}),
+        std::invalid_argument);
+    EXPECT_FALSE(
+        NodeId::tryFromDhtAddress(DhtAddress{std::string("0g")}).has_value());
+}
+
+TEST(Identifiers, NodeIdKeepsTheLengthOfShortIds) {
+    const auto shortId = NodeId::fromDhtAddress(DhtAddress{std::string("abcd")});
+    EXPECT_EQ(shortId.size(), 2U);
+    EXPECT_FALSE(shortId.isFullLength());
+    EXPECT_EQ(shortId.toDhtAddress(), DhtAddress{std::string("abcd")});
+    EXPECT_EQ(shortId.toRaw(), DhtAddressRaw{std::string("\xab\xcd")});
+    // Zero padding does not make ids of different lengths equal, and they
+    // order like their raw bytes.
+    const auto padded =
+        NodeId::fromDhtAddress(DhtAddress{std::string("abcd00")});
+    EXPECT_NE(shortId, padded);
+    EXPECT_LT(shortId, padded);
+    EXPECT_LT(shortId, NodeId::fromDhtAddress(DhtAddress{std::string("abce")}));
+}
+
+TEST(Identifiers, NodeIdsAreOrdered) {
+    const auto first = NodeId::fromDhtAddress(DhtAddress{
+        std::string("0000000000000000000000000000000000000001")});
+    const auto second = NodeId::fromDhtAddress(DhtAddress{
+        std::string("0000000000000000000000000000000000000002")});
+    EXPECT_LT(first, second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(first, NodeId::fromRaw(first.toRaw()));
+}
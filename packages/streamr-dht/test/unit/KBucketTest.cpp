@@ -6,6 +6,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <random>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <gtest/gtest.h>
@@ -15,6 +17,7 @@ import streamr.dht.Identifiers;
 import streamr.dht.KBucket;
 
 using streamr::dht::DhtAddressRaw;
+using streamr::dht::kademliaIdLengthInBytes;
 using streamr::dht::contact::KBucket;
 using streamr::dht::contact::KBucketOptions;
 using streamr::dht::helpers::getPeerDistance;
@@ -270,4 +273,46 @@ TEST(KBucketTest, CountAndToArrayReflectContents) {
     EXPECT_EQ(bucket.toArray().size(), 3U);
 }
 
+TEST(KBucketTest, ClosestWithFullLengthIdsMatchesSortingEveryContact) {
+    std::mt19937 rng(7);
+    const auto randomId = [&rng]() {
+        std::vector<unsigned char> bytes(kademliaIdLengthInBytes);
+        for (auto& byte : bytes) {
+            byte = static_cast<unsigned char>(rng());
+        }
+        return bytes;
+    };
+    KBucket<MockContact> bucket(
+        KBucketOptions{
+            .localNodeId = rawFromBytes(randomId()),
+            .numberOfNodesPerKBucket = 4});
+    for (int i = 0; i < 500; ++i) {
+        bucket.add(makeContact(randomId()));
+    }
+    for (int i = 0; i < 50; ++i) {
+        const DhtAddressRaw target = rawFromBytes(randomId());
+        auto expected = bucket.toArray();
+        std::ranges::sort(
+            expected,
+            [&target](
+                const std::shared_ptr<MockContact>& a,
+                const std::shared_ptr<MockContact>& b) {
+                return getPeerDistance(a->getId(), target) <
+                    getPeerDistance(b->getId(), target);
+            });
+        EXPECT_EQ(bucket.closest(target), expected);
+        expected.resize(std::min<size_t>(expected.size(), 5));
+        EXPECT_EQ(bucket.closest(target, 5), expected);
+    }
+}
+
+TEST(KBucketTest, IdsLongerThanAKademliaIdAreRejected) {
+    auto bucket = makeBucket({0x00});
+    const auto contact = std::make_shared<MockContact>(
+        DhtAddressRaw{std::string(kademliaIdLengthInBytes + 1, 'a')}, 0);
+    EXPECT_THROW(bucket.add(contact), std::invalid_argument);
+    EXPECT_FALSE(bucket.get(contact->getId()));
+    EXPECT_EQ(bucket.count(), 0U);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -1,7 +1,7 @@
 // Ported from packages/dht/test/unit/LocalDataStore.test.ts
-// (v103.8.0-rc.3). Also validates the A5 MapWithTtl lazy-expiry adaptation:
-// the "deleted after TTL" case waits real time and expects the entry gone on
-// the next access.
+// (v103.8.0-rc.3). The "deleted after TTL" case waits real time and expects
+// the entry gone on the next access; the native-only cases below cover the
+// proactive expiry, the memory budget and the shared entry snapshots.
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
@@ -19,6 +19,7 @@ using streamr::dht::DhtAddress;
 using streamr::dht::DhtAddressRaw;
 using streamr::dht::Identifiers;
 using streamr::dht::store::LocalDataStore;
+using streamr::dht::store::LocalDataStoreOptions;
 using streamr::dht::testutils::createMockDataEntry;
 using streamr::dht::testutils::createMockPeerDescriptor;
 using streamr::dht::testutils::MockDataEntryOptions;
@@ -139,3 +140,79 @@ TEST_F(LocalDataStoreTest, MarkAsDeletedWrongCreator) {
         keyOf(storedEntry),
         Identifiers::getNodeIdFromPeerDescriptor(createMockPeerDescriptor())));
 }
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+TEST_F(LocalDataStoreTest, ExpiredEntriesAreDroppedWithoutBeingRead) {
+    this->localDataStore.storeEntry(
+        createMockDataEntry(MockDataEntryOptions{.ttl = 100}));
+    this->localDataStore.storeEntry(createMockDataEntry());
+    EXPECT_EQ(this->localDataStore.getEntryCount(), 2U);
+    const size_t usedBytes = this->localDataStore.getUsedBytes();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(this->localDataStore.expire(), 1U);
+    EXPECT_EQ(this->localDataStore.getEntryCount(), 1U);
+    EXPECT_LT(this->localDataStore.getUsedBytes(), usedBytes);
+    EXPECT_EQ(this->localDataStore.keys().size(), 1U);
+}
+
+TEST_F(LocalDataStoreTest, ReplacedEntryKeepsItsOwnTtl) {
+    const DhtAddress key = Identifiers::createRandomDhtAddress();
+    const DhtAddress creator = Identifiers::createRandomDhtAddress();
+    this->localDataStore.storeEntry(createMockDataEntry(
+        MockDataEntryOptions{.key = key, .creator = creator, .ttl = 100}));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_TRUE(this->localDataStore.storeEntry(createMockDataEntry(
+        MockDataEntryOptions{.key = key, .creator = creator})));
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(this->localDataStore.expire(), 0U);
+    EXPECT_EQ(this->localDataStore.values(key).size(), 1U);
+}
+
+TEST(LocalDataStoreBudgetTest, OldestEntriesAreEvictedOverBudget) {
+    const auto first = createMockDataEntry();
+    size_t entryBytes = 0;
+    {
+        LocalDataStore probe(maxTtl);
+        probe.storeEntry(first);
+        entryBytes = probe.getUsedBytes();
+    }
+    LocalDataStore localDataStore(
+        LocalDataStoreOptions{.maxTtl = maxTtl, .maxBytes = entryBytes * 2});
+    const auto second = createMockDataEntry();
+    const auto third = createMockDataEntry();
+    localDataStore.storeEntry(first);
+    localDataStore.storeEntry(second);
+    EXPECT_EQ(localDataStore.getEntryCount(), 2U);
+    localDataStore.storeEntry(third);
+    EXPECT_EQ(localDataStore.getEntryCount(), 2U);
+    EXPECT_LE(localDataStore.getUsedBytes(), entryBytes * 2);
+    EXPECT_TRUE(localDataStore.values(keyOf(first)).empty());
+    EXPECT_EQ(localDataStore.values(keyOf(second)).size(), 1U);
+    EXPECT_EQ(localDataStore.values(keyOf(third)).size(), 1U);
+}
+
+TEST(LocalDataStoreBudgetTest, EntryLargerThanTheBudgetIsRejected) {
+    LocalDataStore localDataStore(
+        LocalDataStoreOptions{.maxTtl = maxTtl, .maxBytes = 16});
+    EXPECT_FALSE(localDataStore.storeEntry(createMockDataEntry()));
+    EXPECT_EQ(localDataStore.getEntryCount(), 0U);
+}
+
+TEST_F(LocalDataStoreTest, EntriesAreSharedSnapshots) {
+    const DhtAddress creator = Identifiers::createRandomDhtAddress();
+    const auto storedEntry =
+        createMockDataEntry(MockDataEntryOptions{.creator = creator});
+    const DhtAddress key = keyOf(storedEntry);
+    this->localDataStore.storeEntry(storedEntry);
+    const auto before = this->localDataStore.getEntries(key);
+    ASSERT_EQ(before.size(), 1U);
+    EXPECT_EQ(this->localDataStore.getEntries(key)[0], before[0]);
+    this->localDataStore.markAsDeleted(key, creator);
+    const auto after = this->localDataStore.getEntries(key);
+    ASSERT_EQ(after.size(), 1U);
+    EXPECT_TRUE(after[0]->deleted());
+    EXPECT_FALSE(before[0]->deleted());
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstddef>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.Identifiers;
+import streamr.dht.LookupLatencyTracker;
+
+using streamr::dht::Identifiers;
+using streamr::dht::discovery::LookupLatencyTracker;
+using streamr::dht::discovery::LookupLatencyTrackerOptions;
+using std::chrono::milliseconds;
+
+TEST(LookupLatencyTrackerTest, HedgeDelayIsDefaultUntilEnoughSamples) {
+    LookupLatencyTracker tracker(
+        LookupLatencyTrackerOptions{
+            .defaultHedgeDelay = milliseconds(700), .minSampleCount = 4});
+    const auto nodeId = Identifiers::createRandomDhtAddress();
+    for (size_t i = 0; i < 3; ++i) {
+        tracker.recordSuccess(nodeId, milliseconds(50));
+    }
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(700));
+    tracker.recordSuccess(nodeId, milliseconds(50));
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(50));
+}
+
+TEST(LookupLatencyTrackerTest, HedgeDelayIsP95OfRecentSamples) {
+    LookupLatencyTracker tracker(
+        LookupLatencyTrackerOptions{.sampleCount = 100, .minSampleCount = 1});
+    // 1..100 ms: the p95 is the 96th smallest.
+    for (int i = 1; i <= 100; ++i) {
+        tracker.recordSuccess(
+            Identifiers::createRandomDhtAddress(), milliseconds(i));
+    }
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(96));
+    // The ring keeps only the last 100: these push out 1..100.
+    for (int i = 0; i < 100; ++i) {
+        tracker.recordSuccess(
+            Identifiers::createRandomDhtAddress(), milliseconds(30));
+    }
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(30));
+}
+
+TEST(LookupLatencyTrackerTest, HedgeDelayIsClamped) {
+    LookupLatencyTracker tracker(
+        LookupLatencyTrackerOptions{
+            .minSampleCount = 1,
+            .minHedgeDelay = milliseconds(20),
+            .maxHedgeDelay = milliseconds(200)});
+    const auto nodeId = Identifiers::createRandomDhtAddress();
+    tracker.recordSuccess(nodeId, milliseconds(1));
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(20));
+    for (size_t i = 0; i < 10; ++i) {
+        tracker.recordSuccess(nodeId, milliseconds(10000));
+    }
+    EXPECT_EQ(tracker.getHedgeDelay(), milliseconds(200));
+}
+
+TEST(LookupLatencyTrackerTest, TracksFailuresPerContact) {
+    LookupLatencyTracker tracker;
+    const auto fast = Identifiers::createRandomDhtAddress();
+    const auto failing = Identifiers::createRandomDhtAddress();
+    tracker.recordSuccess(fast, milliseconds(100));
+    tracker.recordSuccess(fast, milliseconds(20));
+    EXPECT_EQ(tracker.getFailureRate(fast), 0);
+    EXPECT_FALSE(tracker.isUnreliable(fast));
+
+    tracker.recordFailure(failing);
+    tracker.recordFailure(failing);
+    EXPECT_FALSE(tracker.isUnreliable(failing));
+    for (size_t i = 0; i < 3; ++i) {
+        tracker.recordFailure(failing);
+    }
+    EXPECT_GT(tracker.getFailureRate(failing), 0.5);
+    EXPECT_TRUE(tracker.isUnreliable(failing));
+    for (size_t i = 0; i < 5; ++i) {
+        tracker.recordSuccess(failing, milliseconds(10));
+    }
+    EXPECT_FALSE(tracker.isUnreliable(failing));
+}
+
+TEST(LookupLatencyTrackerTest, ForgetsLeastRecentlyUsedContacts) {
+    LookupLatencyTracker tracker(
+        LookupLatencyTrackerOptions{.maxTrackedContacts = 2});
+    const auto first = Identifiers::createRandomDhtAddress();
+    const auto second = Identifiers::createRandomDhtAddress();
+    const auto third = Identifiers::createRandomDhtAddress();
+    tracker.recordFailure(first);
+    tracker.recordFailure(second);
+    tracker.recordFailure(first);
+    tracker.recordFailure(third);
+    EXPECT_GT(tracker.getFailureRate(first), 0);
+    EXPECT_EQ(tracker.getFailureRate(second), 0);
+    EXPECT_GT(tracker.getFailureRate(third), 0);
+}
+
+TEST(LookupLatencyTrackerTest, KeepsTheLatestContactWhenLimitIsZero) {
+    LookupLatencyTracker tracker(
+        LookupLatencyTrackerOptions{.maxTrackedContacts = 0});
+    const auto first = Identifiers::createRandomDhtAddress();
+    const auto second = Identifiers::createRandomDhtAddress();
+    tracker.recordFailure(first);
+    tracker.recordFailure(second);
+    EXPECT_EQ(tracker.getFailureRate(first), 0);
+    EXPECT_GT(tracker.getFailureRate(second), 0);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -11,6 +11,7 @@ import streamr.utils.CoroutineHelper;
 import streamr.dht.IPendingConnection;
 import streamr.dht.Connection;
 import streamr.dht.PendingConnection;
+import streamr.dht.SendBuffer;
 import streamr.dht.Transport;
 import streamr.dht.protos;
 import streamr.utils.waitForCondition;
@@ -18,6 +19,7 @@ import streamr.utils.waitForCondition;
 using ::dht::PeerDescriptor;
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::PendingConnection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::pendingconnectionevents::Connected;
 using streamr::dht::connection::pendingconnectionevents::Disconnected;
 using streamr::utils::waitForCondition;
@@ -29,7 +31,7 @@ public:
         : Connection(
               streamr::dht::connection::ConnectionType::WEBSOCKET_CLIENT) {}
 
-    void send(const std::vector<std::byte>& data) override {}
+    void send(const SendBuffer& data) override {}
 
     void close(bool gracefulLeave) override {}
 
@@ -3,6 +3,7 @@
 // no-targets, duplicate, bad-payload) and the no-connections execute path.
 // The Router is substituted by callbacks (the C++ Router is concrete);
 // MockTransport / MockConnectionsView stand in for the transport.
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
@@ -12,6 +13,7 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -19,6 +21,7 @@
 
 import streamr.utils.CoroutineHelper;
 import streamr.utils.Uuid;
+import streamr.utils.waitForCondition;
 import streamr.protorpc.RpcCommunicator;
 import streamr.protorpc.protos;
 import streamr.dht.ConnectionsView;
@@ -57,6 +60,7 @@ using streamr::dht::transport::Transport;
 using streamr::protorpc::RpcCommunicator;
 using streamr::utils::blockingWait;
 using streamr::utils::Uuid;
+using streamr::utils::waitForCondition;
 
 namespace {
 
@@ -160,7 +164,7 @@ protected:
     PeerDescriptor peerDescriptor1 = createMockPeerDescriptor();
     PeerDescriptor peerDescriptor2 = createMockPeerDescriptor();
 
-    using RouteFn = std::function<RouteMessageAck(
+    using RouteFn = std::function<folly::coro::Task<RouteMessageAck>(
         const RouteMessageWrapper&, RoutingMode, std::optional<DhtAddress>)>;
 
     [[nodiscard]] Message createMessage() const {
@@ -211,8 +215,9 @@ protected:
         return this->makeManager(
             [](const RouteMessageWrapper& /*message*/,
                RoutingMode /*mode*/,
-               const std::optional<DhtAddress>& /*excludedPeer*/) {
-                return RouteMessageAck{};
+               const std::optional<DhtAddress>& /*excludedPeer*/)
+                -> folly::coro::Task<RouteMessageAck> {
+                co_return RouteMessageAck{};
             });
     }
 
@@ -221,11 +226,12 @@ protected:
         return [error](
                    const RouteMessageWrapper& message,
                    RoutingMode /*mode*/,
-                   const std::optional<DhtAddress>& /*excludedPeer*/) {
+                   const std::optional<DhtAddress>& /*excludedPeer*/)
+                   -> folly::coro::Task<RouteMessageAck> {
             RouteMessageAck ack;
             ack.set_requestid(message.requestid());
             ack.set_error(error);
-            return ack;
+            co_return ack;
         };
     }
 };
@@ -300,3 +306,34 @@ TEST_F(RecursiveOperationManagerTest, Error) {
     manager->stop();
     EXPECT_EQ(this->transport.sendCount, 0U);
 }
+
+TEST_F(RecursiveOperationManagerTest, PendingHopDoesNotBlockTheManager) {
+    auto contract = folly::coro::makePromiseContract<folly::Unit>();
+    std::atomic<bool> routing = false;
+    auto manager = this->makeManager(
+        [&routing, &contract](
+            const RouteMessageWrapper& /*message*/,
+            RoutingMode /*mode*/,
+            const std::optional<DhtAddress>& /*excludedPeer*/)
+            -> folly::coro::Task<RouteMessageAck> {
+            routing = true;
+            co_await std::move(contract.second);
+            co_return RouteMessageAck{};
+        });
+    RouteMessageAck ack;
+    std::thread caller([this, &ack]() {
+        ack = this->rpcCommunicator
+                  .callRpcMethod<RouteMessageWrapper, RouteMessageAck>(
+                      "routeRequest", this->createRoutedMessage());
+    });
+    blockingWait(waitForCondition([&routing]() { return routing.load(); }));
+    // The manager's lock is free while the hop is routed.
+    const auto result = blockingWait(manager->execute(
+        Identifiers::createRandomDhtAddress(),
+        RecursiveOperation::FIND_CLOSEST_NODES));
+    EXPECT_FALSE(result.closestNodes.empty());
+    contract.first.setValue(folly::Unit{});
+    caller.join();
+    EXPECT_FALSE(ack.has_error());
+    manager->stop();
+}
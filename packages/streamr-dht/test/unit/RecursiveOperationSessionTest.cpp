@@ -93,12 +93,13 @@ TEST_F(RecursiveOperationSessionTest, HappyPath) {
             .waitedRoutingPathCompletions = waitedCompletions,
             .operation = RecursiveOperation::FIND_CLOSEST_NODES,
             .doRouteRequest =
-                [this](const ::dht::RouteMessageWrapper& /*message*/) {
+                [this](const ::dht::RouteMessageWrapper& /*message*/)
+                    -> folly::coro::Task<RouteMessageAck> {
                     this->doRouteRequestCalled = true;
-                    return RouteMessageAck{};
+                    co_return RouteMessageAck{};
                 }});
 
-    this->session->start(ServiceID{""});
+    blockingWait(this->session->start(ServiceID{""}));
     EXPECT_TRUE(this->doRouteRequestCalled);
     for (size_t i = 0; i < responseCount; ++i) {
         this->sendResponseFrom(ServiceID{this->session->getId()});
@@ -0,0 +1,126 @@
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <folly/hash/SpookyHashV2.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.Identifiers;
+import streamr.dht.ReplicationBatch;
+import streamr.dht.protos;
+import streamr.dht.TestUtils;
+
+using ::dht::DataEntry;
+using ::dht::ReplicaDigests;
+using ::dht::ReplicaKeys;
+using ::dht::ReplicateDataBatch;
+using streamr::dht::DhtAddress;
+using streamr::dht::Identifiers;
+using streamr::dht::store::computeReplicaDigest;
+using streamr::dht::store::packReplicaDigests;
+using streamr::dht::store::packReplicaKeys;
+using streamr::dht::store::packReplicateDataBatch;
+using streamr::dht::store::unpackReplicaDigests;
+using streamr::dht::store::unpackReplicaKeys;
+using streamr::dht::testutils::createMockDataEntry;
+using streamr::dht::testutils::MockDataEntryOptions;
+
+namespace {
+
+using Entries = std::vector<std::shared_ptr<const DataEntry>>;
+
+std::shared_ptr<const DataEntry> createEntry(const DhtAddress& key) {
+    return std::make_shared<const DataEntry>(
+        createMockDataEntry(MockDataEntryOptions{.key = key}));
+}
+
+} // namespace
+
+TEST(ReplicationBatchTest, PackedBatchKeepsEntryOrder) {
+    const auto key = Identifiers::createRandomDhtAddress();
+    const Entries entries{createEntry(key), createEntry(key), createEntry(key)};
+    ReplicateDataBatch received;
+    ASSERT_TRUE(received.ParseFromString(
+        packReplicateDataBatch(entries).SerializeAsString()));
+    ASSERT_EQ(received.entries_size(), 3);
+    for (int i = 0; i < received.entries_size(); ++i) {
+        EXPECT_EQ(
+            received.entries(i).SerializeAsString(),
+            entries[static_cast<size_t>(i)]->SerializeAsString());
+    }
+}
+
+TEST(ReplicationBatchTest, DigestsAndKeysSurvivePacking) {
+    std::map<DhtAddress, uint64_t> digests;
+    std::set<DhtAddress> keys;
+    for (uint64_t i = 0; i < 5; ++i) {
+        const auto key = Identifiers::createRandomDhtAddress();
+        digests.emplace(key, i * 0x0123456789abcdefULL);
+        keys.insert(key);
+    }
+    ReplicaDigests receivedDigests;
+    ASSERT_TRUE(receivedDigests.ParseFromString(
+        packReplicaDigests(digests).SerializeAsString()));
+    EXPECT_EQ(unpackReplicaDigests(receivedDigests), digests);
+    ReplicaKeys receivedKeys;
+    ASSERT_TRUE(receivedKeys.ParseFromString(
+        packReplicaKeys(keys).SerializeAsString()));
+    EXPECT_EQ(unpackReplicaKeys(receivedKeys), keys);
+    EXPECT_TRUE(unpackReplicaKeys(packReplicaKeys({})).empty());
+}
+
+TEST(ReplicationBatchTest, DigestIgnoresOrderButNotVersions) {
+    const auto key = Identifiers::createRandomDhtAddress();
+    const auto first = createEntry(key);
+    const auto second = createEntry(key);
+    EXPECT_EQ(
+        computeReplicaDigest(Entries{first, second}),
+        computeReplicaDigest(Entries{second, first}));
+    EXPECT_NE(
+        computeReplicaDigest(Entries{first}),
+        computeReplicaDigest(Entries{first, second}));
+
+    auto deleted = std::make_shared<DataEntry>(*first);
+    deleted->set_deleted(true);
+    EXPECT_NE(
+        computeReplicaDigest(Entries{first}),
+        computeReplicaDigest(Entries{deleted}));
+
+    auto newer = std::make_shared<DataEntry>(*first);
+    newer->mutable_createdat()->set_seconds(first->createdat().seconds() + 1);
+    EXPECT_NE(
+        computeReplicaDigest(Entries{first}),
+        computeReplicaDigest(Entries{newer}));
+
+    // Only the version counts, not the local bookkeeping.
+    auto stale = std::make_shared<DataEntry>(*first);
+    stale->set_stale(true);
+    EXPECT_EQ(
+        computeReplicaDigest(Entries{first}),
+        computeReplicaDigest(Entries{stale}));
+}
+
+TEST(ReplicationBatchTest, DigestHashesLittleEndianVersionBytes) {
+    auto entry = std::make_shared<DataEntry>();
+    entry->set_creator(std::string("\x01\x02\x03", 3));
+    entry->mutable_createdat()->set_seconds(0x0102030405060708LL);
+    entry->mutable_createdat()->set_nanos(0x0a0b0c0d);
+    entry->set_deleted(true);
+    // creator, seconds (8 bytes LE), nanos (4 bytes LE), deleted
+    const std::string version(
+        "\x01\x02\x03"
+        "\x08\x07\x06\x05\x04\x03\x02\x01"
+        "\x0d\x0c\x0b\x0a"
+        "\x01",
+        16);
+    EXPECT_EQ(
+        computeReplicaDigest(Entries{entry}),
+        folly::hash::SpookyHashV2::Hash64(version.data(), version.size(), 0));
+}
+
+// NOLINTEND(readability-magic-numbers)
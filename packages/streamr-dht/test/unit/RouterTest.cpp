@@ -16,6 +16,7 @@
 #include <vector>
 #include <gtest/gtest.h>
 
+import streamr.utils.CoroutineHelper;
 import streamr.utils.Uuid;
 import streamr.protorpc.RpcCommunicator;
 import streamr.protorpc.protos;
@@ -23,6 +24,7 @@ import streamr.dht.DhtCallContext;
 import streamr.dht.Identifiers;
 import streamr.dht.Router;
 import streamr.dht.RouterRpcLocal;
+import streamr.dht.RoutingSession;
 import streamr.dht.protos;
 import streamr.dht.TestUtils;
 
@@ -35,10 +37,12 @@ using ::protorpc::RpcMessage;
 using streamr::dht::DhtAddress;
 using streamr::dht::Identifiers;
 using streamr::dht::routing::Router;
+using streamr::dht::routing::RoutingMode;
 using streamr::dht::routing::RouterOptions;
 using streamr::dht::rpcprotocol::DhtCallContext;
 using streamr::dht::testutils::createMockPeerDescriptor;
 using streamr::protorpc::RpcCommunicator;
+using streamr::utils::blockingWait;
 using streamr::utils::Uuid;
 
 namespace {
@@ -248,3 +252,48 @@ TEST_F(RouterTest, ForwardServerOnDuplicateMessage) {
     ASSERT_TRUE(ack.has_error());
     EXPECT_EQ(ack.error(), RouteMessageError::DUPLICATE);
 }
+
+TEST_F(RouterTest, DoRouteMessageAsyncWithoutConnections) {
+    const auto ack = blockingWait(
+        router->doRouteMessageAsync(createForwardTarget(), RoutingMode::ROUTE));
+    ASSERT_TRUE(ack.has_error());
+    EXPECT_EQ(ack.error(), RouteMessageError::NO_TARGETS);
+}
+
+TEST_F(RouterTest, DoRouteMessageAsyncWithConnections) {
+    addConnection(peerDescriptor2);
+    const auto ack = blockingWait(
+        router->doRouteMessageAsync(createForwardTarget(), RoutingMode::ROUTE));
+    EXPECT_FALSE(ack.has_error());
+}
+
+TEST_F(RouterTest, ConnectionEventsAreAppliedBeforeLaterRouting) {
+    addConnection(peerDescriptor2);
+    // Posted to the routing worker; the route below is queued behind them.
+    router->onNodeConnected(peerDescriptor2);
+    router->onNodeDisconnected(peerDescriptor2);
+    router->resetCache();
+    const auto ack = route(createForwardTarget());
+    EXPECT_FALSE(ack.has_error());
+}
+
+TEST_F(RouterTest, QueuedJobsDoNotKeepTheRouterAlive) {
+    constexpr int rounds = 100;
+    const std::weak_ptr<Router> weakRouter = router;
+    for (int i = 0; i < rounds; ++i) {
+        router->onNodeConnected(peerDescriptor2);
+        router->onNodeDisconnected(peerDescriptor2);
+    }
+    // The last reference goes here, not inside a queued job: the
+    // destructor runs on this thread and drains the jobs.
+    router.reset();
+    EXPECT_TRUE(weakRouter.expired());
+}
+
+TEST_F(RouterTest, DoRouteMessageAsyncAfterStop) {
+    router->stop();
+    const auto ack = blockingWait(
+        router->doRouteMessageAsync(createForwardTarget(), RoutingMode::ROUTE));
+    ASSERT_TRUE(ack.has_error());
+    EXPECT_EQ(ack.error(), RouteMessageError::STOPPED);
+}
@@ -0,0 +1,118 @@
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.protorpc.RpcCommunicator;
+import streamr.dht.DhtCallContext;
+import streamr.dht.Identifiers;
+import streamr.dht.RoutingRemoteContact;
+import streamr.dht.RoutingTablesCache;
+import streamr.dht.SortedContactList;
+import streamr.dht.protos;
+import streamr.dht.TestUtils;
+
+using ::dht::PeerDescriptor;
+using streamr::dht::DhtAddress;
+using streamr::dht::Identifiers;
+using streamr::dht::contact::SortedContactList;
+using streamr::dht::contact::SortedContactListOptions;
+using streamr::dht::routing::RoutingRemoteContact;
+using streamr::dht::routing::RoutingTable;
+using streamr::dht::routing::RoutingTablesCache;
+using streamr::dht::rpcprotocol::DhtCallContext;
+using streamr::dht::testutils::createMockPeerDescriptor;
+using streamr::protorpc::RpcCommunicator;
+
+class RoutingTablesCacheTest : public ::testing::Test {
+protected:
+    RpcCommunicator<DhtCallContext> communicator;
+    PeerDescriptor localPeerDescriptor = createMockPeerDescriptor();
+    DhtAddress targetId = Identifiers::createRandomDhtAddress();
+    RoutingTablesCache cache;
+
+    std::shared_ptr<RoutingRemoteContact> createRemote() {
+        return std::make_shared<RoutingRemoteContact>(
+            createMockPeerDescriptor(),
+            this->localPeerDescriptor,
+            this->communicator);
+    }
+
+    RoutingTable createTable(std::optional<size_t> maxSize = std::nullopt) {
+        return std::make_shared<SortedContactList<RoutingRemoteContact>>(
+            SortedContactListOptions{
+                .referenceId = this->targetId,
+                .allowToContainReferenceId = true,
+                .maxSize = maxSize});
+    }
+};
+
+TEST_F(RoutingTablesCacheTest, AppliesConnectionChangesOnGet) {
+    const auto table = this->createTable();
+    const auto first = this->createRemote();
+    table->addContact(first);
+    this->cache.set(this->targetId, table);
+
+    const auto second = this->createRemote();
+    this->cache.onNodeConnected(second);
+    this->cache.onNodeDisconnected(first->getNodeId());
+    // Nothing is applied until the table is fetched.
+    EXPECT_TRUE(table->has(first->getNodeId()));
+    EXPECT_FALSE(table->has(second->getNodeId()));
+    EXPECT_EQ(this->cache.getLoggedChangeCount(), 2U);
+
+    const auto fetched = this->cache.get(this->targetId);
+    ASSERT_EQ(fetched, table);
+    EXPECT_FALSE(table->has(first->getNodeId()));
+    EXPECT_TRUE(table->has(second->getNodeId()));
+}
+
+TEST_F(RoutingTablesCacheTest, ReplaysChangesInOrder) {
+    const auto table = this->createTable();
+    this->cache.set(this->targetId, table);
+    const auto remote = this->createRemote();
+    this->cache.onNodeConnected(remote);
+    this->cache.onNodeDisconnected(remote->getNodeId());
+    this->cache.onNodeConnected(remote);
+    EXPECT_TRUE(this->cache.get(this->targetId)->has(remote->getNodeId()));
+    this->cache.onNodeDisconnected(remote->getNodeId());
+    EXPECT_EQ(this->cache.get(this->targetId)->getSize(), 0U);
+}
+
+TEST_F(RoutingTablesCacheTest, TablesSetLaterSkipEarlierChanges) {
+    this->cache.set(this->targetId, this->createTable());
+    const auto remote = this->createRemote();
+    this->cache.onNodeConnected(remote);
+    const DhtAddress otherTargetId = Identifiers::createRandomDhtAddress();
+    const auto other = this->createTable();
+    this->cache.set(otherTargetId, other);
+    EXPECT_EQ(this->cache.get(otherTargetId)->getSize(), 0U);
+    EXPECT_EQ(this->cache.get(this->targetId)->getSize(), 1U);
+}
+
+TEST_F(RoutingTablesCacheTest, DropsTablesTooFarBehind) {
+    this->cache.set(this->targetId, this->createTable());
+    const auto remote = this->createRemote();
+    for (size_t i = 0; i < 2000; ++i) {
+        this->cache.onNodeDisconnected(remote->getNodeId());
+    }
+    EXPECT_LE(this->cache.getLoggedChangeCount(), 1024U);
+    EXPECT_EQ(this->cache.get(this->targetId), nullptr);
+    EXPECT_FALSE(this->cache.has(this->targetId));
+}
+
+TEST_F(RoutingTablesCacheTest, ResetStopsAndForgetsTables) {
+    const auto table = this->createTable();
+    table->addContact(this->createRemote());
+    this->cache.set(this->targetId, table);
+    this->cache.onNodeConnected(this->createRemote());
+    this->cache.reset();
+    EXPECT_EQ(table->getSize(), 0U);
+    EXPECT_EQ(this->cache.get(this->targetId), nullptr);
+    EXPECT_EQ(this->cache.getLoggedChangeCount(), 0U);
+}
+
+// NOLINTEND(readability-magic-numbers)
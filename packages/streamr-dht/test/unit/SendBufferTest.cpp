@@ -0,0 +1,80 @@
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.SendBuffer;
+
+using streamr::dht::connection::SendBuffer;
+using streamr::dht::connection::SendBufferPool;
+
+namespace {
+
+std::vector<std::byte> makeBytes(size_t size) {
+    std::vector<std::byte> bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::byte>(i);
+    }
+    return bytes;
+}
+
+SendBuffer createFilled(size_t size) {
+    return SendBuffer::create(size, [](std::span<std::byte> bytes) {
+        for (auto& byte : bytes) {
+            byte = std::byte{1};
+        }
+    });
+}
+
+} // namespace
+
+TEST(SendBufferTest, CopiesShareTheBytes) {
+    const auto bytes = makeBytes(100);
+    const SendBuffer buffer(bytes);
+    const SendBuffer copy = buffer; // NOLINT(performance-unnecessary-copy-*)
+    EXPECT_EQ(copy.data(), buffer.data());
+    EXPECT_EQ(copy.toVector(), bytes);
+
+    SendBuffer moved = copy;
+    const SendBuffer target = std::move(moved);
+    EXPECT_EQ(target.data(), buffer.data());
+    EXPECT_TRUE(moved.empty()); // NOLINT(bugprone-use-after-move)
+}
+
+TEST(SendBufferTest, ReleasedSlabIsReusedWithinItsSizeClass) {
+    auto& pool = SendBufferPool::instance();
+    const std::byte* released = nullptr;
+    {
+        const auto buffer = createFilled(100);
+        const auto copy = buffer;
+        released = buffer.data();
+    }
+    const auto before = pool.getStats();
+    const auto buffer = createFilled(900);
+    const auto after = pool.getStats();
+    EXPECT_EQ(buffer.data(), released);
+    EXPECT_EQ(after.reused, before.reused + 1);
+    EXPECT_EQ(after.allocated, before.allocated);
+    EXPECT_EQ(buffer.size(), 900U);
+}
+
+TEST(SendBufferTest, OversizedBufferIsNotRecycled) {
+    auto& pool = SendBufferPool::instance();
+    constexpr size_t oversized = 4 * 1024 * 1024;
+    createFilled(oversized);
+    const auto before = pool.getStats();
+    const auto buffer = createFilled(oversized);
+    EXPECT_EQ(pool.getStats().allocated, before.allocated + 1);
+    EXPECT_EQ(buffer.size(), oversized);
+}
+
+TEST(SendBufferTest, EmptyBuffer) {
+    const SendBuffer buffer(std::vector<std::byte>{});
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_TRUE(SendBuffer().toVector().empty());
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -19,11 +19,13 @@
 #include "packages/dht/protos/DhtRpc.pb.h"
 
 import streamr.dht.Identifiers;
+import streamr.dht.SendBuffer;
 import streamr.dht.Simulator;
 import streamr.dht.SimulatorInterfaces;
 import streamr.dht.TestUtils;
 
 using ::dht::PeerDescriptor;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::simulator::ISimulatorConnection;
 using streamr::dht::connection::simulator::ISimulatorConnector;
 using streamr::dht::connection::simulator::LatencyType;
@@ -147,6 +149,8 @@ std::vector<std::byte> makeData(uint8_t value) {
     return {std::byte{value}};
 }
 
+SendBuffer makeBuffer(uint8_t value) { return SendBuffer(makeData(value)); }
+
 using namespace std::chrono_literals;
 constexpr auto testTimeout = 5000ms;
 
@@ -246,11 +250,11 @@ TEST(SimulatorTest, SendDeliversDataInBothDirections) {
     auto connection2 = establishConnection(simulator, connection1, *connector2);
     ASSERT_NE(connection2, nullptr);
 
-    simulator.send(*connection1, makeData(1));
+    simulator.send(*connection1, makeBuffer(1));
     ASSERT_TRUE(connection2->waitForData(1, testTimeout));
     EXPECT_EQ(connection2->receivedData.at(0), makeData(1));
 
-    simulator.send(*connection2, makeData(2));
+    simulator.send(*connection2, makeBuffer(2));
     ASSERT_TRUE(connection1->waitForData(1, testTimeout));
     EXPECT_EQ(connection1->receivedData.at(0), makeData(2));
 }
@@ -271,7 +275,7 @@ TEST(SimulatorTest, MessagesArriveInSendOrder) {
 
     constexpr size_t messageCount = 100;
     for (size_t i = 0; i < messageCount; i++) {
-        simulator.send(*connection1, makeData(static_cast<uint8_t>(i)));
+        simulator.send(*connection1, makeBuffer(static_cast<uint8_t>(i)));
     }
     ASSERT_TRUE(connection2->waitForData(messageCount, testTimeout));
     for (size_t i = 0; i < messageCount; i++) {
@@ -294,7 +298,7 @@ TEST(SimulatorTest, FixedLatencyDelaysDelivery) {
     ASSERT_NE(connection2, nullptr);
 
     const auto sentAt = std::chrono::steady_clock::now();
-    simulator.send(*connection1, makeData(1));
+    simulator.send(*connection1, makeBuffer(1));
     ASSERT_TRUE(connection2->waitForData(1, testTimeout));
     EXPECT_GE(connection2->receivedAt.at(0) - sentAt, latency);
 }
@@ -328,7 +332,7 @@ TEST(SimulatorTest, SendAfterCloseIsDropped) {
     ASSERT_NE(connection2, nullptr);
 
     simulator.close(*connection1);
-    simulator.send(*connection1, makeData(1));
+    simulator.send(*connection1, makeBuffer(1));
     ASSERT_TRUE(connection2->waitForDisconnect(testTimeout));
     EXPECT_EQ(connection2->receivedData.size(), 0);
 }
@@ -364,7 +368,7 @@ TEST(SimulatorTest, StoppedSimulatorDropsOperations) {
     ASSERT_NE(connection2, nullptr);
 
     simulator.stop();
-    simulator.send(*connection1, makeData(1));
+    simulator.send(*connection1, makeBuffer(1));
     // no delivery may happen after stop; give the (stopped) dispatcher a
     // moment to prove it
     EXPECT_FALSE(connection2->waitForData(1, 100ms));
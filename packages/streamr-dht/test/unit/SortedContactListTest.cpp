@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 #include <gtest/gtest.h>
@@ -80,11 +81,11 @@ TEST_F(SortedContactListTest, ComparesIdsCorrectly) {
     EXPECT_EQ(list.compareIds(item0->getNodeId(), item0->getNodeId()), 0);
     EXPECT_EQ(list.compareIds(item1->getNodeId(), item1->getNodeId()), 0);
     EXPECT_EQ(list.compareIds(item0->getNodeId(), item1->getNodeId()), -1);
-    EXPECT_EQ(list.compareIds(item0->getNodeId(), item2->getNodeId()), -2);
+    EXPECT_EQ(list.compareIds(item0->getNodeId(), item2->getNodeId()), -1);
     EXPECT_EQ(list.compareIds(item1->getNodeId(), item0->getNodeId()), 1);
-    EXPECT_EQ(list.compareIds(item2->getNodeId(), item0->getNodeId()), 2);
+    EXPECT_EQ(list.compareIds(item2->getNodeId(), item0->getNodeId()), 1);
     EXPECT_EQ(list.compareIds(item2->getNodeId(), item3->getNodeId()), -1);
-    EXPECT_EQ(list.compareIds(item1->getNodeId(), item4->getNodeId()), -3);
+    EXPECT_EQ(list.compareIds(item1->getNodeId(), item4->getNodeId()), -1);
 }
 
 TEST_F(SortedContactListTest, CannotExceedMaxSize) {
@@ -212,3 +213,60 @@ TEST_F(SortedContactListTest, DoesNotEmitContactAddedIfContactDidNotFit) {
     EXPECT_EQ(added, 2);
     EXPECT_EQ(list.getClosestContacts().size(), 2U);
 }
+
+TEST(SortedContactListFullLengthIdsTest, KeepsContactsSortedThroughChurn) {
+    const DhtAddress referenceId = Identifiers::createRandomDhtAddress();
+    SortedContactList<TestItem> list(
+        SortedContactListOptions{
+            .referenceId = referenceId,
+            .allowToContainReferenceId = false,
+            .maxSize = std::nullopt});
+    std::vector<std::shared_ptr<TestItem>> items;
+    for (size_t i = 0; i < largeMaxSize * largeMaxSize; ++i) {
+        items.push_back(std::make_shared<TestItem>(
+            Identifiers::getRawFromDhtAddress(
+                Identifiers::createRandomDhtAddress())));
+        list.addContact(items.back());
+    }
+    for (size_t i = 0; i < items.size(); i += 2) {
+        EXPECT_TRUE(list.removeContact(items[i]->getNodeId()));
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        EXPECT_EQ(list.has(items[i]->getNodeId()), i % 2 == 1);
+    }
+    const auto ids = list.getContactIds();
+    EXPECT_EQ(ids.size(), items.size() / 2);
+    EXPECT_TRUE(std::ranges::is_sorted(
+        ids, [&list](const DhtAddress& a, const DhtAddress& b) {
+            return list.compareIds(a, b) < 0;
+        }));
+    EXPECT_EQ(list.getClosestContactId(), ids.front());
+}
+
+TEST_F(SortedContactListTest, IgnoresIdsLongerThanAKademliaId) {
+    const auto tooLong = std::make_shared<TestItem>(
+        DhtAddressRaw{std::string(21, '\x01')});
+    SortedContactList<TestItem> list(
+        SortedContactListOptions{
+            .referenceId = item0->getNodeId(),
+            .allowToContainReferenceId = false,
+            .maxSize = defaultMaxSize});
+    list.addContact(tooLong);
+    list.addContact(item1);
+    EXPECT_EQ(list.getSize(), 1U);
+    EXPECT_FALSE(list.has(tooLong->getNodeId()));
+    EXPECT_FALSE(list.removeContact(tooLong->getNodeId()));
+
+    // Every contact is as far as possible from a malformed reference id.
+    SortedContactList<TestItem> malformedReference(
+        SortedContactListOptions{
+            .referenceId = tooLong->getNodeId(),
+            .allowToContainReferenceId = false,
+            .maxSize = defaultMaxSize});
+    malformedReference.addContact(item2);
+    malformedReference.addContact(item1);
+    EXPECT_EQ(malformedReference.getSize(), 2U);
+    EXPECT_EQ(
+        malformedReference.compareIds(item1->getNodeId(), item2->getNodeId()),
+        0);
+}
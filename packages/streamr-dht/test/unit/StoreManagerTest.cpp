@@ -1,12 +1,18 @@
 // Ported from packages/dht/test/unit/StoreManager.test.ts (v103.8.0-rc.3):
 // onContactAdded replicates data to a newly-added node when this node is the
 // primary storer and the new node is within the redundancy factor, and marks
-// entries stale when this node drops out of the storer set.
+// entries stale when this node drops out of the storer set. The
+// native-only cases cover the batched replication to contacts that support
+// syncReplicas; the mock remote rejects it by default, as a TS node would,
+// and the fallback to replicateData when syncReplicas is unknown or fails.
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -16,9 +22,9 @@
 
 import streamr.utils.CoroutineHelper;
 import streamr.utils.waitForCondition;
+import streamr.protorpc.Errors;
 import streamr.protorpc.RpcCommunicator;
 import streamr.dht.DhtCallContext;
-import streamr.dht.DhtRpcClient;
 import streamr.dht.getClosestNodes;
 import streamr.dht.Identifiers;
 import streamr.dht.LocalDataStore;
@@ -43,15 +49,16 @@ using streamr::dht::rpcprotocol::DhtCallContext;
 using streamr::dht::store::LocalDataStore;
 using streamr::dht::store::StoreManager;
 using streamr::dht::store::StoreManagerOptions;
+using streamr::dht::store::StoreRpcClient;
 using streamr::dht::store::StoreRpcRemote;
 using streamr::dht::testutils::createMockDataEntry;
 using streamr::dht::testutils::createMockPeerDescriptor;
 using streamr::protorpc::RpcCommunicator;
+using streamr::protorpc::RpcTimeout;
+using streamr::protorpc::UnknownRpcMethod;
 using streamr::utils::blockingWait;
 using streamr::utils::waitForCondition;
 
-using StoreRpcClient = ::dht::StoreRpcClient<DhtCallContext>;
-
 namespace {
 
 constexpr size_t nodeCount = 10;
@@ -74,34 +81,73 @@ public:
           key(std::move(key)) {}
 
     std::vector<DhtAddress> keys() override { return {this->key}; }
-    std::vector<DataEntry> values(
+    std::vector<std::shared_ptr<const DataEntry>> getEntries(
         const std::optional<DhtAddress>& /*key*/) override {
-        return {this->entry};
+        return {std::make_shared<const DataEntry>(this->entry)};
     }
     void setAllEntriesAsStale(const DhtAddress& /*key*/) override {
         ++this->setAllEntriesAsStaleCount;
     }
 };
 
+// Shared by the remotes the manager creates.
+struct RemoteCalls {
+    std::atomic<int> replicateCount{0};
+    std::atomic<bool> lastConnect{false};
+    // Whether the remotes support syncReplicas, whether it times out, and
+    // whether they then report every key as differing.
+    std::atomic<bool> acceptsBatches{false};
+    std::atomic<bool> syncTimesOut{false};
+    std::atomic<bool> holdsOtherVersions{true};
+    std::atomic<int> syncAttemptCount{0};
+    std::atomic<int> syncCount{0};
+    std::atomic<int> batchCount{0};
+    std::atomic<int> batchedEntryCount{0};
+};
+
 class MockStoreRpcRemote : public StoreRpcRemote {
-    std::atomic<int>* replicateCount;
-    std::atomic<bool>* lastConnect;
+    RemoteCalls* calls;
 
 public:
     MockStoreRpcRemote(
         PeerDescriptor local, // NOLINT
         PeerDescriptor remote,
         StoreRpcClient client,
-        std::atomic<int>* replicateCount,
-        std::atomic<bool>* lastConnect)
+        RemoteCalls* calls)
         : StoreRpcRemote(std::move(local), std::move(remote), client),
-          replicateCount(replicateCount),
-          lastConnect(lastConnect) {}
+          calls(calls) {}
 
     folly::coro::Task<void> replicateData(
         ReplicateDataRequest /*request*/, bool connect) override {
-        this->lastConnect->store(connect);
-        this->replicateCount->fetch_add(1);
+        this->calls->lastConnect.store(connect);
+        this->calls->replicateCount.fetch_add(1);
+        co_return;
+    }
+    folly::coro::Task<std::set<DhtAddress>> syncReplicas(
+        std::map<DhtAddress, uint64_t> digests, bool /*connect*/) override {
+        this->calls->syncAttemptCount.fetch_add(1);
+        if (!this->calls->acceptsBatches.load()) {
+            throw UnknownRpcMethod("RPC Method syncReplicas is not provided");
+        }
+        if (this->calls->syncTimesOut.load()) {
+            throw RpcTimeout("Rpc request timed out");
+        }
+        this->calls->syncCount.fetch_add(1);
+        std::set<DhtAddress> keys;
+        if (this->calls->holdsOtherVersions.load()) {
+            for (const auto& [key, digest] : digests) {
+                keys.insert(key);
+            }
+        }
+        co_return keys;
+    }
+    folly::coro::Task<void> replicateDataBatch(
+        std::vector<std::shared_ptr<const DataEntry>> entries,
+        bool connect) override {
+        this->calls->lastConnect.store(connect);
+        this->calls->batchedEntryCount.fetch_add(
+            static_cast<int>(entries.size()));
+        this->calls->batchCount.fetch_add(1);
         co_return;
     }
     folly::coro::Task<void> storeData(StoreDataRequest /*request*/) override {
@@ -116,8 +162,7 @@ protected:
     RpcCommunicator<DhtCallContext> rpcCommunicator;
     DataEntry dataEntry = createMockDataEntry();
     std::vector<PeerDescriptor> allNodes = makeNodes();
-    std::atomic<int> replicateCount{0};
-    std::atomic<bool> lastConnect{false};
+    RemoteCalls calls;
     std::shared_ptr<MockLocalDataStore> localDataStore;
     std::shared_ptr<StoreManager> manager;
 
@@ -164,8 +209,7 @@ protected:
                         localNode,
                         contact,
                         StoreRpcClient(this->rpcCommunicator),
-                        &this->replicateCount,
-                        &this->lastConnect);
+                        &this->calls);
                 },
                 .executeRecursiveOperation =
                     [](const DhtAddress& /*key*/,
@@ -186,8 +230,8 @@ TEST_F(StoreManagerTest, PrimaryStorerNewNodeWithinRedundancy) {
     makeManager(nodeCloseToData(0), redundancyFactor);
     this->manager->onContactAdded(nodeCloseToData(2));
     blockingWait(waitForCondition(
-        [this]() { return this->replicateCount.load() == 1; }));
-    EXPECT_TRUE(this->lastConnect.load());
+        [this]() { return this->calls.replicateCount.load() == 1; }));
+    EXPECT_TRUE(this->calls.lastConnect.load());
     EXPECT_EQ(this->localDataStore->setAllEntriesAsStaleCount, 0);
 }
 
@@ -196,7 +240,7 @@ TEST_F(StoreManagerTest, PrimaryStorerNewNodeNotWithinRedundancy) {
     this->manager->onContactAdded(nodeCloseToData(4));
     std::this_thread::sleep_for(
         std::chrono::milliseconds(replicationWaitMillis));
-    EXPECT_EQ(this->replicateCount.load(), 0);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
     EXPECT_EQ(this->localDataStore->setAllEntriesAsStaleCount, 0);
 }
 
@@ -205,7 +249,7 @@ TEST_F(StoreManagerTest, NotPrimaryStorerThisNodeWithinRedundancy) {
     this->manager->onContactAdded(nodeCloseToData(4));
     std::this_thread::sleep_for(
         std::chrono::milliseconds(replicationWaitMillis));
-    EXPECT_EQ(this->replicateCount.load(), 0);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
     EXPECT_EQ(this->localDataStore->setAllEntriesAsStaleCount, 0);
 }
 
@@ -214,7 +258,7 @@ TEST_F(StoreManagerTest, NotPrimaryStorerThisNodeNotWithinRedundancy) {
     this->manager->onContactAdded(nodeCloseToData(4));
     std::this_thread::sleep_for(
         std::chrono::milliseconds(replicationWaitMillis));
-    EXPECT_EQ(this->replicateCount.load(), 0);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
     EXPECT_EQ(this->localDataStore->setAllEntriesAsStaleCount, 1);
 }
 
@@ -223,6 +267,80 @@ TEST_F(StoreManagerTest, NotPrimaryWithinRedundancyFewNeighbors) {
     this->manager->onContactAdded(nodeCloseToData(4));
     std::this_thread::sleep_for(
         std::chrono::milliseconds(replicationWaitMillis));
-    EXPECT_EQ(this->replicateCount.load(), 0);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
     EXPECT_EQ(this->localDataStore->setAllEntriesAsStaleCount, 0);
 }
+
+TEST_F(StoreManagerTest, PrimaryStorerReplicatesInBatchWhenSupported) {
+    this->calls.acceptsBatches = true;
+    makeManager(nodeCloseToData(0), redundancyFactor);
+    this->manager->onContactAdded(nodeCloseToData(2));
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.batchCount.load() == 1; }));
+    EXPECT_EQ(this->calls.syncCount.load(), 1);
+    EXPECT_EQ(this->calls.batchedEntryCount.load(), 1);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
+    EXPECT_TRUE(this->calls.lastConnect.load());
+}
+
+TEST_F(StoreManagerTest, MatchingReplicaDigestsSendNoEntries) {
+    this->calls.acceptsBatches = true;
+    this->calls.holdsOtherVersions = false;
+    makeManager(nodeCloseToData(0), redundancyFactor);
+    this->manager->onContactAdded(nodeCloseToData(2));
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.syncCount.load() == 1; }));
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(replicationWaitMillis));
+    EXPECT_EQ(this->calls.batchCount.load(), 0);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
+}
+
+TEST_F(StoreManagerTest, DestroySendsOneBatchPerClosestNeighbor) {
+    this->calls.acceptsBatches = true;
+    makeManager(nodeCloseToData(0), redundancyFactor);
+    blockingWait(this->manager->destroy());
+    this->manager.reset();
+    const auto neighborCount = static_cast<int>(redundancyFactor);
+    EXPECT_EQ(this->calls.syncCount.load(), neighborCount);
+    EXPECT_EQ(this->calls.batchCount.load(), neighborCount);
+    EXPECT_EQ(this->calls.replicateCount.load(), 0);
+    EXPECT_FALSE(this->calls.lastConnect.load());
+}
+
+TEST_F(StoreManagerTest, FailedSyncFallsBackToReplicateData) {
+    this->calls.acceptsBatches = true;
+    this->calls.syncTimesOut = true;
+    makeManager(nodeCloseToData(0), redundancyFactor);
+    this->manager->onContactAdded(nodeCloseToData(2));
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.replicateCount.load() == 1; }));
+    EXPECT_EQ(this->calls.batchCount.load(), 0);
+
+    // A failure is not remembered: the next replication asks again.
+    this->calls.syncTimesOut = false;
+    this->manager->onContactAdded(nodeCloseToData(2));
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.batchCount.load() == 1; }));
+    EXPECT_EQ(this->calls.syncAttemptCount.load(), 2);
+}
+
+TEST_F(StoreManagerTest, LegacyContactIsAskedAgainAfterDisconnect) {
+    makeManager(nodeCloseToData(0), redundancyFactor);
+    const auto contact = nodeCloseToData(2);
+    this->manager->onContactAdded(contact);
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.replicateCount.load() == 1; }));
+    this->manager->onContactAdded(contact);
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.replicateCount.load() == 2; }));
+    EXPECT_EQ(this->calls.syncAttemptCount.load(), 1);
+
+    this->manager->onContactDisconnected(contact);
+    this->calls.acceptsBatches = true;
+    this->manager->onContactAdded(contact);
+    blockingWait(waitForCondition(
+        [this]() { return this->calls.batchCount.load() == 1; }));
+    EXPECT_EQ(this->calls.syncAttemptCount.load(), 2);
+    EXPECT_EQ(this->calls.replicateCount.load(), 2);
+}
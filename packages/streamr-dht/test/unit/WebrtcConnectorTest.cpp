@@ -14,6 +14,7 @@
 import streamr.dht.Connection;
 import streamr.dht.FakeTransport;
 import streamr.dht.IPendingConnection;
+import streamr.dht.SendBuffer;
 import streamr.dht.TestUtils;
 import streamr.dht.WebrtcConnector;
 import streamr.dht.protos;
@@ -22,6 +23,7 @@ using ::dht::PeerDescriptor;
 using streamr::dht::connection::Connection;
 using streamr::dht::connection::ConnectionType;
 using streamr::dht::connection::IPendingConnection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::webrtc::WebrtcConnector;
 using streamr::dht::connection::webrtc::WebrtcConnectorOptions;
 using streamr::dht::testutils::createMockPeerDescriptor;
@@ -33,7 +35,7 @@ namespace {
 class MockConnection : public Connection {
 public:
     MockConnection() : Connection(ConnectionType::WEBRTC) {}
-    void send(const std::vector<std::byte>& /*data*/) override {}
+    void send(const SendBuffer& /*data*/) override {}
     void close(bool /*gracefulLeave*/) override {}
     void destroy() override {}
 };
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+import streamr.dht.SendBuffer;
 import streamr.dht.WebsocketClientConnection;
 
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::websocket::WebsocketClientConnection;
 
 TEST(WebsocketClientConnection, TestCanBeCreated) {
@@ -17,5 +19,5 @@ TEST(WebsocketClientConnection, TestCannotSendDataIfNoConnection) {
     auto connection = WebsocketClientConnection::newInstance();
     std::vector<std::byte> message;
     message.push_back(std::byte{1});
-    connection->send(message);
+    connection->send(SendBuffer(message));
 }
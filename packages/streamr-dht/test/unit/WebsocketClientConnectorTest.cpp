@@ -6,6 +6,7 @@ import streamr.dht.Connection;
 import streamr.dht.IPendingConnection;
 import streamr.dht.Identifiers;
 import streamr.dht.ListeningRpcCommunicator;
+import streamr.dht.SendBuffer;
 import streamr.dht.Transport;
 import streamr.dht.WebsocketClientConnector;
 import streamr.dht.protos;
@@ -14,6 +15,7 @@ using ::dht::NodeType;
 using ::dht::PeerDescriptor;
 using streamr::dht::DhtAddress;
 using streamr::dht::connection::IPendingConnection;
+using streamr::dht::connection::SendBuffer;
 using streamr::dht::connection::pendingconnectionevents::Disconnected;
 using streamr::dht::connection::websocket::WebsocketClientConnector;
 using streamr::dht::connection::websocket::WebsocketClientConnectorOptions;
@@ -38,7 +40,7 @@ public:
         : Connection(
               streamr::dht::connection::ConnectionType::WEBSOCKET_CLIENT) {}
 
-    void send(const std::vector<std::byte>& data) override {}
+    void send(const SendBuffer& data) override {}
 
     void close(bool gracefulLeave) override {}
 
@@ -77,3 +77,40 @@ TEST(getClosestNodes, HappyPath) {
 
     EXPECT_EQ(nodeIdsOf(actual), nodeIdsOf(expected));
 }
+
+TEST(getClosestNodes, ReturnsEachNodeOnce) {
+    std::vector<PeerDescriptor> peerDescriptors;
+    for (size_t i = 0; i < descriptorCount; ++i) {
+        peerDescriptors.push_back(createMockPeerDescriptor());
+    }
+    const DhtAddress referenceId = Identifiers::createRandomDhtAddress();
+    const auto unique = getClosestNodes(referenceId, peerDescriptors);
+    ASSERT_EQ(unique.size(), descriptorCount);
+    // Every node three times: the duplicates must not take any of the
+    // maxCount slots.
+    std::vector<PeerDescriptor> repeated;
+    for (size_t round = 0; round < 3; ++round) {
+        repeated.insert(
+            repeated.end(), peerDescriptors.begin(), peerDescriptors.end());
+    }
+    EXPECT_EQ(
+        nodeIdsOf(getClosestNodes(
+            referenceId,
+            repeated,
+            GetClosestNodesOptions{.maxCount = maxCount})),
+        nodeIdsOf(std::vector<PeerDescriptor>(
+            unique.begin(),
+            unique.begin() + static_cast<std::ptrdiff_t>(maxCount))));
+    EXPECT_EQ(
+        nodeIdsOf(getClosestNodes(referenceId, repeated)), nodeIdsOf(unique));
+}
+
+TEST(getClosestNodes, ZeroMaxCountReturnsNothing) {
+    const std::vector<PeerDescriptor> peerDescriptors{
+        createMockPeerDescriptor()};
+    EXPECT_TRUE(getClosestNodes(
+                    Identifiers::createRandomDhtAddress(),
+                    peerDescriptors,
+                    GetClosestNodesOptions{.maxCount = 0})
+                    .empty());
+}
@@ -0,0 +1,91 @@
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.Identifiers;
+import streamr.dht.getPeerDistance;
+
+using streamr::dht::DhtAddress;
+using streamr::dht::DhtAddressRaw;
+using streamr::dht::NodeId;
+using streamr::dht::helpers::getPeerDistance;
+
+namespace {
+
+DhtAddressRaw rawFromBytes(const std::vector<unsigned char>& bytes) {
+    return DhtAddressRaw{std::string(bytes.begin(), bytes.end())};
+}
+
+NodeId nodeIdFromHex(const std::string& hex) {
+    return NodeId::fromDhtAddress(DhtAddress{hex});
+}
+
+} // namespace
+
+TEST(getPeerDistance, DistanceToSelfIsZero) {
+    const auto id = nodeIdFromHex("1234567890abcdef1234567890abcdef12345678");
+    EXPECT_EQ(getPeerDistance(id, id), getPeerDistance(NodeId{}, NodeId{}));
+}
+
+TEST(getPeerDistance, IsSymmetric) {
+    const auto a = nodeIdFromHex("1234567890abcdef1234567890abcdef12345678");
+    const auto b = nodeIdFromHex("ffffffff00000000ffffffff00000000ffffffff");
+    EXPECT_EQ(getPeerDistance(a, b), getPeerDistance(b, a));
+    EXPECT_EQ(
+        getPeerDistance(a.toRaw(), b.toRaw()), getPeerDistance(a, b));
+}
+
+TEST(getPeerDistance, DistinguishesIdsDifferingInTheLowestBit) {
+    // A double keeps 53 significant bits, so these two distances used to
+    // fold to the same value.
+    const auto target =
+        nodeIdFromHex("8000000000000000000000000000000000000000");
+    const auto closer =
+        nodeIdFromHex("0000000000000000000000000000000000000000");
+    const auto further =
+        nodeIdFromHex("0000000000000000000000000000000000000001");
+    EXPECT_GT(
+        getPeerDistance(target, further), getPeerDistance(target, closer));
+    EXPECT_NE(
+        getPeerDistance(target, closer), getPeerDistance(target, further));
+}
+
+TEST(getPeerDistance, HighWordDominates) {
+    const auto target =
+        nodeIdFromHex("0000000000000000000000000000000000000000");
+    const auto high =
+        nodeIdFromHex("0000000100000000000000000000000000000000");
+    const auto low = nodeIdFromHex("00000000ffffffffffffffffffffffffffffffff");
+    EXPECT_LT(getPeerDistance(target, low), getPeerDistance(target, high));
+}
+
+TEST(getPeerDistance, ShortIdsFollowTheKBucketFold) {
+    const auto target = rawFromBytes({0x00, 0x02});
+    EXPECT_LT(
+        getPeerDistance(rawFromBytes({0x00, 0x03}), target),
+        getPeerDistance(rawFromBytes({0x01, 0x02}), target));
+    // The byte only the longer id has counts as 0xff.
+    EXPECT_EQ(
+        getPeerDistance(rawFromBytes({0x00}), target),
+        getPeerDistance(
+            rawFromBytes({0x00, 0xff}), rawFromBytes({0x00, 0x00})));
+    // Short NodeIds fold the same way.
+    EXPECT_EQ(
+        getPeerDistance(
+            NodeId::fromRaw(rawFromBytes({0x00})), NodeId::fromRaw(target)),
+        getPeerDistance(rawFromBytes({0x00}), target));
+}
+
+TEST(getPeerDistance, IdsLongerThanAKademliaIdSortLast) {
+    const DhtAddressRaw tooLong{std::string(21, 'a')};
+    const auto id =
+        nodeIdFromHex("ffffffffffffffffffffffffffffffffffffff00").toRaw();
+    EXPECT_EQ(
+        getPeerDistance(tooLong, tooLong), getPeerDistance(NodeId{}, NodeId{}));
+    EXPECT_GT(getPeerDistance(tooLong, id), getPeerDistance(NodeId{}, id));
+    EXPECT_EQ(getPeerDistance(id, tooLong), getPeerDistance(tooLong, id));
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -15,7 +15,9 @@
 
 #include <ada.h>
 #include <stdint.h> // NOLINT
+#include <array>
 #include <atomic>
+#include <charconv>
 #include <chrono>
 #include <cstdlib>
 #include <map>
@@ -25,6 +27,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <utility>
 #include <vector>
 #include <folly/Singleton.h>
@@ -77,7 +80,7 @@ using streamr::trackerlessnetwork::proxy::ProxyClientOptions;
 using streamr::utils::BinaryUtils;
 using streamr::utils::blockingWait;
 using streamr::utils::EthereumAddress;
-using streamr::utils::SigningUtils;
+using streamr::utils::Signer;
 using streamr::utils::StreamPartID;
 using streamr::utils::StreamPartIDUtils;
 using streamr::utils::toEthereumAddress;
@@ -237,6 +240,135 @@ public:
     }
 };
 
+// The streamrNodeSubscribe callbacks of one node, indexed by stream part.
+// The node gets a single message listener that looks up the message's
+// stream part and calls only the callbacks subscribed to it, so the
+// dispatch cost does not grow with the number of subscriptions.
+//
+// Subscribing and unsubscribing replace the table (copy-on-write);
+// dispatch only copies the current table pointer under the lock and runs
+// the callbacks without it, so a callback that blocks does not stall
+// subscription changes, and vice versa.
+class StreamPartSubscriptions {
+private:
+    struct Subscriber {
+        uint64_t handle;
+        StreamrNodeMessageCallback callback;
+        void* userData;
+    };
+
+    struct StreamPartKey {
+        std::string streamId;
+        int32_t partition;
+    };
+
+    // Looks up MessageID fields without building a StreamPartKey.
+    struct StreamPartKeyLess {
+        using is_transparent = void;
+
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return std::tie(a.streamId, a.partition) <
+                std::tie(b.streamId, b.partition);
+        }
+    };
+
+    struct StreamPartKeyView {
+        std::string_view streamId;
+        int32_t partition;
+    };
+
+    struct StreamPartEntry {
+        std::string streamPartId; // canonical, passed to the callbacks
+        std::vector<Subscriber> subscribers;
+    };
+
+    using Table = std::map<StreamPartKey, StreamPartEntry, StreamPartKeyLess>;
+
+    uint64_t nodeHandle;
+    std::mutex mutex;
+    std::shared_ptr<const Table> table = std::make_shared<const Table>();
+    // subscription handle -> its stream part, for unsubscribe
+    std::map<uint64_t, StreamPartKey> handles;
+
+public:
+    explicit StreamPartSubscriptions(uint64_t nodeHandle)
+        : nodeHandle(nodeHandle) {}
+
+    void add(
+        uint64_t subscriptionHandle,
+        const StreamPartID& streamPartId,
+        StreamrNodeMessageCallback callback,
+        void* userData) {
+        StreamPartKey key{
+            .streamId =
+                std::string(StreamPartIDUtils::getStreamID(streamPartId)),
+            .partition = static_cast<int32_t>(
+                StreamPartIDUtils::getStreamPartition(streamPartId).value())};
+        std::scoped_lock lock(this->mutex);
+        auto table = std::make_shared<Table>(*this->table);
+        auto& entry = (*table)[key];
+        entry.streamPartId = std::string(streamPartId);
+        entry.subscribers.push_back(
+            Subscriber{
+                .handle = subscriptionHandle,
+                .callback = callback,
+                .userData = userData});
+        this->table = std::move(table);
+        this->handles.emplace(subscriptionHandle, std::move(key));
+    }
+
+    // False if the handle is not subscribed.
+    bool remove(uint64_t subscriptionHandle) {
+        std::scoped_lock lock(this->mutex);
+        const auto handle = this->handles.find(subscriptionHandle);
+        if (handle == this->handles.end()) {
+            return false;
+        }
+        auto table = std::make_shared<Table>(*this->table);
+        const auto entry = table->find(handle->second);
+        std::erase_if(
+            entry->second.subscribers,
+            [subscriptionHandle](const Subscriber& subscriber) {
+                return subscriber.handle == subscriptionHandle;
+            });
+        if (entry->second.subscribers.empty()) {
+            table->erase(entry);
+        }
+        this->table = std::move(table);
+        this->handles.erase(handle);
+        return true;
+    }
+
+    // The node's message listener. Runs on an internal network thread.
+    void dispatch(const StreamMessage& message) {
+        if (!message.has_contentmessage()) {
+            return;
+        }
+        std::shared_ptr<const Table> table;
+        {
+            std::scoped_lock lock(this->mutex);
+            table = this->table;
+        }
+        const auto entry = table->find(
+            StreamPartKeyView{
+                .streamId = message.messageid().streamid(),
+                .partition = message.messageid().streampartition()});
+        if (entry == table->end()) {
+            return;
+        }
+        const auto& content = message.contentmessage().content();
+        for (const auto& subscriber : entry->second.subscribers) {
+            subscriber.callback(
+                this->nodeHandle,
+                entry->second.streamPartId.c_str(),
+                content.data(),
+                content.size(),
+                subscriber.userData);
+        }
+    }
+};
+
 class LibProxyClientApi {
 private:
     class ProxyClientWrapper {
@@ -569,6 +701,28 @@ public:
         return successfullyConnected.size();
     }
 
+    // Publishing threads keep a Signer for the key they last signed with,
+    // so the key is parsed once rather than for every message.
+    static const Signer& getSigner(std::string_view privateKeyHex) {
+        thread_local std::string cachedPrivateKeyHex;
+        thread_local std::optional<Signer> cachedSigner;
+        if (!cachedSigner.has_value() || cachedPrivateKeyHex != privateKeyHex) {
+            cachedSigner.emplace(std::string(privateKeyHex));
+            cachedPrivateKeyHex = privateKeyHex;
+        }
+        return cachedSigner.value();
+    }
+
+    // Decimal digits of `value` in `buffer`, for the signature payload.
+    template <typename Integer>
+    static std::string_view toDecimal(
+        Integer value, std::array<char, 24>& buffer) { // NOLINT
+        const auto end =
+            std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)
+                .ptr;
+        return {buffer.data(), static_cast<size_t>(end - buffer.data())};
+    }
+
     // Shared by proxyClientPublish and streamrNodePublish: the message
     // layout and the signature payload are identical for both APIs.
     static StreamMessage buildStreamMessage(
@@ -579,65 +733,47 @@ public:
         uint64_t contentLength,
         const char* ethereumPrivateKey) {
         StreamMessage message;
-        std::string contentString(content, contentLength);
+        const std::string_view contentView(content, contentLength);
         auto* contentMessage = message.mutable_contentmessage();
-        contentMessage->set_content(contentString);
+        contentMessage->set_content(contentView);
         contentMessage->set_contenttype(ContentType::BINARY);
         contentMessage->set_encryptiontype(EncryptionType::NONE);
 
-        MessageID messageId;
         if (!publisherIdHex.starts_with("0x")) {
             publisherIdHex = "0x" + publisherIdHex;
         }
-        messageId.set_publisherid(
+        auto* messageId = message.mutable_messageid();
+        messageId->set_publisherid(
             BinaryUtils::hexToBinaryString(publisherIdHex));
-        messageId.set_messagechainid("1");
-        messageId.set_timestamp(
+        messageId->set_messagechainid("1");
+        messageId->set_timestamp(
             std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::system_clock::now().time_since_epoch())
                 .count());
-        messageId.set_sequencenumber(sequenceNumber);
+        messageId->set_sequencenumber(sequenceNumber);
 
-        messageId.set_streampartition(
+        messageId->set_streampartition(
             static_cast<int32_t>(
                 StreamPartIDUtils::getStreamPartition(streamPartID).value()));
-        messageId.set_streamid(StreamPartIDUtils::getStreamID(streamPartID));
-
-        message.mutable_messageid()->CopyFrom(messageId);
+        messageId->set_streamid(StreamPartIDUtils::getStreamID(streamPartID));
 
         if (ethereumPrivateKey) {
-            std::string signaturePayload = messageId.streamid() +
-                std::to_string(messageId.streampartition()) +
-                std::to_string(messageId.timestamp()) +
-                std::to_string(messageId.sequencenumber()) + publisherIdHex +
-                messageId.messagechainid() + contentString;
-
-            SLogger::trace("Signature payload: ");
-            SLogger::trace("");
-            SLogger::trace(
-                "messageId.streamid(): \"" + messageId.streamid() + "\"");
-            SLogger::trace(
-                "messageId.streampartition(): \"" +
-                std::to_string(messageId.streampartition()) + "\"");
-            SLogger::trace(
-                "messageId.timestamp(): \"" +
-                std::to_string(messageId.timestamp()) + "\"");
-            SLogger::trace(
-                "messageId.sequencenumber(): \"" +
-                std::to_string(messageId.sequencenumber()) + "\"");
-            SLogger::trace("publisheridHex(): \"" + publisherIdHex + "\"");
-            SLogger::trace(
-                "messageId.messagechainid(): \"" + messageId.messagechainid() +
-                "\"");
-            SLogger::trace("contentString: \"" + contentString + "\"");
-            SLogger::trace("");
-
-            SLogger::trace(
-                "Signing payload as hex string: \"" +
-                BinaryUtils::binaryStringToHex(signaturePayload) + "\"");
-            auto signature = SigningUtils::createSignature(
-                signaturePayload, ethereumPrivateKey);
-
+            // The payload is streamId, partition, timestamp, sequence
+            // number, publisher id (hex), message chain id and content,
+            // concatenated; the signer hashes the pieces in place.
+            std::array<char, 24> partition{}; // NOLINT
+            std::array<char, 24> timestamp{}; // NOLINT
+            std::array<char, 24> sequence{}; // NOLINT
+            const auto signature =
+                getSigner(ethereumPrivateKey)
+                    .signParts(
+                        {messageId->streamid(),
+                         toDecimal(messageId->streampartition(), partition),
+                         toDecimal(messageId->timestamp(), timestamp),
+                         toDecimal(messageId->sequencenumber(), sequence),
+                         publisherIdHex,
+                         messageId->messagechainid(),
+                         contentView});
             message.set_signature(signature);
             message.set_signaturetype(SignatureType::ECDSA_SECP256K1_EVM);
             SLogger::trace(
@@ -732,7 +868,9 @@ private:
         std::atomic<int32_t> sequenceNumber = 1;
         std::atomic<bool> started{false};
         std::atomic<bool> stopped{false};
-        std::map<uint64_t, HandlerToken> subscriptions;
+        std::shared_ptr<StreamPartSubscriptions> subscriptions;
+        // Registered with the node on the first subscribe.
+        std::optional<HandlerToken> messageListener;
         std::mutex subscriptionsMutex;
 
     public:
@@ -742,7 +880,9 @@ private:
             std::string ownEthereumAddress)
             : handle(handle),
               networkNode(std::move(networkNode)),
-              ownEthereumAddress(std::move(ownEthereumAddress)) {}
+              ownEthereumAddress(std::move(ownEthereumAddress)),
+              subscriptions(
+                  std::make_shared<StreamPartSubscriptions>(handle)) {}
 
         // NOLINTNEXTLINE(bugprone-exception-escape)
         ~StreamrNodeWrapper() {
@@ -779,21 +919,28 @@ private:
             return this->sequenceNumber.fetch_add(1);
         }
 
-        void addSubscription(uint64_t subscriptionHandle, HandlerToken token) {
+        void addSubscription(
+            uint64_t subscriptionHandle,
+            const StreamPartID& streamPartId,
+            StreamrNodeMessageCallback callback,
+            void* userData) {
             std::scoped_lock lock(this->subscriptionsMutex);
-            this->subscriptions.emplace(subscriptionHandle, token);
+            this->subscriptions->add(
+                subscriptionHandle, streamPartId, callback, userData);
+            if (!this->messageListener.has_value()) {
+                // The listener holds the table, not the wrapper: the node
+                // may dispatch a message while the wrapper is destroyed.
+                this->messageListener = this->networkNode->addMessageListener(
+                    [subscriptions = this->subscriptions](
+                        const StreamMessage& message) {
+                        subscriptions->dispatch(message);
+                    });
+            }
         }
 
-        std::optional<HandlerToken> takeSubscription(
-            uint64_t subscriptionHandle) {
-            std::scoped_lock lock(this->subscriptionsMutex);
-            auto subscription = this->subscriptions.find(subscriptionHandle);
-            if (subscription == this->subscriptions.end()) {
-                return std::nullopt;
-            }
-            auto token = subscription->second;
-            this->subscriptions.erase(subscription);
-            return token;
+        // False if the handle is not subscribed.
+        bool removeSubscription(uint64_t subscriptionHandle) {
+            return this->subscriptions->remove(subscriptionHandle);
         }
     };
 
@@ -1199,39 +1346,9 @@ public:
         }
         try {
             blockingWait(node->getNetworkNode()->join(*parsedStreamPartId));
-            const std::string streamPartIdString{*parsedStreamPartId};
-            const std::string streamId{
-                StreamPartIDUtils::getStreamID(*parsedStreamPartId)};
-            const auto streamPartition = static_cast<int32_t>(
-                StreamPartIDUtils::getStreamPartition(*parsedStreamPartId)
-                    .value());
-            auto token = node->getNetworkNode()->addMessageListener(
-                // The manager emits every received message; filter to the
-                // subscribed stream part here. Runs on an internal
-                // network thread (documented in streamrnode.h).
-                [nodeHandle,
-                 streamPartIdString,
-                 streamId,
-                 streamPartition,
-                 callback,
-                 userData](const StreamMessage& message) {
-                    if (message.messageid().streamid() != streamId ||
-                        message.messageid().streampartition() !=
-                            streamPartition ||
-                        !message.has_contentmessage()) {
-                        return;
-                    }
-                    const auto& messageContent =
-                        message.contentmessage().content();
-                    callback(
-                        nodeHandle,
-                        streamPartIdString.c_str(),
-                        messageContent.data(),
-                        messageContent.size(),
-                        userData);
-                });
             uint64_t subscriptionHandle = createRandomHandle();
-            node->addSubscription(subscriptionHandle, token);
+            node->addSubscription(
+                subscriptionHandle, *parsedStreamPartId, callback, userData);
             *result = addResult({}, {});
             return subscriptionHandle;
         } catch (const std::exception& e) {
@@ -1252,8 +1369,7 @@ public:
         if (!node) {
             return;
         }
-        auto token = node->takeSubscription(subscriptionHandle);
-        if (!token.has_value()) {
+        if (!node->removeSubscription(subscriptionHandle)) {
             *result = addResult(
                 {ErrorCpp(
                     "Subscription not found with handle " +
@@ -1263,7 +1379,6 @@ public:
                 {});
             return;
         }
-        node->getNetworkNode()->removeMessageListener(*token);
         *result = addResult({}, {});
     }
 
@@ -48,6 +48,11 @@ struct ReceivedMessages {
         self->contents.emplace_back(content, contentLength);
     }
 
+    size_t size() {
+        const std::scoped_lock lock(this->mutex);
+        return this->contents.size();
+    }
+
     bool contains(const std::string& expected) {
         const std::scoped_lock lock(this->mutex);
         return std::ranges::any_of(
@@ -73,6 +78,8 @@ protected:
     static constexpr const char* invalidStreamPartId = "INVALID_STREAM_PART_ID";
     static constexpr const char* validStreamPartId =
         "0xa000000000000000000000000000000000000000#01";
+    static constexpr const char* otherStreamPartId =
+        "0xa000000000000000000000000000000000000000#2";
     static constexpr const char* invalidUrl = "poiejrg039utg240";
     static constexpr uint64_t nonExistentNodeHandle = 12345;
     static constexpr uint16_t exchangeEntryPointPort = 44451;
@@ -295,6 +302,67 @@ TEST_F(StreamrNodeTest, StartStopLifecycle) {
     streamrResultDelete(result);
 }
 
+TEST_F(StreamrNodeTest, SubscriptionsOnlyReceiveTheirStreamPart) {
+    // An isolated node delivers its own publishes to its subscriptions.
+    const StreamrResult* result = nullptr;
+    uint64_t nodeHandle = streamrNodeNew(&result, ethereumAddressA, nullptr);
+    ASSERT_NE(nodeHandle, 0);
+    streamrResultDelete(result);
+    streamrNodeStart(&result, nodeHandle);
+    expectNoErrors(result);
+    streamrResultDelete(result);
+
+    ReceivedMessages first;
+    ReceivedMessages second;
+    ReceivedMessages other;
+    const auto subscribe = [&](const char* streamPartId,
+                               ReceivedMessages& received) {
+        const auto handle = streamrNodeSubscribe(
+            &result,
+            nodeHandle,
+            streamPartId,
+            ReceivedMessages::callback,
+            &received);
+        expectNoErrors(result);
+        streamrResultDelete(result);
+        return handle;
+    };
+    const auto publish = [&](const std::string& content) {
+        streamrNodePublish(
+            &result,
+            nodeHandle,
+            validStreamPartId,
+            content.data(),
+            content.size(),
+            nullptr);
+        expectNoErrors(result);
+        streamrResultDelete(result);
+    };
+    const auto firstSubscription = subscribe(validStreamPartId, first);
+    ASSERT_NE(firstSubscription, 0);
+    ASSERT_NE(subscribe(validStreamPartId, second), 0);
+    ASSERT_NE(subscribe(otherStreamPartId, other), 0);
+
+    // Both subscriptions of a stream part are called in the same
+    // dispatch, so once `second` has the message `first` has it too.
+    publish("to both");
+    EXPECT_TRUE(waitUntil(
+        [&]() { return second.contains("to both"); }, messageTimeout));
+    EXPECT_TRUE(first.contains("to both"));
+
+    streamrNodeUnsubscribe(&result, nodeHandle, firstSubscription);
+    expectNoErrors(result);
+    streamrResultDelete(result);
+    publish("to second");
+    EXPECT_TRUE(waitUntil(
+        [&]() { return second.contains("to second"); }, messageTimeout));
+    EXPECT_EQ(first.size(), 1U);
+    EXPECT_EQ(other.size(), 0U);
+
+    streamrNodeDelete(&result, nodeHandle);
+    streamrResultDelete(result);
+}
+
 TEST_F(StreamrNodeTest, TwoNodesExchangeMessages) {
     // Node A runs a websocket server and acts as the entry point of a
     // new network; node B joins through it as a websocket client.
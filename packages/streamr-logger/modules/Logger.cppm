@@ -4,10 +4,13 @@
 // this file is now the source of truth.
 module;
 
+#include <concepts>
+#include <functional>
 #include <memory>
 #include <source_location>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <nlohmann/json.hpp>
 
@@ -26,10 +29,24 @@ using streamr::json::toJson;
 // const char* (not string_view): passed to getenv(), which needs a
 // null-terminated string.
 inline constexpr const char* envLogLevelName = "LOG_LEVEL";
+
+// A log message is either a string or a callable that returns one. The
+// callable runs only if the message is written, so a message that is
+// expensive to build (a concatenation, a DebugString()) costs nothing at
+// a disabled level. Metadata may likewise be a callable that returns the
+// metadata.
+template <typename M>
+concept LogMessage = std::convertible_to<M, std::string_view> ||
+    (std::invocable<std::remove_reference_t<M>&> &&
+     std::convertible_to<
+         std::invoke_result_t<std::remove_reference_t<M>&>,
+         std::string_view>);
+
 class Logger {
 private:
     std::shared_ptr<LoggerImpl> mLoggerImpl;
     StreamrLogLevel mLoggerLogLevel;
+    int mMinEnabledLogLevelValue = 0;
     nlohmann::json mContextBindings;
 
 public:
@@ -74,6 +91,8 @@ public:
         }
 
         mLoggerImpl->init(mLoggerLogLevel);
+        mMinEnabledLogLevelValue = getStreamrLogLevelValue(
+            mLoggerImpl->getMinEnabledLogLevel(mLoggerLogLevel));
     }
 
     /**
@@ -90,98 +109,98 @@ public:
 
     /**
      * @brief Log a message at the trace level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void trace(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Trace{}, msg, metadata, location);
+        log<streamrloglevel::Trace>(msg, metadata, location);
     }
 
     /**
      * @brief Log a message at the debug level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void debug(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Debug{}, msg, metadata, location);
+        log<streamrloglevel::Debug>(msg, metadata, location);
     }
 
     /**
      * @brief Log a message at the info level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void info(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Info{}, msg, metadata, location);
+        log<streamrloglevel::Info>(msg, metadata, location);
     }
 
     /**
      * @brief Log a message at the warn level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void warn(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Warn{}, msg, metadata, location);
+        log<streamrloglevel::Warn>(msg, metadata, location);
     }
 
     /**
      * @brief Log a message at the error level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void error(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Error{}, msg, metadata, location);
+        log<streamrloglevel::Error>(msg, metadata, location);
     }
 
     /**
      * @brief Log a message at the fatal level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     void fatal(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        log(streamrloglevel::Fatal{}, msg, metadata, location);
+        log<streamrloglevel::Fatal>(msg, metadata, location);
     }
 
 private:
@@ -201,23 +220,41 @@ private:
         return nlohmann::json::object({{key, element}});
     }
 
+    // A lazy message or metadata is evaluated here, a plain one passed on.
+    template <typename T>
+    static decltype(auto) evaluate(T& value) {
+        if constexpr (std::invocable<T&>) {
+            return std::invoke(value);
+        } else {
+            return (value);
+        }
+    }
+
     // MetadataType can be any type that is convertible to JSON by
-    // streamr-json
-    template <typename MetadataType>
+    // streamr-json, or a callable that returns one. The level is checked
+    // before any formatting: a message below the compile-time minimum
+    // compiles to nothing, one below the runtime minimum returns here.
+    template <typename LogLevel, typename M, typename MetadataType>
     void log(
-        const StreamrLogLevel messageLogLevel,
-        std::string_view msg,
-        MetadataType metadata,
+        M& msg,
+        MetadataType& metadata,
         const std::source_location& location) {
-        // Merge the possible metadata with the context bindings
-
-        auto metadataJson = ensureJsonObject(toJson(metadata), "metadata");
-        metadataJson.merge_patch(mContextBindings);
-        auto metadataString =
-            metadataJson.empty() ? "" : (" " + metadataJson.dump());
-
-        mLoggerImpl->sendLogMessage(
-            messageLogLevel, msg, metadataString, location);
+        if constexpr (isLogLevelCompiledIn<LogLevel>) {
+            if (LogLevel::value < mMinEnabledLogLevelValue) {
+                return;
+            }
+            // Merge the possible metadata with the context bindings
+
+            auto metadataJson =
+                ensureJsonObject(toJson(evaluate(metadata)), "metadata");
+            metadataJson.merge_patch(mContextBindings);
+            auto metadataString =
+                metadataJson.empty() ? "" : (" " + metadataJson.dump());
+
+            const auto& text = evaluate(msg);
+            mLoggerImpl->sendLogMessage(
+                LogLevel{}, std::string_view{text}, metadataString, location);
+        }
     }
 };
 
@@ -27,6 +27,15 @@ public:
         std::string_view msg,
         std::string_view metadata,
         const std::source_location& location) = 0;
+
+    // The lowest level at which this implementation may still write a
+    // message of a logger initialized with loggerLogLevel. Logger drops
+    // the messages below it before formatting them; the default keeps
+    // every message.
+    [[nodiscard]] virtual StreamrLogLevel getMinEnabledLogLevel(
+        StreamrLogLevel /* loggerLogLevel */) const {
+        return streamrloglevel::Trace{};
+    }
 };
 
 } // namespace streamr::logger
\ No newline at end of file
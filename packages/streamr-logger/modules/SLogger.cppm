@@ -7,12 +7,14 @@ module;
 #include <source_location>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <nlohmann/json.hpp>
 
 export module streamr.logger.SLogger;
 
 import streamr.json.toJson;
 import streamr.logger.Logger;
+import streamr.logger.StreamrLogLevel;
 
 export namespace streamr::logger {
 
@@ -21,98 +23,116 @@ class SLogger {
 public:
     /**
      * @brief Log a message at the trace level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void trace(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().trace(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Trace>) {
+            Logger::instance().trace(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 
     /**
      * @brief Log a message at the debug level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void debug(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().debug(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Debug>) {
+            Logger::instance().debug(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 
     /**
      * @brief Log a message at the info level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void info(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().info(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Info>) {
+            Logger::instance().info(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 
     /**
      * @brief Log a message at the warn level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void warn(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().warn(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Warn>) {
+            Logger::instance().warn(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 
     /**
      * @brief Log a message at the error level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void error(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().error(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Error>) {
+            Logger::instance().error(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 
     /**
      * @brief Log a message at the fatal level.
-     * @param msg Message to log.
+     * @param msg Message to log, or a callable that returns it.
      * @param metadata (any type except classes/structs with private sections)
-     * Metadata to add to the log message.
+     * Metadata to add to the log message, or a callable that returns it.
      */
 
-    template <typename T = StreamrJsonInitializerList>
+    template <LogMessage M, typename T = StreamrJsonInitializerList>
     static void fatal(
-        std::string_view msg,
+        M&& msg,
         T metadata = {},
         const std::source_location& location =
             std::source_location::current()) {
-        Logger::instance().fatal(msg, metadata, location);
+        if constexpr (isLogLevelCompiledIn<streamrloglevel::Fatal>) {
+            Logger::instance().fatal(
+                std::forward<M>(msg), std::move(metadata), location);
+        }
     }
 };
 }; // namespace streamr::logger
\ No newline at end of file
@@ -9,6 +9,16 @@ module;
 #include <type_traits>
 #include <variant>
 
+// Levels below STREAMR_LOG_MIN_LEVEL (0 = trace ... 5 = fatal) are
+// compiled out; set through the CMake cache variable of the same name.
+#ifndef STREAMR_LOG_MIN_LEVEL
+#define STREAMR_LOG_MIN_LEVEL 0
+#endif
+
+static_assert(
+    STREAMR_LOG_MIN_LEVEL >= 0 && STREAMR_LOG_MIN_LEVEL <= 5,
+    "STREAMR_LOG_MIN_LEVEL must be between 0 (trace) and 5 (fatal)");
+
 export module streamr.logger.StreamrLogLevel;
 
 import streamr.logger.StreamrLogColors;
@@ -96,4 +106,12 @@ template <StreamrLogLevelConcept T = StreamrLogLevel>
     return std::visit([](const auto& level) { return level.value; }, level);
 }
 
+inline constexpr int compileTimeMinLogLevelValue = STREAMR_LOG_MIN_LEVEL;
+
+// Whether the calls at LogLevel are compiled in at all: the Logger and
+// SLogger calls at a level below STREAMR_LOG_MIN_LEVEL compile to nothing.
+template <typename LogLevel>
+inline constexpr bool isLogLevelCompiledIn =
+    LogLevel::value >= compileTimeMinLogLevelValue;
+
 } // namespace streamr::logger
\ No newline at end of file
@@ -103,6 +103,28 @@ public:
             .stream();
     }
 
+    // A LOG_LEVEL_<category> env variable may enable a level below the
+    // logger's own for the files of its category.
+    [[nodiscard]] streamr::logger::StreamrLogLevel getMinEnabledLogLevel(
+        const streamr::logger::StreamrLogLevel loggerLogLevel)
+        const override {
+        auto result = loggerLogLevel;
+        for (char** env = environ; *env != nullptr; ++env) {
+            const std::string_view envVar = *env;
+
+            if (envVar.starts_with(envCategoryLogLevelName)) {
+                const auto categoryLogLevel = getStreamrLogLevelByName(
+                    envVar.substr(envVar.find('=') + 1),
+                    defaultStreamrLogLevel);
+                if (getStreamrLogLevelValue(categoryLogLevel) <
+                    getStreamrLogLevelValue(result)) {
+                    result = categoryLogLevel;
+                }
+            }
+        }
+        return result;
+    }
+
 private:
     void setFileLogCategoriesFromEnv(const std::string& fileCategory) {
         // go through all env variables and find all that
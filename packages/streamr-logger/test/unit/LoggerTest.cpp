@@ -456,6 +456,56 @@ TEST_F(LoggerTest, FatalLogWithExtraArgumentObject) {
         testing::HasSubstr("Testi {\"value1\":\"TestString\",\"value2\":42}"));
 }
 
+// Lazy message and metadata
+
+TEST_F(LoggerTest, LazyMessageAndMetadataNotEvaluatedBelowLogLevel) {
+    setenv("LOG_LEVEL", "info", 1);
+    int evaluations = 0;
+
+    getLogger().debug(
+        [&evaluations]() {
+            evaluations++;
+            return std::string("Testi");
+        },
+        [&evaluations]() {
+            evaluations++;
+            return std::string("LogExtraArgumentText");
+        });
+
+    EXPECT_EQ(evaluations, 0);
+    EXPECT_EQ(getLogWriterMock()->getIsCalled(), 0);
+}
+
+TEST_F(LoggerTest, LazyMessageAndMetadataEvaluatedWhenWritten) {
+    setenv("LOG_LEVEL", "info", 1);
+    const std::string text = "Testi";
+
+    getLogger().info(
+        [&text]() { return text + " lazy"; },
+        []() { return std::string("LogExtraArgumentText"); });
+
+    EXPECT_THAT(
+        getLogWriterMock()->getBuffer(),
+        testing::HasSubstr(
+            "Testi lazy {\"metadata\":\"LogExtraArgumentText\"}"));
+}
+
+TEST_F(LoggerTest, CategoryLogLevelEnvVariableKeepsLowerLevelEvaluated) {
+    setenv("LOG_LEVEL", "info", 1);
+    setenv("LOG_LEVEL_NoSuchCategory", "trace", 1);
+    int evaluations = 0;
+
+    getLogger().trace([&evaluations]() {
+        evaluations++;
+        return std::string("Testi");
+    });
+    unsetenv("LOG_LEVEL_NoSuchCategory");
+
+    // Evaluated for the category, but not written: this file is not in it
+    EXPECT_EQ(evaluations, 1);
+    EXPECT_EQ(getLogWriterMock()->getIsCalled(), 0);
+}
+
 TEST(LoggerContextBindingAndMetadataMerge, StringsMerged) {
     setenv("LOG_LEVEL", "fatal", 1);
     std::shared_ptr<LogWriterMock> tmpLogWriterMock =
@@ -0,0 +1,50 @@
+// Module streamr.protorpc.DispatchArena
+// Native-only (no TS counterpart): the protobuf arena of the incoming
+// frame that is being dispatched on the calling thread.
+//
+// A transport that parses a frame into an arena opens a DispatchArenaScope
+// around its synchronous dispatch. Handlers that run inside it (the
+// notification and synchronous method wrappers of ServerRegistry) unpack
+// their request from the RPC body into the same arena, so a frame costs a
+// few arena blocks instead of one heap allocation per submessage and
+// string. Anything that outlives the dispatch (the response coroutines of
+// RpcCommunicatorServerApi, the client's resolved results) keeps its own
+// heap copy, as before.
+module;
+
+#include <google/protobuf/arena.h>
+
+export module streamr.protorpc.DispatchArena;
+
+namespace streamr::protorpc::detail {
+
+// Scopes nest: a handler may dispatch another frame inline on the same
+// thread.
+inline thread_local google::protobuf::Arena* dispatchArena = nullptr;
+
+} // namespace streamr::protorpc::detail
+
+export namespace streamr::protorpc {
+
+class DispatchArenaScope {
+private:
+    google::protobuf::Arena* previous;
+
+public:
+    explicit DispatchArenaScope(google::protobuf::Arena& arena)
+        : previous(detail::dispatchArena) {
+        detail::dispatchArena = &arena;
+    }
+    ~DispatchArenaScope() { detail::dispatchArena = this->previous; }
+    DispatchArenaScope(const DispatchArenaScope&) = delete;
+    DispatchArenaScope& operator=(const DispatchArenaScope&) = delete;
+    DispatchArenaScope(DispatchArenaScope&&) = delete;
+    DispatchArenaScope& operator=(DispatchArenaScope&&) = delete;
+};
+
+// The arena of the innermost DispatchArenaScope on this thread, or null.
+inline google::protobuf::Arena* getDispatchArena() {
+    return detail::dispatchArena;
+}
+
+} // namespace streamr::protorpc
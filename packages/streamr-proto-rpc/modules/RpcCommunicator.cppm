@@ -229,7 +229,9 @@ public:
 private:
     void onIncomingMessage(
         const RpcMessage& rpcMessage, const CallContextType& callContext) {
-        SLogger::trace("onIncomingMessage", rpcMessage.DebugString());
+        SLogger::trace("onIncomingMessage", [&rpcMessage]() {
+            return rpcMessage.DebugString();
+        });
 
         const auto& header = rpcMessage.header();
 
@@ -12,6 +12,7 @@ module;
 #include <exception>
 #include <map>
 #include <mutex>
+#include <type_traits>
 #include "packages/proto-rpc/protos/ProtoRpc.pb.h"
 
 export module streamr.protorpc.RpcCommunicatorClientApi;
@@ -243,10 +244,16 @@ public:
 
         auto requestMessage =
             this->createRequestRpcMessage(methodName, methodParam);
+        auto requestId = requestMessage.requestid();
 
+        // The message is moved (not copied) down to the outgoing callback:
+        // its body may be a large payload.
         auto task = folly::coro::co_invoke(
-            [requestMessage, callContext, timeoutValue, this]()
-                -> folly::coro::Task<ReturnType> {
+            [requestMessage = std::move(requestMessage),
+             requestId = std::move(requestId),
+             callContext,
+             timeoutValue,
+             this]() mutable -> folly::coro::Task<ReturnType> {
                 // The `this`-touching work runs as an mScope task on the
                 // shared pool; the caller awaits only the contract future,
                 // which holds no `this`, so an abandoned caller cannot leave
@@ -265,7 +272,7 @@ public:
                     streamr::utils::co_withExecutor(
                         &streamr::utils::SharedExecutors::worker(),
                         folly::coro::co_invoke(
-                            [requestMessage,
+                            [requestMessage = std::move(requestMessage),
                              callContext,
                              timeoutValue,
                              this,
@@ -274,7 +281,8 @@ public:
                                 try {
                                     auto ongoingRequest =
                                         this->makeRpcRequest<ReturnType>(
-                                            requestMessage, callContext);
+                                            std::move(requestMessage),
+                                            callContext);
                                     promise.setValue(
                                         co_await folly::coro::timeout(
                                             std::move(
@@ -294,14 +302,12 @@ public:
                     SLogger::trace(
                         "request() caught folly::FutureTimeout", e.what());
                     std::lock_guard lock(mOngoingRequestsMutex);
-                    mOngoingRequests.erase(
-                        RequestId{requestMessage.requestid()});
+                    mOngoingRequests.erase(RequestId{requestId});
                     throw RpcTimeout("request() timed out");
                 } catch (...) {
                     SLogger::trace("request() caught other exception");
                     std::lock_guard lock(mOngoingRequestsMutex);
-                    mOngoingRequests.erase(
-                        RequestId{requestMessage.requestid()});
+                    mOngoingRequests.erase(RequestId{requestId});
                     throw;
                 }
             });
@@ -341,20 +347,23 @@ public:
             // the communicator owner), so it runs as an mScope task — the
             // scope drain in the destructor replaces the former private
             // executor's join.
+            // The message is moved (not copied) down to the callback:
+            // its body may be a large payload.
             mScope.add(
                 streamr::utils::co_withExecutor(
                     &streamr::utils::SharedExecutors::worker(),
                     folly::coro::co_invoke(
-                        [requestMessage,
+                        [requestMessage = std::move(requestMessage),
                          callContext,
                          promise = std::move(promiseContract.first),
                          outgoingMessageCallback =
                              mOutgoingMessageCallback]() mutable
                             -> folly::coro::Task<void> {
                             try {
+                                auto requestId = requestMessage.requestid();
                                 outgoingMessageCallback(
-                                    requestMessage,
-                                    requestMessage.requestid(),
+                                    std::move(requestMessage),
+                                    std::move(requestId),
                                     callContext);
                                 promise.setValue();
                             } catch (
@@ -407,22 +416,21 @@ public:
 private:
     template <typename ReturnType>
     std::shared_ptr<OngoingRequest<ReturnType>> makeRpcRequest(
-        const RpcMessage& requestMessage, const CallContextType& callContext) {
+        RpcMessage requestMessage, const CallContextType& callContext) {
+        auto requestId = requestMessage.requestid();
         auto ongoingRequest =
             std::make_shared<OngoingRequest<ReturnType>>(callContext);
         {
             std::lock_guard lock(mOngoingRequestsMutex);
-            this->mOngoingRequests.emplace(
-                RequestId{requestMessage.requestid()}, ongoingRequest);
+            this->mOngoingRequests.emplace(RequestId{requestId}, ongoingRequest);
         }
         if (mOutgoingMessageCallback) {
             try {
                 mOutgoingMessageCallback(
-                    requestMessage, requestMessage.requestid(), callContext);
+                    std::move(requestMessage), requestId, callContext);
             } catch (const std::exception& clientSideException) {
                 std::lock_guard lock(mOngoingRequestsMutex);
-                if (mOngoingRequests.find(
-                        RequestId{requestMessage.requestid()}) !=
+                if (mOngoingRequests.find(RequestId{requestId}) !=
                     mOngoingRequests.end()) {
                     SLogger::debug(
                         "Error when calling outgoing message callback from client",
@@ -433,8 +441,7 @@ private:
 
                     SLogger::debug("Old exception:", error.originalErrorInfo);
 
-                    this->handleClientError(
-                        RequestId{requestMessage.requestid()}, error);
+                    this->handleClientError(RequestId{requestId}, error);
                 }
             }
         }
@@ -455,11 +462,20 @@ private:
             header->insert({"notification", "notification"});
         }
         Any* body = new Any();
-        body->PackFrom(request);
+        // A request that is already an Any was packed by the caller
+        // (fan-out senders pack once and reuse the encoded bytes for
+        // every target); it is used as the body without re-encoding.
+        // The message owns its body, so this byte copy is the only one:
+        // request() and notify() move the message down to the transport.
+        if constexpr (std::is_same_v<RequestType, Any>) {
+            *body = request;
+        } else {
+            body->PackFrom(request);
+        }
         ret.set_allocated_body(body); // protobuf will take ownership
         SLogger::trace(
             "createRequestRpcMessage() printed request Any: ",
-            body->DebugString());
+            [body]() { return body->DebugString(); });
         ret.set_requestid(Uuid::v4());
         return ret;
     }
@@ -473,7 +489,9 @@ private:
     }
 
     void rejectOngoingRequest(const RpcMessage& response) {
-        SLogger::trace("rejectOngoingRequest()", response.DebugString());
+        SLogger::trace("rejectOngoingRequest()", [&response]() {
+            return response.DebugString();
+        });
         std::lock_guard lock(mOngoingRequestsMutex);
 
         const auto& ongoingRequest =
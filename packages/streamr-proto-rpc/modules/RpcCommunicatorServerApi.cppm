@@ -80,7 +80,7 @@ private:
         if (params.body.has_value()) {
             SLogger::trace(
                 "createResponseRpcMessage() body has value",
-                params.body->DebugString());
+                [&params]() { return params.body->DebugString(); });
             auto* body = new Any(params.body.value());
             ret.set_allocated_body(body); // protobuf will take ownership
         }
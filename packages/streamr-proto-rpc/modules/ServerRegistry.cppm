@@ -20,6 +20,7 @@ module;
 
 #include <optional>
 #include <google/protobuf/any.pb.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/empty.pb.h>
 #include "packages/proto-rpc/protos/ProtoRpc.pb.h"
 
@@ -27,6 +28,7 @@ export module streamr.protorpc.ServerRegistry;
 
 import streamr.utils.CoroutineHelper;
 import streamr.logger.SLogger;
+import streamr.protorpc.DispatchArena;
 import streamr.protorpc.Errors;
 export namespace streamr::protorpc {
 
@@ -87,7 +89,29 @@ private:
         return map.at(method);
     }
 
+    // Unpacks the request into the arena of the frame being dispatched,
+    // if any (see streamr.protorpc.DispatchArena). Only for handlers that
+    // are done with the request when they return.
+    template <typename RequestType, typename F>
+    static auto withUnpackedRequest(const Any& data, const F& handle) {
+        if (auto* arena = getDispatchArena()) {
+            auto* request = google::protobuf::Arena::Create<RequestType>(arena);
+            ServerRegistry::wrappedParseAny(*request, data);
+            return handle(*request);
+        }
+        RequestType request;
+        ServerRegistry::wrappedParseAny(request, data);
+        return handle(request);
+    }
+
 public:
+    template <typename ResponseType>
+    static Any packResponse(const ResponseType& response) {
+        Any responseAny;
+        responseAny.PackFrom(response);
+        return responseAny;
+    }
+
     template <typename TargetType>
     static void wrappedParseAny(TargetType& target, const Any& any) {
         try {
@@ -150,12 +174,11 @@ public:
         RegisteredMethod method = {
             .fn = [fn](const Any& data, const CallContextType& callContext)
                 -> Any {
-                RequestType request;
-                ServerRegistry::wrappedParseAny(request, data);
-                auto response = fn(request, callContext);
-                Any responseAny;
-                responseAny.PackFrom(response);
-                return responseAny;
+                return withUnpackedRequest<RequestType>(
+                    data, [&](const RequestType& request) {
+                        return packResponse<ReturnType>(
+                            fn(request, callContext));
+                    });
             },
             .options = options};
         mMethods[name] = method;
@@ -175,9 +198,7 @@ public:
                 RequestType request;
                 ServerRegistry::wrappedParseAny(request, data);
                 ReturnType response = co_await fn(request, callContext);
-                Any responseAny;
-                responseAny.PackFrom(response);
-                co_return responseAny;
+                co_return packResponse(response);
             },
             .options = options};
         mAsyncMethods[name] = method;
@@ -189,9 +210,10 @@ public:
         RegisteredNotification notification = {
             .fn = [fn](const Any& data, const CallContextType& callContext)
                 -> Empty {
-                RequestType request;
-                ServerRegistry::wrappedParseAny(request, data);
-                fn(request, callContext);
+                withUnpackedRequest<RequestType>(
+                    data, [&](const RequestType& request) {
+                        fn(request, callContext);
+                    });
                 return {};
             },
             .options = options};
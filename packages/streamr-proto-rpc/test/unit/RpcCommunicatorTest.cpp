@@ -3,13 +3,17 @@
 #include <exception>
 #include <memory>
 #include <thread>
+#include <vector>
 #include <gtest/gtest.h>
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/arena.h>
 #include "HelloRpc.pb.h"
 
 #include <coroutine> // IWYU pragma: keep
 
 import streamr.utils.CoroutineHelper;
 import streamr.utils.ExecutorHelper;
+import streamr.protorpc.DispatchArena;
 import streamr.protorpc.Errors;
 import streamr.protorpc.ProtoCallContext;
 import streamr.protorpc.RpcCommunicator;
@@ -319,6 +323,51 @@ TEST_F(RpcCommunicatorTest, TestCannotify) {
     EXPECT_EQ(requestMsg, "Test");
 }
 
+TEST_F(RpcCommunicatorTest, TestNotificationIsUnpackedIntoDispatchArena) {
+    google::protobuf::Arena arena;
+    std::vector<const google::protobuf::Arena*> requestArenas;
+    communicator1.registerRpcNotification<HelloRequest>(
+        "testFunction",
+        [&requestArenas](
+            const HelloRequest& request, const ProtoCallContext& /* context */)
+            -> void { requestArenas.push_back(request.GetArena()); });
+    communicator2.setOutgoingMessageCallback(
+        [this, &arena](
+            const RpcMessage& message,
+            const std::string& /* requestId */,
+            const ProtoCallContext& /* context */) -> void {
+            const DispatchArenaScope scope(arena);
+            communicator1.handleIncomingMessage(message, ProtoCallContext());
+        });
+    sendHelloNotification(communicator2, &executor);
+    setCallbacks(false);
+    sendHelloNotification(communicator2, &executor);
+    ASSERT_EQ(requestArenas.size(), 2U);
+    EXPECT_EQ(requestArenas[0], &arena);
+    EXPECT_EQ(requestArenas[1], nullptr);
+    EXPECT_EQ(getDispatchArena(), nullptr);
+}
+
+TEST_F(RpcCommunicatorTest, TestCanNotifyWithPrePackedBody) {
+    std::string requestMsg;
+    communicator1.registerRpcNotification<HelloRequest>(
+        "testFunction",
+        [&requestMsg](
+            const HelloRequest& request, const ProtoCallContext& /* context */)
+            -> void { requestMsg = request.myname(); });
+    setCallbacks(false);
+    HelloRequest request;
+    request.set_myname("Packed");
+    google::protobuf::Any packed;
+    packed.PackFrom(request);
+    streamr::utils::blockingWait(
+        streamr::utils::co_withExecutor(
+            &executor,
+            communicator2.notify<google::protobuf::Any>(
+                "testFunction", packed, ProtoCallContext())));
+    EXPECT_EQ(requestMsg, "Packed");
+}
+
 TEST_F(RpcCommunicatorTest, TestnotifyClientThrowsRuntimeError) {
     setOutgoingCallbackWithException<std::runtime_error>(communicator2);
     try {
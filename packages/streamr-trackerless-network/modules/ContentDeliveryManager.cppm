@@ -10,8 +10,7 @@
 // (getDiagnosticInfo) are not ported (consistent with earlier phases).
 // The TS private-client mode toggles on the ConnectionManager
 // (enable/disable around proxied-only operation) have no C++
-// counterpart yet — documented follow-up. The plumtree delivery options
-// are milestone-E scope. The TS fire-and-forget setImmediate() join is
+// counterpart yet — documented follow-up. The TS fire-and-forget setImmediate() join is
 // a bounded GuardedAsyncScope task.
 module;
 
@@ -43,6 +42,7 @@ import streamr.trackerlessnetwork.createContentDeliveryLayerNode;
 import streamr.trackerlessnetwork.DiscoveryLayerNode;
 import streamr.trackerlessnetwork.PeerDescriptorStoreManager;
 import streamr.trackerlessnetwork.ProxyClient;
+import streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
 import streamr.trackerlessnetwork.StreamPartNetworkSplitAvoidance;
 import streamr.trackerlessnetwork.StreamPartReconnect;
 import streamr.trackerlessnetwork.streamPartIdToDataKey;
@@ -98,6 +98,7 @@ struct ContentDeliveryManagerOptions {
     std::optional<size_t> streamPartitionNeighborTargetCount;
     std::optional<size_t> streamPartitionMinPropagationTargets;
     std::optional<size_t> streamPartitionMaxPropagationBufferSize;
+    std::optional<size_t> streamPartitionPropagationSendQueueHighWaterMark;
     std::optional<bool> acceptProxyConnections;
     std::optional<std::chrono::milliseconds> rpcRequestTimeout;
     std::optional<std::chrono::milliseconds> neighborUpdateInterval;
@@ -105,6 +106,15 @@ struct ContentDeliveryManagerOptions {
     // to its local message listeners (no self-loop). Propagation to
     // neighbors and duplicate detection are unaffected. Off by default.
     bool suppressOwnMessageLoopback = false;
+    // Opt-in Plumtree delivery for every joined stream part (TS
+    // plumtreeOptimization / plumtreeMaxPausedNeighbors).
+    bool plumtreeOptimization = false;
+    std::optional<size_t> plumtreeMaxPausedNeighbors;
+    // Opt-in sendStreamMessageBatch with neighbors that also enable it.
+    bool streamMessageBatching = false;
+    // Verifies incoming signatures in every joined stream part; its
+    // rejection counts cover all of them. null = no verification.
+    std::shared_ptr<StreamMessageSignatureVerifier> signatureVerifier;
     // The layer-1 discovery node factory. TS constructs the DhtNode
     // inline; injected here because composing the DhtNode module graph
     // in this TU exhausts clang's source locations — use
@@ -668,11 +678,19 @@ private:
                     this->options.streamPartitionMinPropagationTargets,
                 .maxPropagationBufferSize =
                     this->options.streamPartitionMaxPropagationBufferSize,
+                .propagationSendQueueHighWaterMark =
+                    this->options
+                        .streamPartitionPropagationSendQueueHighWaterMark,
                 .acceptProxyConnections = this->options.acceptProxyConnections,
                 .neighborUpdateInterval = this->options.neighborUpdateInterval,
                 .rpcRequestTimeout = this->options.rpcRequestTimeout,
                 .suppressOwnMessageLoopback =
-                    this->options.suppressOwnMessageLoopback});
+                    this->options.suppressOwnMessageLoopback,
+                .plumtreeOptimization = this->options.plumtreeOptimization,
+                .plumtreeMaxPausedNeighbors =
+                    this->options.plumtreeMaxPausedNeighbors,
+                .streamMessageBatching = this->options.streamMessageBatching,
+                .signatureVerifier = this->options.signatureVerifier});
     }
 
     std::shared_ptr<ProxyClient> createProxyClient(
@@ -34,6 +34,9 @@ public:
     folly::coro::Task<void> leaveStreamPartNotice(LeaveStreamPartNotice&& request, CallContextType&& callContext, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
         return communicator.template notify<LeaveStreamPartNotice>("leaveStreamPartNotice", std::move(request), std::move(callContext), timeout);
     }
+    folly::coro::Task<void> sendStreamMessageBatch(StreamMessageBatch&& request, CallContextType&& callContext, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+        return communicator.template notify<StreamMessageBatch>("sendStreamMessageBatch", std::move(request), std::move(callContext), timeout);
+    }
 }; // class ContentDeliveryRpcClient
 template <typename CallContextType>
 class ProxyConnectionRpcClient {
@@ -21,6 +21,7 @@ public:
    virtual ~ContentDeliveryRpc() = default;
    virtual void sendStreamMessage(const StreamMessage& request, const CallContextType& callContext) = 0;
    virtual void leaveStreamPartNotice(const LeaveStreamPartNotice& request, const CallContextType& callContext) = 0;
+   virtual void sendStreamMessageBatch(const StreamMessageBatch& request, const CallContextType& callContext) = 0;
 }; // class ContentDeliveryRpc
 template <typename CallContextType>
 class ProxyConnectionRpc {
@@ -4,9 +4,13 @@
 // overlay node — owns the neighbor list and the four contact views fed
 // from the discovery layer, broadcasts with per-publisher duplicate
 // detection, and wires the content-delivery / temporary-connection RPC
-// servers. The plumtree branch is milestone-E scope (plan decision 3.3)
-// and the TS GapDiagnostics sampling is a TS-only diagnostic; both are
-// omitted.
+// servers. With a PlumtreeManager (opt-in) neighbor delivery follows
+// the Plumtree eager/lazy tree: of the neighbors, Propagation sends only
+// to the eager set. Neighbors that negotiated it also accept
+// sendStreamMessageBatch. With a signature verifier (opt-in, native-only)
+// incoming messages pass a StreamMessageVerificationStage before they are
+// duplicate-checked and broadcast. The TS GapDiagnostics sampling is a TS-only
+// diagnostic and is omitted.
 //
 // Adaptations: components arrive as shared_ptrs (the TS factory relies
 // on GC; here createContentDeliveryLayerNode builds the ownership graph
@@ -41,15 +45,18 @@ import streamr.utils.CoroutineHelper;
 import streamr.trackerlessnetwork.ContentDeliveryRpcLocal;
 import streamr.trackerlessnetwork.ContentDeliveryRpcRemote;
 import streamr.trackerlessnetwork.DiscoveryLayerNode;
-import streamr.trackerlessnetwork.DuplicateMessageDetector;
+import streamr.trackerlessnetwork.DuplicateDetectorIndex;
 import streamr.trackerlessnetwork.Handshaker;
 import streamr.trackerlessnetwork.Inspector;
 import streamr.trackerlessnetwork.NeighborFinder;
 import streamr.trackerlessnetwork.NeighborUpdateManager;
 import streamr.trackerlessnetwork.NetworkRpcClient;
 import streamr.trackerlessnetwork.NodeList;
+import streamr.trackerlessnetwork.PlumtreeManager;
 import streamr.trackerlessnetwork.Propagation;
 import streamr.trackerlessnetwork.ProxyConnectionRpcLocal;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
 import streamr.trackerlessnetwork.TemporaryConnectionRpcLocal;
 import streamr.trackerlessnetwork.Utils;
 import streamr.dht.ConnectionLocker;
@@ -86,6 +93,7 @@ using streamr::trackerlessnetwork::inspection::Inspector;
 using streamr::trackerlessnetwork::neighbordiscovery::Handshaker;
 using streamr::trackerlessnetwork::neighbordiscovery::INeighborFinder;
 using streamr::trackerlessnetwork::neighbordiscovery::NeighborUpdateManager;
+using streamr::trackerlessnetwork::plumtree::PlumtreeManager;
 using streamr::trackerlessnetwork::propagation::Propagation;
 using streamr::trackerlessnetwork::proxy::ProxyConnectionRpcLocal;
 
@@ -136,27 +144,35 @@ struct StrictContentDeliveryLayerNodeOptions {
     std::shared_ptr<INeighborFinder> neighborFinder;
     std::shared_ptr<NeighborUpdateManager> neighborUpdateManager;
     std::shared_ptr<Inspector> inspector;
+    std::shared_ptr<PlumtreeManager> plumtreeManager; // null = Propagation
+    // null = incoming signatures are not verified
+    std::shared_ptr<StreamMessageSignatureVerifier> signatureVerifier;
     size_t neighborTargetCount = defaultNeighborTargetCount;
     std::function<bool()> isLocalNodeEntryPoint;
     std::optional<std::chrono::milliseconds> rpcRequestTimeout;
     bool suppressOwnMessageLoopback = false;
+    DuplicateDetectorIndexOptions duplicateDetectorOptions;
 };
 
 class ContentDeliveryLayerNode
     : public EventEmitter<ContentDeliveryLayerNodeEvents> {
 private:
     StrictContentDeliveryLayerNodeOptions options;
-    std::map<std::string, DuplicateMessageDetector> duplicateDetectors;
+    DuplicateDetectorIndex duplicateDetectors;
     std::optional<ContentDeliveryRpcLocal> contentDeliveryRpcLocal;
+    // Declared after contentDeliveryRpcLocal: its workers deliver into it.
+    std::optional<StreamMessageVerificationStage> verificationStage;
     std::atomic<bool> started = false;
     std::atomic<bool> stopped = false;
     std::vector<std::function<void()>> unsubscribers;
     std::atomic<uint64_t> messagesPropagated = 0;
+    std::atomic<uint64_t> duplicateMessages = 0;
 
 public:
     explicit ContentDeliveryLayerNode(
         StrictContentDeliveryLayerNodeOptions options)
-        : options(std::move(options)) {
+        : options(std::move(options)),
+          duplicateDetectors(this->options.duplicateDetectorOptions) {
         this->contentDeliveryRpcLocal.emplace(
             ContentDeliveryRpcLocalOptions{
                 .localPeerDescriptor = this->options.localPeerDescriptor,
@@ -188,7 +204,39 @@ public:
                         this->options.inspector->markMessage(
                             remoteNodeId, messageId);
                     },
-                .rpcCommunicator = *this->options.rpcCommunicator});
+                .rpcCommunicator = *this->options.rpcCommunicator,
+                .onDuplicate =
+                    [this](
+                        const DhtAddress& remoteNodeId,
+                        const MessageID& messageId) {
+                        this->duplicateMessages++;
+                        if (this->options.plumtreeManager) {
+                            this->options.plumtreeManager->pauseNeighbor(
+                                remoteNodeId, messageId.messagechainid());
+                        }
+                    },
+                .verify = this->options.signatureVerifier
+                    ? std::function<void(
+                          const StreamMessage&, const DhtAddress&)>(
+                          [this](
+                              const StreamMessage& message,
+                              const DhtAddress& previousNode) {
+                              this->verificationStage->submit(
+                                  message, previousNode);
+                          })
+                    : nullptr});
+        if (this->options.signatureVerifier) {
+            this->verificationStage.emplace(
+                StreamMessageVerificationStageOptions{
+                    .verifier = this->options.signatureVerifier,
+                    .onVerified =
+                        [this](
+                            const StreamMessage& message,
+                            const DhtAddress& previousNode) {
+                            this->contentDeliveryRpcLocal
+                                ->deliverStreamMessage(message, previousNode);
+                        }});
+        }
     }
 
     ~ContentDeliveryLayerNode() override { this->stop(); }
@@ -210,6 +258,9 @@ public:
             unsubscribe();
         }
         this->unsubscribers.clear();
+        if (this->verificationStage) {
+            this->verificationStage->stop();
+        }
         if (this->options.proxyConnectionRpcLocal) {
             this->options.proxyConnectionRpcLocal->stop();
         }
@@ -237,6 +288,9 @@ public:
             streamr::utils::blockingWait(
                 folly::coro::collectAllTryRange(std::move(notices)));
         }
+        if (this->options.plumtreeManager) {
+            this->options.plumtreeManager->stop();
+        }
         // TS parity: destroy() unregisters from the transport and drains
         // the communicator scopes NOW, while the send targets are alive —
         // a straggler leave-notice coroutine resuming after this object
@@ -274,9 +328,15 @@ public:
         const bool skipBackPropagation = previousNode.has_value() &&
             !this->options.temporaryConnectionRpcLocal->hasNode(
                 previousNode.value());
+        // Encoded once; every neighbor send reuses the same body.
+        const auto serialized = serializeStreamMessage(msg);
+        // With Plumtree the neighbor targets are its eager set.
+        auto neighborTargets = this->options.plumtreeManager
+            ? this->options.plumtreeManager->broadcast(serialized, previousNode)
+            : this->options.neighbors->getIds();
         this->options.propagation->feedUnseenMessage(
-            msg,
-            this->getPropagationTargets(msg),
+            serialized,
+            this->getPropagationTargets(msg, std::move(neighborTargets)),
             skipBackPropagation ? previousNode : std::nullopt);
         this->messagesPropagated++;
     }
@@ -285,6 +345,11 @@ public:
         return this->options.inspector->inspect(std::move(peerDescriptor));
     }
 
+    // Messages received from the network that were already seen.
+    [[nodiscard]] uint64_t getDuplicateMessageCount() const {
+        return this->duplicateMessages;
+    }
+
     [[nodiscard]] bool hasProxyConnection(const DhtAddress& nodeId) const {
         if (this->options.proxyConnectionRpcLocal) {
             return this->options.proxyConnectionRpcLocal->hasConnection(nodeId);
@@ -335,6 +400,15 @@ private:
             [this](const StreamMessage& msg, const DhtCallContext& context) {
                 this->contentDeliveryRpcLocal->sendStreamMessage(msg, context);
             });
+        this->options.rpcCommunicator
+            ->registerRpcNotification<StreamMessageBatch>(
+                "sendStreamMessageBatch",
+                [this](
+                    const StreamMessageBatch& batch,
+                    const DhtCallContext& context) {
+                    this->contentDeliveryRpcLocal->sendStreamMessageBatch(
+                        batch, context);
+                });
         this->options.rpcCommunicator
             ->registerRpcNotification<LeaveStreamPartNotice>(
                 "leaveStreamPartNotice",
@@ -422,8 +496,12 @@ private:
         this->subscribe<NodeRemoved>(
             *this->options.neighbors,
             [this](
-                const DhtAddress& /*id*/,
+                const DhtAddress& id,
                 const std::shared_ptr<ContentDeliveryRpcRemote>& remote) {
+                this->options.propagation->onNeighborLeft(id);
+                if (this->options.plumtreeManager) {
+                    this->options.plumtreeManager->onNeighborRemoved(id);
+                }
                 this->options.connectionLocker->weakUnlockConnection(
                     Identifiers::getNodeIdFromPeerDescriptor(
                         remote->getPeerDescriptor()),
@@ -579,8 +657,10 @@ private:
         }
     }
 
-    std::vector<DhtAddress> getPropagationTargets(const StreamMessage& msg) {
-        auto propagationTargets = this->options.neighbors->getIds();
+    // neighborTargets plus the proxy and temporary-connection targets.
+    std::vector<DhtAddress> getPropagationTargets(
+        const StreamMessage& msg, std::vector<DhtAddress> neighborTargets) {
+        auto propagationTargets = std::move(neighborTargets);
         if (this->options.proxyConnectionRpcLocal) {
             const auto proxyTargets =
                 this->options.proxyConnectionRpcLocal->getPropagationTargets(
@@ -1,6 +1,12 @@
 // Module streamr.trackerlessnetwork.ContentDeliveryRpcLocal
 // CONSOLIDATED from the former header logic/ContentDeliveryRpcLocal.hpp
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
+//
+// Native addition: sendStreamMessageBatch unbatches a StreamMessage batch
+// (see StreamMessageBatch) and handles each message as if it had arrived
+// on its own. With a `verify` hook set, incoming messages go through it
+// (the signature verification stage) and only the messages it hands back
+// to deliverStreamMessage are duplicate-checked and broadcast.
 module;
 
 #include <functional>
@@ -13,6 +19,7 @@ export module streamr.trackerlessnetwork.ContentDeliveryRpcLocal;
 import streamr.trackerlessnetwork.protos;
 
 import streamr.trackerlessnetwork.NetworkRpcServer;
+import streamr.trackerlessnetwork.StreamMessageBatch;
 import streamr.dht.DhtCallContext;
 import streamr.dht.Identifiers;
 import streamr.dht.ListeningRpcCommunicator;
@@ -46,6 +53,14 @@ struct ContentDeliveryRpcLocalOptions {
     std::function<void(const DhtAddress&, bool)> onLeaveNotice;
     std::function<void(const DhtAddress&, const MessageID&)> markForInspection;
     ListeningRpcCommunicator& rpcCommunicator;
+    // Called with the sender of a message that was already seen (the
+    // Plumtree mode prunes that sender from the eager tree). Optional.
+    std::function<void(const DhtAddress&, const MessageID&)> onDuplicate =
+        nullptr;
+    // Takes over incoming messages; calls deliverStreamMessage for the
+    // ones that pass. Optional.
+    std::function<void(const StreamMessage&, const DhtAddress&)> verify =
+        nullptr;
 };
 
 class ContentDeliveryRpcLocal : public ContentDeliveryRpc {
@@ -61,12 +76,33 @@ public:
         const auto previousNode = Identifiers::getNodeIdFromPeerDescriptor(
             context.incomingSourceDescriptor.value());
         this->options.markForInspection(previousNode, message.messageid());
+        if (this->options.verify) {
+            this->options.verify(message, previousNode);
+            return;
+        }
+        this->deliverStreamMessage(message, previousNode);
+    }
+
+    void deliverStreamMessage(
+        const StreamMessage& message, const DhtAddress& previousNode) {
         if (this->options.markAndCheckDuplicate(
                 message.messageid(),
                 message.has_previousmessageref()
                     ? std::optional(message.previousmessageref())
                     : std::nullopt)) {
             this->options.broadcast(message, previousNode);
+        } else if (this->options.onDuplicate) {
+            this->options.onDuplicate(previousNode, message.messageid());
+        }
+    }
+
+    // Throws MalformedStreamMessageBatch before handling any message if
+    // an entry does not decode.
+    void sendStreamMessageBatch(
+        const StreamMessageBatch& batch,
+        const DhtCallContext& context) override {
+        for (const auto& message : unpackStreamMessageBatch(batch)) {
+            this->sendStreamMessage(message, context);
         }
     }
 
@@ -1,6 +1,12 @@
 // Module streamr.trackerlessnetwork.ContentDeliveryRpcRemote
 // CONSOLIDATED from the former header logic/ContentDeliveryRpcRemote.hpp
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
+//
+// Native addition: sendStreamMessage also accepts a SerializedStreamMessage
+// and sends its packed body as is, so a broadcast encodes the message once
+// for all of its targets. sendStreamMessageBatch sends several of them in
+// one notification to a neighbor that negotiated batches (see
+// StreamMessageBatch).
 module;
 
 // Coroutine definitions need std::coroutine_traits declared in THIS
@@ -12,6 +18,8 @@ module;
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
+#include <google/protobuf/any.pb.h>
 
 export module streamr.trackerlessnetwork.ContentDeliveryRpcRemote;
 
@@ -19,6 +27,9 @@ import streamr.trackerlessnetwork.protos;
 
 import streamr.utils.CoroutineHelper;
 import streamr.trackerlessnetwork.NetworkRpcClient;
+import streamr.protorpc.RpcCommunicator;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.trackerlessnetwork.StreamMessageBatch;
 import streamr.dht.DhtCallContext;
 import streamr.dht.RpcRemote;
 import streamr.dht.protos;
@@ -29,17 +40,49 @@ import streamr.utils.StreamPartID;
 // fully qualified because relative namespace names resolve
 // differently at file scope than inside the package namespace.
 using streamr::dht::contact::RpcRemote;
+using streamr::protorpc::RpcCommunicator;
 using streamr::dht::rpcprotocol::DhtCallContext;
 using streamr::logger::SLogger;
 using streamr::utils::StreamPartID;
 export namespace streamr::trackerlessnetwork {
 
 using ::dht::PeerDescriptor;
-using ContentDeliveryRpcClient =
-    streamr::protorpc::ContentDeliveryRpcClient<DhtCallContext>;
+
+// The generated client plus a notify for a pre-packed StreamMessage body
+// (the generated stub packs its argument on every call).
+class ContentDeliveryRpcClient
+    : public streamr::protorpc::ContentDeliveryRpcClient<DhtCallContext> {
+private:
+    RpcCommunicator<DhtCallContext>* communicator;
+
+public:
+    explicit ContentDeliveryRpcClient(
+        RpcCommunicator<DhtCallContext>& communicator)
+        : streamr::protorpc::ContentDeliveryRpcClient<DhtCallContext>(
+              communicator),
+          communicator(&communicator) {}
+
+    using streamr::protorpc::ContentDeliveryRpcClient<
+        DhtCallContext>::sendStreamMessage;
+
+    folly::coro::Task<void> sendStreamMessage(
+        const google::protobuf::Any& packedStreamMessage,
+        DhtCallContext&& callContext,
+        std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+        return this->communicator->template notify<google::protobuf::Any>(
+            "sendStreamMessage",
+            packedStreamMessage,
+            std::move(callContext),
+            timeout);
+    }
+};
+
 class ContentDeliveryRpcRemote : public RpcRemote<ContentDeliveryRpcClient> {
 private:
     std::optional<int64_t> rtt;
+    // Set from the stream-part handshake before the remote is added to
+    // a NodeList (which publishes it to the send path); not changed later.
+    bool acceptsBatches = false;
 
 public:
     ContentDeliveryRpcRemote(
@@ -57,6 +100,14 @@ public:
 
     [[nodiscard]] std::optional<int64_t> getRtt() const { return this->rtt; }
 
+    void setAcceptsStreamMessageBatches(bool accepts) {
+        this->acceptsBatches = accepts;
+    }
+
+    [[nodiscard]] bool acceptsStreamMessageBatches() const {
+        return this->acceptsBatches;
+    }
+
     folly::coro::Task<void> sendStreamMessage(StreamMessage msg) {
         auto options = this->formDhtRpcOptions({});
         try {
@@ -68,6 +119,35 @@ public:
         }
     }
 
+    // The shared message keeps the packed body alive until the send has
+    // been handed to the transport.
+    folly::coro::Task<void> sendStreamMessage(SharedStreamMessage msg) {
+        auto options = this->formDhtRpcOptions({});
+        try {
+            co_await this->getClient().sendStreamMessage(
+                msg->getBody(), std::move(options));
+        } catch (const std::exception& err) {
+            SLogger::trace(
+                "Failed to sendStreamMessage: " + std::string(err.what()));
+        }
+    }
+
+    // Callers check acceptsStreamMessageBatches() first: a peer that did
+    // not negotiate batches drops the notification as an unknown method.
+    folly::coro::Task<void> sendStreamMessageBatch(
+        std::vector<SharedStreamMessage> messages) {
+        auto batch = packStreamMessageBatch(messages);
+        auto options = this->formDhtRpcOptions({});
+        try {
+            co_await this->getClient().sendStreamMessageBatch(
+                std::move(batch), std::move(options));
+        } catch (const std::exception& err) {
+            SLogger::trace(
+                "Failed to sendStreamMessageBatch: " +
+                std::string(err.what()));
+        }
+    }
+
     folly::coro::Task<void> leaveStreamPartNotice(
         const StreamPartID& streamPartId, bool isLocalNodeEntryPoint) {
         LeaveStreamPartNotice notification;
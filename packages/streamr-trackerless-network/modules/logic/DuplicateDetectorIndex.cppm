@@ -0,0 +1,277 @@
+// Module streamr.trackerlessnetwork.DuplicateDetectorIndex
+// Native-only (no TS counterpart): the per-publisher-chain index of
+// DuplicateMessageDetectors. TS keys a plain Map with
+// `${publisherId}-${messageChainId}` strings and never evicts; this
+// index keys a flat hash table with the raw 20-byte publisher id plus an
+// interned message chain id (no per-message string building), and
+// bounds its footprint with idle-publisher eviction and a memory budget
+// enforced least-recently-used first.
+module;
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <folly/container/F14Map.h>
+
+export module streamr.trackerlessnetwork.DuplicateDetectorIndex;
+
+import streamr.trackerlessnetwork.DuplicateMessageDetector;
+
+export namespace streamr::trackerlessnetwork {
+
+inline constexpr size_t publisherIdLength = 20;
+constexpr size_t defaultDuplicateDetectorMemoryBudget =
+    size_t{64} * 1024 * 1024;
+constexpr std::chrono::milliseconds defaultDuplicateDetectorMaxIdleTime =
+    std::chrono::minutes(30);
+
+struct DuplicateDetectorIndexOptions {
+    // Upper bound for the estimated footprint of all detectors and
+    // interned chain ids; least-recently-used publishers are evicted
+    // once it is exceeded.
+    size_t maxMemoryBytes = defaultDuplicateDetectorMemoryBudget;
+    // Detectors not touched for this long are evicted.
+    std::chrono::milliseconds maxIdleTime = defaultDuplicateDetectorMaxIdleTime;
+    size_t maxGapCount = defaultMaxGapCount;
+};
+
+/**
+ * Maps (publisher id, message chain id) to its DuplicateMessageDetector.
+ *
+ * Evicting a detector forgets what the publisher chain has already sent:
+ * a late replay of an evicted chain is accepted once more. That is the
+ * same outcome as the detector dropping its lowest gap when maxGapCount
+ * is hit, traded for a bounded footprint.
+ *
+ * Thread-safe: RPC handler threads and local publishes mark concurrently.
+ */
+class DuplicateDetectorIndex {
+public:
+    using PublisherId = std::array<std::byte, publisherIdLength>;
+
+private:
+    struct Key {
+        PublisherId publisherId;
+        uint32_t chainIndex;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash {
+        // Publisher ids are Ethereum addresses (keccak output), so their
+        // bytes are already uniformly distributed; folding two words is
+        // enough and F14 mixes non-avalanching hashes itself.
+        size_t operator()(const Key& key) const noexcept {
+            uint64_t low = 0;
+            uint64_t high = 0;
+            std::memcpy(&low, key.publisherId.data(), sizeof(low));
+            std::memcpy(
+                &high, key.publisherId.data() + sizeof(low), sizeof(high));
+            return static_cast<size_t>(
+                low ^ (high << 1) ^
+                (static_cast<uint64_t>(key.chainIndex) *
+                 0x9E3779B97F4A7C15ULL)); // NOLINT(readability-magic-numbers)
+        }
+    };
+
+    struct Entry {
+        DuplicateMessageDetector detector;
+        std::list<Key>::iterator recency;
+        std::chrono::steady_clock::time_point lastSeen;
+        size_t accountedBytes;
+    };
+
+    struct InternedChain {
+        std::string id;
+        size_t references = 0;
+    };
+
+    // Rough bookkeeping cost on top of the detectors themselves: the hash
+    // table slot and the recency list node per entry; the slot, the
+    // index entry and the two copies of the id string per chain.
+    static constexpr size_t entryOverhead =
+        sizeof(Key) + sizeof(Entry) + sizeof(Key) + (2 * sizeof(void*));
+    static constexpr size_t chainOverhead =
+        sizeof(InternedChain) + sizeof(std::string) + sizeof(uint32_t);
+
+    DuplicateDetectorIndexOptions options;
+    folly::F14FastMap<Key, Entry, KeyHash> detectors;
+    std::list<Key> recency; // front = most recently used
+    folly::F14FastMap<std::string, uint32_t> chainIndices;
+    std::vector<InternedChain> chains;
+    std::vector<uint32_t> freeChainSlots;
+    size_t memoryUsage = 0;
+    uint64_t evictionCount = 0;
+    mutable std::mutex mutex;
+
+public:
+    explicit DuplicateDetectorIndex(
+        DuplicateDetectorIndexOptions options = {}) // NOLINT
+        : options(options) {}
+
+    /**
+     * returns true if number has not yet been seen (i.e. is not a
+     * duplicate) in the given publisher's message chain
+     */
+    bool markAndCheck(
+        std::string_view publisherIdRaw,
+        std::string_view messageChainId,
+        std::optional<NumberPair> previousNumber,
+        NumberPair number,
+        std::chrono::steady_clock::time_point now =
+            std::chrono::steady_clock::now()) {
+        std::scoped_lock lock(this->mutex);
+        auto& entry = this->findOrCreate(
+            toPublisherId(publisherIdRaw), messageChainId, now);
+        this->recency.splice(
+            this->recency.begin(), this->recency, entry.recency);
+        entry.lastSeen = now;
+        const bool isNew = entry.detector.markAndCheck(previousNumber, number);
+        const auto usage = entry.detector.getMemoryUsage();
+        this->memoryUsage += usage;
+        this->memoryUsage -= entry.accountedBytes;
+        entry.accountedBytes = usage;
+        this->evict(now);
+        return isNew;
+    }
+
+    /**
+     * Evicts the detectors idle for longer than maxIdleTime. markAndCheck
+     * does this as it goes; an owner may call it on a quiet stream part.
+     */
+    void evictIdle(
+        std::chrono::steady_clock::time_point now =
+            std::chrono::steady_clock::now()) {
+        std::scoped_lock lock(this->mutex);
+        this->evict(now);
+    }
+
+    [[nodiscard]] size_t size() const {
+        std::scoped_lock lock(this->mutex);
+        return this->detectors.size();
+    }
+
+    [[nodiscard]] size_t getMemoryUsage() const {
+        std::scoped_lock lock(this->mutex);
+        return this->memoryUsage;
+    }
+
+    [[nodiscard]] uint64_t getEvictionCount() const {
+        std::scoped_lock lock(this->mutex);
+        return this->evictionCount;
+    }
+
+    void clear() {
+        std::scoped_lock lock(this->mutex);
+        this->detectors.clear();
+        this->recency.clear();
+        this->chainIndices.clear();
+        this->chains.clear();
+        this->freeChainSlots.clear();
+        this->memoryUsage = 0;
+    }
+
+private:
+    // Ids of any other length (never produced by EthereumAddress) are
+    // truncated or zero-padded.
+    static PublisherId toPublisherId(std::string_view raw) {
+        PublisherId id{};
+        std::memcpy(id.data(), raw.data(), std::min(raw.size(), id.size()));
+        return id;
+    }
+
+    Entry& findOrCreate(
+        const PublisherId& publisherId,
+        std::string_view messageChainId,
+        std::chrono::steady_clock::time_point now) {
+        const auto chainIt = this->chainIndices.find(messageChainId);
+        if (chainIt != this->chainIndices.end()) {
+            const auto it =
+                this->detectors.find(Key{publisherId, chainIt->second});
+            if (it != this->detectors.end()) {
+                return it->second;
+            }
+        }
+        const Key key{publisherId, this->internChain(messageChainId)};
+        this->recency.push_front(key);
+        DuplicateMessageDetector detector{this->options.maxGapCount};
+        const auto usage = detector.getMemoryUsage();
+        this->memoryUsage += entryOverhead + usage;
+        return this->detectors
+            .emplace(
+                key,
+                Entry{
+                    .detector = std::move(detector),
+                    .recency = this->recency.begin(),
+                    .lastSeen = now,
+                    .accountedBytes = usage})
+            .first->second;
+    }
+
+    uint32_t internChain(std::string_view messageChainId) {
+        const auto it = this->chainIndices.find(messageChainId);
+        uint32_t index = 0;
+        if (it != this->chainIndices.end()) {
+            index = it->second;
+        } else {
+            if (this->freeChainSlots.empty()) {
+                index = static_cast<uint32_t>(this->chains.size());
+                this->chains.emplace_back();
+            } else {
+                index = this->freeChainSlots.back();
+                this->freeChainSlots.pop_back();
+            }
+            this->chains[index].id = std::string(messageChainId);
+            this->chainIndices.emplace(this->chains[index].id, index);
+            this->memoryUsage += chainOverhead + (2 * messageChainId.size());
+        }
+        this->chains[index].references++;
+        return index;
+    }
+
+    void releaseChain(uint32_t index) {
+        auto& chain = this->chains[index];
+        if (--chain.references > 0) {
+            return;
+        }
+        this->memoryUsage -= chainOverhead + (2 * chain.id.size());
+        this->chainIndices.erase(chain.id);
+        chain.id.clear();
+        chain.id.shrink_to_fit();
+        this->freeChainSlots.push_back(index);
+    }
+
+    // The recency list is ordered by lastSeen, so both the idle check and
+    // the budget check only ever look at its tail. The most recently used
+    // detector is never evicted for the budget: the caller holds it.
+    void evict(std::chrono::steady_clock::time_point now) {
+        while (!this->recency.empty()) {
+            const auto it = this->detectors.find(this->recency.back());
+            const bool idle =
+                (now - it->second.lastSeen) > this->options.maxIdleTime;
+            const bool overBudget =
+                this->memoryUsage > this->options.maxMemoryBytes &&
+                this->recency.size() > 1;
+            if (!idle && !overBudget) {
+                return;
+            }
+            this->memoryUsage -= entryOverhead + it->second.accountedBytes;
+            this->releaseChain(it->first.chainIndex);
+            this->detectors.erase(it);
+            this->recency.pop_back();
+            this->evictionCount++;
+        }
+    }
+};
+
+} // namespace streamr::trackerlessnetwork
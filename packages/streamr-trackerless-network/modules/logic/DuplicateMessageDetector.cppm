@@ -3,11 +3,16 @@
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
 module;
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
-#include <vector>
 
 export module streamr.trackerlessnetwork.DuplicateMessageDetector;
 
@@ -108,18 +113,37 @@ public:
  *
  */
 
+constexpr size_t defaultMaxGapCount = 10000;
+
 class DuplicateMessageDetector {
 private:
+    struct NumberPairLess {
+        bool operator()(const NumberPair& lhs, const NumberPair& rhs) const {
+            return lhs.compareTo(rhs) < 0;
+        }
+    };
+
+    // Half-closed gaps (lower, upper] keyed by their UPPER bound: the
+    // lookup for a previousNumber is a single upper_bound(), and the two
+    // most common updates (a gap shrinking from below, and the
+    // no-previousNumber fast path moving the open-ended last gap) only
+    // touch the mapped lower bound, never the key. TS stores a sorted
+    // array scanned linearly from the end; this is O(log n) per message.
+    using Gaps = std::map<NumberPair, NumberPair, NumberPairLess>;
+
+    // Rough per-node cost of the red-black tree on top of the stored pair.
+    static constexpr size_t gapNodeOverhead = 4 * sizeof(void*);
+
     size_t maxGapCount;
-    std::vector<std::pair<NumberPair, NumberPair>> gaps;
+    Gaps gaps;
+    // The node of the last dropped gap, recycled for the next split so a
+    // lossy publisher at maxGapCount does not allocate per message.
+    Gaps::node_type spareNode;
 
 public:
     // NOLINTNEXTLINE
-    explicit DuplicateMessageDetector(size_t maxGapCount = 10000) {
-        this->maxGapCount = maxGapCount;
-        this->gaps = {}; // ascending order of half-closed intervals (x,y]
-                         // representing gaps that contain unseen message(s)
-    }
+    explicit DuplicateMessageDetector(size_t maxGapCount = defaultMaxGapCount)
+        : maxGapCount(maxGapCount) {}
 
     /**
      * returns true if number has not yet been seen (i.e. is not a duplicate)
@@ -133,13 +157,10 @@ public:
         }
 
         if (this->gaps.empty()) {
-            // NOLINTNEXTLINE(modernize-use-emplace)
-            this->gaps.push_back(
-                std::make_pair(
-                    number,
-                    NumberPair(
-                        std::numeric_limits<int>::max(),
-                        std::numeric_limits<int>::max())));
+            const NumberPair infinity(
+                std::numeric_limits<int>::max(),
+                std::numeric_limits<int>::max());
+            this->gaps.emplace(infinity, number);
             return true;
         }
 
@@ -147,75 +168,94 @@ public:
         // minimal duplicate detection is provided (comparing against latest
         // known message number).
         if (!previousNumber.has_value()) {
-            if (number.greaterThan(this->gaps.back().first)) {
-                this->gaps.back().first = number;
+            auto& lastLowerBound = std::prev(this->gaps.end())->second;
+            if (number.greaterThan(lastLowerBound)) {
+                lastLowerBound = number;
                 return true;
             }
             return false;
         }
 
-        for (int i = static_cast<int>(this->gaps.size()) - 1; i >= 0; --i) {
-            const auto& [lowerBound, upperBound] =
-                this->gaps[i]; // invariant: upperBound > lowerBound
+        const auto& previous = previousNumber.value();
+        // The first gap ending after previousNumber is the only candidate:
+        // every gap before it ends at or below previousNumber.
+        const auto it = this->gaps.upper_bound(previous);
+        if (it == this->gaps.end()) {
+            return false;
+        }
+        const auto upperBound = it->first; // invariant: upperBound > lowerBound
+        const auto lowerBound = it->second;
 
-            // implies number > upperBound (would've been handled in
-            // previous iteration if gap exists)
-            if (previousNumber.value().greaterThanOrEqual(upperBound)) {
-                return false;
-            }
-            if (previousNumber.value().greaterThanOrEqual(lowerBound)) {
-                if (number.greaterThan(upperBound)) {
-                    throw GapMisMatchError(
-                        this->toString(), previousNumber, number);
-                }
-                if (previousNumber.value().equalTo(lowerBound)) {
-                    if (number.equalTo(upperBound)) {
-                        this->gaps.erase(this->gaps.begin() + i);
-                    } else {
-                        this->gaps[i] = std::make_pair(number, upperBound);
-                    }
-                } else if (number.equalTo(upperBound)) {
-                    this->gaps[i] =
-                        std::make_pair(lowerBound, previousNumber.value());
-                } else {
-                    this->gaps.erase(this->gaps.begin() + i);
-                    this->gaps.insert(
-                        this->gaps.begin() + i,
-                        std::make_pair(lowerBound, previousNumber.value()));
-                    this->gaps.insert(
-                        this->gaps.begin() + i + 1,
-                        std::make_pair(number, upperBound));
-                }
-
-                // invariants after:
-                //   - gaps are in ascending order
-                //   - the intersection between any two gaps is empty
-                //   - there are no gaps that define the empty set
-                //   - last gap is [n, Infinity]
-                //   - anything not covered by a gap is considered seen
-
-                this->dropLowestGapIfOverMaxGapCount();
-                return true;
-            }
+        if (!previous.greaterThanOrEqual(lowerBound)) {
+            // previousNumber falls in an already seen range; the message is
+            // a duplicate unless it claims to reach into the next gap
             if (number.greaterThan(lowerBound)) {
-                throw GapMisMatchError(
-                    this->toString(), previousNumber, number);
+                throw GapMisMatchError(this->toString(), previousNumber, number);
+            }
+            return false;
+        }
+        if (number.greaterThan(upperBound)) {
+            throw GapMisMatchError(this->toString(), previousNumber, number);
+        }
+        if (previous.equalTo(lowerBound)) {
+            if (number.equalTo(upperBound)) {
+                this->gaps.erase(it);
+            } else {
+                it->second = number;
             }
+        } else if (number.equalTo(upperBound)) {
+            auto node = this->gaps.extract(it);
+            node.key() = previous;
+            this->gaps.insert(std::move(node));
+        } else {
+            it->second = number;
+            this->insertGap(lowerBound, previous);
         }
-        return false;
+
+        // invariants after:
+        //   - gaps are in ascending order
+        //   - the intersection between any two gaps is empty
+        //   - there are no gaps that define the empty set
+        //   - last gap is [n, Infinity]
+        //   - anything not covered by a gap is considered seen
+
+        this->dropLowestGapIfOverMaxGapCount();
+        return true;
+    }
+
+    /**
+     * Approximate heap + inline footprint in bytes, used by
+     * DuplicateDetectorIndex to enforce its memory budget.
+     */
+    [[nodiscard]] size_t getMemoryUsage() const {
+        const size_t nodeCount =
+            this->gaps.size() + (this->spareNode.empty() ? 0 : 1);
+        return sizeof(DuplicateMessageDetector) +
+            (nodeCount * (sizeof(Gaps::value_type) + gapNodeOverhead));
     }
 
 private:
+    void insertGap(const NumberPair& lowerBound, const NumberPair& upperBound) {
+        if (this->spareNode.empty()) {
+            this->gaps.emplace(upperBound, lowerBound);
+            return;
+        }
+        this->spareNode.key() = upperBound;
+        this->spareNode.mapped() = lowerBound;
+        this->gaps.insert(std::move(this->spareNode));
+        this->spareNode = {};
+    }
+
     void dropLowestGapIfOverMaxGapCount() {
         // invariant: this.gaps.length <= this.maxGapCount + 1
         if (this->gaps.size() > this->maxGapCount) {
-            this->gaps.erase(this->gaps.begin());
+            this->spareNode = this->gaps.extract(this->gaps.begin());
         }
     }
 
     [[nodiscard]] std::string toString() const {
         std::stringstream ss;
-        for (const auto& [lower, upper] : this->gaps) {
+        for (const auto& [upper, lower] : this->gaps) {
             ss << "(" << lower.toString() << ", " << upper.toString() << "]";
         }
         return ss.str();
@@ -0,0 +1,50 @@
+// Module streamr.trackerlessnetwork.SerializedStreamMessage
+// Native-only (no TS counterpart): a StreamMessage together with its
+// packed RPC body. A broadcast fans one message out to every neighbor,
+// proxy and temporary connection; packing it here once lets every send
+// reuse the same encoded bytes instead of re-encoding the message per
+// target (the TS client encodes per call, and so did this port).
+module;
+
+#include <memory>
+#include <utility>
+#include <google/protobuf/any.pb.h>
+
+export module streamr.trackerlessnetwork.SerializedStreamMessage;
+
+import streamr.trackerlessnetwork.protos;
+
+export namespace streamr::trackerlessnetwork {
+
+/**
+ * Immutable after construction, so one instance is shared (through
+ * SharedStreamMessage) by all concurrent sends of a broadcast.
+ */
+class SerializedStreamMessage {
+private:
+    StreamMessage message;
+    google::protobuf::Any body;
+
+public:
+    explicit SerializedStreamMessage(StreamMessage message)
+        : message(std::move(message)) {
+        this->body.PackFrom(this->message);
+    }
+
+    [[nodiscard]] const StreamMessage& getMessage() const {
+        return this->message;
+    }
+
+    // The Any-packed message, ready to be used as an RpcMessage body.
+    [[nodiscard]] const google::protobuf::Any& getBody() const {
+        return this->body;
+    }
+};
+
+using SharedStreamMessage = std::shared_ptr<const SerializedStreamMessage>;
+
+inline SharedStreamMessage serializeStreamMessage(StreamMessage message) {
+    return std::make_shared<const SerializedStreamMessage>(std::move(message));
+}
+
+} // namespace streamr::trackerlessnetwork
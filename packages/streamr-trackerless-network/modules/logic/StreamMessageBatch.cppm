@@ -0,0 +1,52 @@
+// Module streamr.trackerlessnetwork.StreamMessageBatch
+// Native-only (no TS counterpart): helpers for sendStreamMessageBatch.
+// The StreamMessageBatch message, the ContentDeliveryRpc method carrying
+// it and the acceptsStreamMessageBatches handshake flag are declared in
+// the NATIVE-ONLY sections of NetworkRpc.proto. TS nodes never set the
+// flag, so they keep getting single sendStreamMessage notifications.
+//
+// A batch entry is a serialized StreamMessage, so packing reuses the
+// bytes SerializedStreamMessage already encoded for the broadcast.
+module;
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+export module streamr.trackerlessnetwork.StreamMessageBatch;
+
+import streamr.trackerlessnetwork.protos;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+
+export namespace streamr::trackerlessnetwork {
+
+class MalformedStreamMessageBatch : public std::runtime_error {
+public:
+    explicit MalformedStreamMessageBatch(const std::string& message)
+        : std::runtime_error("Malformed StreamMessage batch: " + message) {}
+};
+
+inline StreamMessageBatch packStreamMessageBatch(
+    std::span<const SharedStreamMessage> messages) {
+    StreamMessageBatch batch;
+    batch.mutable_messages()->Reserve(static_cast<int>(messages.size()));
+    for (const auto& message : messages) {
+        batch.add_messages(message->getBody().value());
+    }
+    return batch;
+}
+
+inline std::vector<StreamMessage> unpackStreamMessageBatch(
+    const StreamMessageBatch& batch) {
+    std::vector<StreamMessage> messages(batch.messages_size());
+    for (int i = 0; i < batch.messages_size(); ++i) {
+        if (!messages[i].ParseFromString(batch.messages(i))) {
+            throw MalformedStreamMessageBatch(
+                "unparseable StreamMessage at index " + std::to_string(i));
+        }
+    }
+    return messages;
+}
+
+} // namespace streamr::trackerlessnetwork
@@ -0,0 +1,383 @@
+// Module streamr.trackerlessnetwork.StreamMessageSignatureVerifier
+// Native-only (no TS counterpart): relay-side signature verification of
+// incoming StreamMessages. TS nodes leave verification to the subscribing
+// SDK; with this stage enabled a relay drops forged traffic before it is
+// propagated to every downstream consumer.
+//
+// StreamMessageSignatureVerifier checks one message: it rebuilds the
+// ECDSA_SECP256K1_EVM signature payload (the layout the proxy client
+// signs, plus the previous message ref as the TS SDK adds it), recovers
+// the signer and compares it with MessageID.publisherId. Recovered
+// results are cached by (payload hash, signature) — the hash covers the
+// publisher id — so the copies of a message that arrive from several
+// neighbors cost one recovery. Rejections are counted per publisher.
+//
+// StreamMessageVerificationStage runs the verifier off the RPC dispatch
+// thread: submitted messages are queued and drained in batches by up to
+// maxParallelBatches coroutines on the shared worker pool, so recoveries
+// run on several cores at once. Delivery keeps the submission order: a
+// verified message waits until every message submitted before it has been
+// verified, because the duplicate detector drops a message whose chain
+// already moved past it. At most maxQueueDepth messages wait in the stage;
+// when a slow verifier or consumer lets it fill up, further submits are
+// dropped and counted.
+module;
+
+#include <coroutine> // IWYU pragma: keep
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <folly/container/F14Map.h>
+
+export module streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
+
+import streamr.trackerlessnetwork.protos;
+
+import streamr.dht.Identifiers;
+import streamr.logger.SLogger;
+import streamr.utils.BinaryUtils;
+import streamr.utils.CoroutineHelper;
+import streamr.utils.GuardedAsyncScope;
+import streamr.utils.SharedExecutors;
+import streamr.utils.SigningUtils;
+
+// Hoisted (file scope, NOT exported); fully qualified because relative
+// namespace names resolve differently at file scope than inside the
+// package namespace.
+using streamr::dht::DhtAddress;
+using streamr::logger::SLogger;
+using streamr::utils::BinaryUtils;
+using streamr::utils::SigningUtils;
+export namespace streamr::trackerlessnetwork {
+
+enum class SignatureVerificationResult : uint8_t {
+    Valid,
+    Invalid,
+    // Not an ECDSA_SECP256K1_EVM content message, or one whose payload
+    // the relay cannot rebuild (new group key attached).
+    Unverifiable
+};
+
+inline constexpr size_t DEFAULT_SIGNATURE_CACHE_SIZE = 16384; // NOLINT
+
+struct StreamMessageSignatureVerifierOptions {
+    // Recovered signers kept for duplicate copies of recent messages.
+    size_t cacheSize = DEFAULT_SIGNATURE_CACHE_SIZE;
+    // Drop messages that cannot be verified instead of passing them on.
+    bool rejectUnverifiable = false;
+};
+
+/**
+ * Verifies StreamMessage signatures. Thread-safe: verify() is called from
+ * several workers at once.
+ */
+class StreamMessageSignatureVerifier {
+private:
+    static constexpr size_t cacheShardCount = 16;
+
+    // One lock per shard keeps parallel workers from serializing on the
+    // cache. Entries are evicted in insertion order.
+    struct CacheShard {
+        std::mutex mutex;
+        folly::F14FastMap<std::string, bool> entries;
+        std::deque<std::string> order;
+    };
+
+    StreamMessageSignatureVerifierOptions options;
+    size_t shardCapacity;
+    std::array<CacheShard, cacheShardCount> cache;
+    mutable std::mutex rejectedMutex;
+    // Keyed by the publisher id as 0x-prefixed lowercase hex.
+    std::map<std::string, uint64_t> rejected;
+    std::atomic<uint64_t> verified = 0;
+    std::atomic<uint64_t> cacheHits = 0;
+
+public:
+    explicit StreamMessageSignatureVerifier(
+        StreamMessageSignatureVerifierOptions options = {})
+        : options(options),
+          shardCapacity(
+              std::max<size_t>(1, options.cacheSize / cacheShardCount)) {}
+
+    // The bytes the publisher signed, or nullopt if the message is not
+    // an ECDSA_SECP256K1_EVM content message this relay can rebuild.
+    static std::optional<std::string> createSignaturePayload(
+        const StreamMessage& message) {
+        if (message.signaturetype() != SignatureType::ECDSA_SECP256K1_EVM ||
+            !message.has_contentmessage() ||
+            message.contentmessage().has_newgroupkey()) {
+            return std::nullopt;
+        }
+        const auto& messageId = message.messageid();
+        std::string payload = messageId.streamid() +
+            std::to_string(messageId.streampartition()) +
+            std::to_string(messageId.timestamp()) +
+            std::to_string(messageId.sequencenumber()) +
+            BinaryUtils::binaryStringToHex(messageId.publisherid(), true) +
+            messageId.messagechainid();
+        if (message.has_previousmessageref()) {
+            const auto& previous = message.previousmessageref();
+            payload += std::to_string(previous.timestamp()) +
+                std::to_string(previous.sequencenumber());
+        }
+        payload += message.contentmessage().content();
+        return payload;
+    }
+
+    SignatureVerificationResult verify(const StreamMessage& message) {
+        const auto payload = createSignaturePayload(message);
+        if (!payload.has_value()) {
+            if (this->options.rejectUnverifiable) {
+                this->reject(message);
+            }
+            return SignatureVerificationResult::Unverifiable;
+        }
+        const auto hash = SigningUtils::hash(payload.value());
+        const auto key = hash + message.signature();
+        auto& shard = this->cache[std::hash<std::string>{}(key) %
+                                  cacheShardCount];
+        std::optional<bool> valid;
+        {
+            std::scoped_lock lock(shard.mutex);
+            const auto it = shard.entries.find(key);
+            if (it != shard.entries.end()) {
+                valid = it->second;
+            }
+        }
+        if (valid.has_value()) {
+            this->cacheHits++;
+        } else {
+            const auto signer =
+                SigningUtils::recoverAddressFromHash(hash, message.signature());
+            valid = signer.has_value() &&
+                signer.value() == message.messageid().publisherid();
+            this->remember(shard, key, valid.value());
+        }
+        this->verified++;
+        if (!valid.value()) {
+            this->reject(message);
+            return SignatureVerificationResult::Invalid;
+        }
+        return SignatureVerificationResult::Valid;
+    }
+
+    // Whether a message with this result is passed on.
+    [[nodiscard]] bool accepts(SignatureVerificationResult result) const {
+        return result == SignatureVerificationResult::Valid ||
+            (result == SignatureVerificationResult::Unverifiable &&
+             !this->options.rejectUnverifiable);
+    }
+
+    [[nodiscard]] uint64_t getRejectedMessageCount(
+        const std::string& publisherIdHex) const {
+        std::scoped_lock lock(this->rejectedMutex);
+        const auto it = this->rejected.find(publisherIdHex);
+        return it == this->rejected.end() ? 0 : it->second;
+    }
+
+    // Rejected messages per publisher (0x-prefixed lowercase hex).
+    [[nodiscard]] std::map<std::string, uint64_t> getRejectedMessageCounts()
+        const {
+        std::scoped_lock lock(this->rejectedMutex);
+        return this->rejected;
+    }
+
+    // Signatures checked, including cache hits.
+    [[nodiscard]] uint64_t getVerifiedCount() const { return this->verified; }
+
+    [[nodiscard]] uint64_t getCacheHitCount() const { return this->cacheHits; }
+
+private:
+    void remember(CacheShard& shard, const std::string& key, bool valid) {
+        std::scoped_lock lock(shard.mutex);
+        if (!shard.entries.emplace(key, valid).second) {
+            return;
+        }
+        shard.order.push_back(key);
+        if (shard.order.size() > this->shardCapacity) {
+            shard.entries.erase(shard.order.front());
+            shard.order.pop_front();
+        }
+    }
+
+    void reject(const StreamMessage& message) {
+        const auto publisherId = BinaryUtils::binaryStringToHex(
+            message.messageid().publisherid(), true);
+        std::scoped_lock lock(this->rejectedMutex);
+        this->rejected[publisherId]++;
+    }
+};
+
+inline constexpr size_t DEFAULT_VERIFICATION_BATCH_SIZE = 32; // NOLINT
+inline constexpr size_t DEFAULT_VERIFICATION_QUEUE_DEPTH = 4096; // NOLINT
+
+struct StreamMessageVerificationStageOptions {
+    std::shared_ptr<StreamMessageSignatureVerifier> verifier;
+    // Called, on a worker thread, with each message the verifier accepts
+    // and the neighbor it came from.
+    std::function<void(const StreamMessage&, const DhtAddress&)> onVerified;
+    size_t maxBatchSize = DEFAULT_VERIFICATION_BATCH_SIZE;
+    // Defaults to the hardware concurrency.
+    std::optional<size_t> maxParallelBatches;
+    // Messages submitted and not yet delivered; a submit beyond this is
+    // dropped.
+    size_t maxQueueDepth = DEFAULT_VERIFICATION_QUEUE_DEPTH;
+};
+
+class StreamMessageVerificationStage {
+private:
+    struct Pending {
+        StreamMessage message;
+        DhtAddress sender;
+        // Set when verified: whether the message is passed on.
+        std::optional<bool> accepted;
+    };
+
+    StreamMessageVerificationStageOptions options;
+    size_t maxParallelBatches;
+    std::mutex mutex;
+    // Submission order, until delivered. A deque keeps the references the
+    // batches hold valid while other items are pushed and popped.
+    std::deque<Pending> submitted;
+    // Items of `submitted` not yet taken by a batch.
+    std::deque<Pending*> unverified;
+    size_t runningBatches = 0;
+    bool delivering = false;
+    uint64_t droppedMessages = 0;
+    streamr::utils::GuardedAsyncScope scope;
+
+public:
+    explicit StreamMessageVerificationStage(
+        StreamMessageVerificationStageOptions options)
+        : options(std::move(options)),
+          maxParallelBatches(this->options.maxParallelBatches.value_or(
+              std::max(1U, std::thread::hardware_concurrency()))) {}
+
+    // Returns false if the message was dropped because the stage is full.
+    bool submit(StreamMessage message, DhtAddress sender) {
+        {
+            std::scoped_lock lock(this->mutex);
+            if (this->submitted.size() >=
+                std::max<size_t>(this->options.maxQueueDepth, 1)) {
+                this->droppedMessages++;
+                SLogger::trace(
+                    "Verification queue full, dropping message from " +
+                    sender);
+                return false;
+            }
+            this->submitted.push_back(Pending{
+                .message = std::move(message), .sender = std::move(sender)});
+            this->unverified.push_back(&this->submitted.back());
+            if (this->runningBatches >= this->maxParallelBatches) {
+                return true;
+            }
+            this->runningBatches++;
+        }
+        this->scope.add(
+            streamr::utils::co_withExecutor(
+                &streamr::utils::SharedExecutors::worker(),
+                this->drain()));
+        return true;
+    }
+
+    // Messages submitted and not yet verified.
+    [[nodiscard]] size_t getQueueDepth() {
+        std::scoped_lock lock(this->mutex);
+        return this->unverified.size();
+    }
+
+    // Messages dropped by a full stage since construction.
+    [[nodiscard]] uint64_t getDroppedMessageCount() {
+        std::scoped_lock lock(this->mutex);
+        return this->droppedMessages;
+    }
+
+    // Waits for the running batches; later submits are dropped.
+    void stop() {
+        {
+            std::scoped_lock lock(this->mutex);
+            // Dropped items are not delivered, but must not hold back the
+            // messages the running batches verify before them.
+            for (auto* item : this->unverified) {
+                item->accepted = false;
+            }
+            this->unverified.clear();
+        }
+        this->scope.close();
+    }
+
+private:
+    folly::coro::Task<void> drain() {
+        std::vector<Pending*> batch;
+        std::vector<bool> results;
+        batch.reserve(this->options.maxBatchSize);
+        results.reserve(this->options.maxBatchSize);
+        while (true) {
+            {
+                std::scoped_lock lock(this->mutex);
+                if (this->unverified.empty()) {
+                    this->runningBatches--;
+                    co_return;
+                }
+                while (!this->unverified.empty() &&
+                       batch.size() < this->options.maxBatchSize) {
+                    batch.push_back(this->unverified.front());
+                    this->unverified.pop_front();
+                }
+            }
+            // Only this batch touches the messages of its items until
+            // their results are set.
+            for (const auto* item : batch) {
+                results.push_back(this->options.verifier->accepts(
+                    this->options.verifier->verify(item->message)));
+            }
+            {
+                std::scoped_lock lock(this->mutex);
+                for (size_t i = 0; i < batch.size(); ++i) {
+                    batch[i]->accepted = results[i];
+                }
+            }
+            this->deliverVerified();
+            batch.clear();
+            results.clear();
+        }
+    }
+
+    // Delivers the verified head of `submitted`. One caller delivers at a
+    // time, outside the lock; a batch that finishes meanwhile leaves its
+    // results to that caller, which re-checks the head after each message.
+    void deliverVerified() {
+        std::unique_lock lock(this->mutex);
+        if (this->delivering) {
+            return;
+        }
+        this->delivering = true;
+        while (!this->submitted.empty() &&
+               this->submitted.front().accepted.has_value()) {
+            auto item = std::move(this->submitted.front());
+            this->submitted.pop_front();
+            if (!item.accepted.value()) {
+                continue;
+            }
+            lock.unlock();
+            this->options.onVerified(item.message, item.sender);
+            lock.lock();
+        }
+        this->delivering = false;
+    }
+};
+
+} // namespace streamr::trackerlessnetwork
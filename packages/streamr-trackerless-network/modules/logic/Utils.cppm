@@ -3,37 +3,23 @@
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
 module;
 
-#include <map>
 #include <optional>
-#include <string>
-#include <boost/algorithm/hex.hpp>
 
 export module streamr.trackerlessnetwork.Utils;
 
 import streamr.trackerlessnetwork.protos;
 
-import streamr.dht.Identifiers;
+import streamr.trackerlessnetwork.DuplicateDetectorIndex;
 import streamr.trackerlessnetwork.DuplicateMessageDetector;
 
-// Hoisted from the former header (file scope, NOT exported);
-// fully qualified because relative namespace names resolve
-// differently at file scope than inside the package namespace.
-using streamr::dht::DhtAddressRaw;
-using streamr::dht::Identifiers;
 export namespace streamr::trackerlessnetwork {
 
 class Utils {
 public:
     static bool markAndCheckDuplicate(
-        std::map<std::string, DuplicateMessageDetector>& duplicateDetectors,
+        DuplicateDetectorIndex& duplicateDetectors,
         const MessageID& currentMessage,
         const std::optional<MessageRef>& previousMessageRef) {
-        const auto& publisherIdRaw = currentMessage.publisherid();
-        auto publisherId =
-            Identifiers::getDhtAddressFromRaw(DhtAddressRaw{publisherIdRaw});
-        const auto& detectorKey =
-            publisherId + "-" + currentMessage.messagechainid();
-
         std::optional<NumberPair> previousNumberPair =
             previousMessageRef.has_value()
             ? std::make_optional(NumberPair(
@@ -43,11 +29,13 @@ public:
 
         NumberPair currentNumberPair(
             currentMessage.timestamp(), currentMessage.sequencenumber());
-        if (!duplicateDetectors.contains(detectorKey)) {
-            duplicateDetectors.emplace(detectorKey, DuplicateMessageDetector{});
-        }
-        return duplicateDetectors.at(detectorKey)
-            .markAndCheck(previousNumberPair, currentNumberPair);
+        // The raw publisher id and chain id key the index directly: no
+        // hex encoding or key concatenation per message.
+        return duplicateDetectors.markAndCheck(
+            currentMessage.publisherid(),
+            currentMessage.messagechainid(),
+            previousNumberPair,
+            currentNumberPair);
     }
 };
 
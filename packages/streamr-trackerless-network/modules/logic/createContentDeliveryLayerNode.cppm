@@ -4,10 +4,14 @@
 // components of ContentDeliveryLayerNode with defaults built from the
 // exact TS default values (neighbor target 4, view size 20, min
 // propagation targets 2, buffer 150 / 10 s, update interval 10 s).
-// The plumtree branch is milestone-E scope and omitted; the TS
+// plumtreeOptimization builds a PlumtreeManager over the neighbor list
+// (TS only constructs one when the option is set). The TS
 // bufferWhileConnecting send flag is not plumbed through the C++
 // send options yet (documented deviation — propagation retries cover
-// the connecting window).
+// the connecting window). streamMessageBatching (native-only) negotiates
+// sendStreamMessageBatch with neighbors in the handshake and lets
+// Propagation batch the sends to the neighbors that accepted it.
+// signatureVerifier (native-only) turns on relay-side signature checks.
 module;
 
 #include <coroutine> // IWYU pragma: keep
@@ -30,14 +34,18 @@ import streamr.trackerlessnetwork.protos;
 import streamr.utils.CoroutineHelper;
 import streamr.trackerlessnetwork.ContentDeliveryLayerNode;
 import streamr.trackerlessnetwork.DiscoveryLayerNode;
+import streamr.trackerlessnetwork.DuplicateDetectorIndex;
 import streamr.trackerlessnetwork.formStreamPartDeliveryServiceId;
 import streamr.trackerlessnetwork.Handshaker;
 import streamr.trackerlessnetwork.Inspector;
 import streamr.trackerlessnetwork.NeighborFinder;
 import streamr.trackerlessnetwork.NeighborUpdateManager;
 import streamr.trackerlessnetwork.NodeList;
+import streamr.trackerlessnetwork.PlumtreeManager;
 import streamr.trackerlessnetwork.Propagation;
 import streamr.trackerlessnetwork.ProxyConnectionRpcLocal;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
 import streamr.trackerlessnetwork.TemporaryConnectionRpcLocal;
 import streamr.dht.ConnectionLocker;
 import streamr.dht.Identifiers;
@@ -69,9 +77,13 @@ using streamr::trackerlessnetwork::neighbordiscovery::NeighborFinderOptions;
 using streamr::trackerlessnetwork::neighbordiscovery::NeighborUpdateManager;
 using streamr::trackerlessnetwork::neighbordiscovery::
     NeighborUpdateManagerOptions;
+using streamr::trackerlessnetwork::plumtree::defaultMaxPausedNeighbors;
+using streamr::trackerlessnetwork::plumtree::PlumtreeManager;
+using streamr::trackerlessnetwork::plumtree::PlumtreeManagerOptions;
 using streamr::trackerlessnetwork::propagation::DEFAULT_MAX_MESSAGES;
 using streamr::trackerlessnetwork::propagation::DEFAULT_TTL;
 using streamr::trackerlessnetwork::propagation::Propagation;
+using streamr::trackerlessnetwork::propagation::PropagationBatchingOptions;
 using streamr::trackerlessnetwork::propagation::PropagationOptions;
 using streamr::trackerlessnetwork::proxy::ProxyConnectionRpcLocal;
 using streamr::trackerlessnetwork::proxy::ProxyConnectionRpcLocalOptions;
@@ -102,10 +114,21 @@ struct ContentDeliveryLayerNodeOptions {
     std::optional<size_t> maxContactCount;
     std::optional<size_t> minPropagationTargets;
     std::optional<size_t> maxPropagationBufferSize;
+    // Bound on the sends queued to one neighbor (see Propagation).
+    std::optional<size_t> propagationSendQueueHighWaterMark;
     std::optional<bool> acceptProxyConnections;
     std::optional<std::chrono::milliseconds> neighborUpdateInterval;
     std::optional<std::chrono::milliseconds> rpcRequestTimeout;
     bool suppressOwnMessageLoopback = false;
+    DuplicateDetectorIndexOptions duplicateDetectorOptions;
+    // Opt-in Plumtree delivery: neighbors that deliver duplicates are
+    // paused to MessageID metadata per message chain.
+    bool plumtreeOptimization = false;
+    std::optional<size_t> plumtreeMaxPausedNeighbors;
+    // Opt-in micro-batching of sends to neighbors that also enable it.
+    bool streamMessageBatching = false;
+    // Verify incoming signatures with this (shared) verifier.
+    std::shared_ptr<StreamMessageSignatureVerifier> signatureVerifier;
 };
 
 inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
@@ -153,6 +176,28 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
                 .streamPartId = options.streamPartId,
                 .rpcCommunicator = *rpcCommunicator});
     }
+    std::optional<PropagationBatchingOptions> batching;
+    if (options.streamMessageBatching) {
+        batching = PropagationBatchingOptions{
+            .sendBatchToNeighbor =
+                [neighbors](
+                    const DhtAddress& neighborId,
+                    std::vector<SharedStreamMessage> messages)
+                -> folly::coro::Task<void> {
+                const auto remote = neighbors->get(neighborId);
+                if (!remote.has_value()) {
+                    throw std::runtime_error("Propagation target not found");
+                }
+                co_await remote.value()->sendStreamMessageBatch(
+                    std::move(messages));
+            },
+            .acceptsBatches =
+                [neighbors](const DhtAddress& neighborId) {
+                    const auto remote = neighbors->get(neighborId);
+                    return remote.has_value() &&
+                        remote.value()->acceptsStreamMessageBatches();
+                }};
+    }
     auto propagation = options.propagation
         ? options.propagation
         : std::make_shared<Propagation>(PropagationOptions{
@@ -161,7 +206,8 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
                    temporaryConnectionRpcLocal,
                    proxyConnectionRpcLocal](
                       const DhtAddress& neighborId,
-                      const StreamMessage& msg) -> folly::coro::Task<void> {
+                      const SharedStreamMessage& msg)
+                  -> folly::coro::Task<void> {
                   auto remote = neighbors->get(neighborId);
                   if (!remote.has_value()) {
                       remote = temporaryConnectionRpcLocal->getNodes().get(
@@ -186,7 +232,10 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
                   defaultMinPropagationTargets),
               .ttl = DEFAULT_TTL,
               .maxMessages = options.maxPropagationBufferSize.value_or(
-                  DEFAULT_MAX_MESSAGES)});
+                  DEFAULT_MAX_MESSAGES),
+              .sendQueueHighWaterMark =
+                  options.propagationSendQueueHighWaterMark,
+              .batching = std::move(batching)});
     auto handshaker = options.handshaker
         ? options.handshaker
         : std::make_shared<Handshaker>(HandshakerOptions{
@@ -200,7 +249,8 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
               .rpcCommunicator = *rpcCommunicator,
               .maxNeighborCount = neighborTargetCount,
               .ongoingHandshakes = *ongoingHandshakes,
-              .rpcRequestTimeout = options.rpcRequestTimeout});
+              .rpcRequestTimeout = options.rpcRequestTimeout,
+              .acceptStreamMessageBatches = options.streamMessageBatching});
     auto neighborFinder = options.neighborFinder
         ? options.neighborFinder
         : std::static_pointer_cast<INeighborFinder>(
@@ -236,6 +286,24 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
               .streamPartId = options.streamPartId,
               .rpcCommunicator = *rpcCommunicator,
               .connectionLocker = *options.connectionLocker});
+    std::shared_ptr<PlumtreeManager> plumtreeManager;
+    if (options.plumtreeOptimization) {
+        plumtreeManager = std::make_shared<PlumtreeManager>(
+            PlumtreeManagerOptions{
+                .neighbors = *neighbors,
+                .localPeerDescriptor = options.localPeerDescriptor,
+                .rpcCommunicator = *rpcCommunicator,
+                .queueReplay =
+                    [propagation](
+                        const DhtAddress& neighborId,
+                        const std::vector<SharedStreamMessage>& messages) {
+                        propagation->feedMessagesToNeighbor(
+                            neighborId, messages);
+                    },
+                .maxPausedNeighbors = options.plumtreeMaxPausedNeighbors.value_or(
+                    defaultMaxPausedNeighbors),
+                .rpcRequestTimeout = options.rpcRequestTimeout});
+    }
 
     return std::make_shared<ContentDeliveryLayerNode>(
         StrictContentDeliveryLayerNodeOptions{
@@ -259,10 +327,13 @@ inline std::shared_ptr<ContentDeliveryLayerNode> createContentDeliveryLayerNode(
             .neighborFinder = neighborFinder,
             .neighborUpdateManager = neighborUpdateManager,
             .inspector = inspector,
+            .plumtreeManager = plumtreeManager,
+            .signatureVerifier = std::move(options.signatureVerifier),
             .neighborTargetCount = neighborTargetCount,
             .isLocalNodeEntryPoint = std::move(options.isLocalNodeEntryPoint),
             .rpcRequestTimeout = options.rpcRequestTimeout,
-            .suppressOwnMessageLoopback = options.suppressOwnMessageLoopback});
+            .suppressOwnMessageLoopback = options.suppressOwnMessageLoopback,
+            .duplicateDetectorOptions = options.duplicateDetectorOptions});
 }
 
 } // namespace streamr::trackerlessnetwork
@@ -10,6 +10,9 @@
 // drained on destruction. The task is time-bounded (the remote call
 // carries interleaveRequestTimeout and swallows errors), satisfying the
 // every-scope-task-must-be-bounded rule.
+//
+// Native addition: accepted requesters are tagged with their
+// acceptsStreamMessageBatches flag, and the response carries this node's.
 module;
 
 // Coroutine definitions need std::coroutine_traits declared in THIS
@@ -70,6 +73,8 @@ struct HandshakeRpcLocalOptions {
         createContentDeliveryRpcRemote;
     std::function<folly::coro::Task<bool>(PeerDescriptor, DhtAddress)>
         handshakeWithInterleaving;
+    // Advertise that this node accepts sendStreamMessageBatch.
+    bool acceptStreamMessageBatches = false;
 };
 
 class HandshakeRpcLocal {
@@ -161,11 +166,22 @@ private:
         StreamPartHandshakeResponse response;
         response.set_requestid(request.requestid());
         response.set_accepted(true);
-        this->options.neighbors.add(
-            this->options.createContentDeliveryRpcRemote(requester));
+        this->addNeighbor(request, requester, response);
         return response;
     }
 
+    void addNeighbor(
+        const StreamPartHandshakeRequest& request,
+        const PeerDescriptor& requester,
+        StreamPartHandshakeResponse& response) {
+        auto remote = this->options.createContentDeliveryRpcRemote(requester);
+        remote->setAcceptsStreamMessageBatches(
+            request.acceptsstreammessagebatches());
+        this->options.neighbors.add(remote);
+        response.set_acceptsstreammessagebatches(
+            this->options.acceptStreamMessageBatches);
+    }
+
     static StreamPartHandshakeResponse rejectHandshake(
         const StreamPartHandshakeRequest& request) {
         StreamPartHandshakeResponse response;
@@ -229,11 +245,10 @@ private:
                             this->options.ongoingInterleaves.erase(nodeId);
                         })));
         }
-        this->options.neighbors.add(
-            this->options.createContentDeliveryRpcRemote(requester));
         StreamPartHandshakeResponse response;
         response.set_requestid(request.requestid());
         response.set_accepted(true);
+        this->addNeighbor(request, requester, response);
         if (lastPeerDescriptor.has_value()) {
             *response.mutable_interleavetargetdescriptor() =
                 lastPeerDescriptor.value();
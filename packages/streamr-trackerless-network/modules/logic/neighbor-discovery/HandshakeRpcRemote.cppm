@@ -3,6 +3,9 @@
 // neighbor-discovery/HandshakeRpcRemote.ts (v103.8.0-rc.3): the client
 // side of stream-part neighbor handshakes. Both RPCs swallow errors and
 // report them as not-accepted, matching the TS behavior.
+//
+// Native addition: the handshake carries the acceptsStreamMessageBatches
+// flag both ways.
 module;
 
 // Coroutine definitions need std::coroutine_traits declared in THIS
@@ -51,6 +54,8 @@ constexpr std::chrono::milliseconds interleaveRequestTimeout{10000};
 struct HandshakeResponse {
     bool accepted = false;
     std::optional<PeerDescriptor> interleaveTargetDescriptor;
+    // The remote node accepts sendStreamMessageBatch.
+    bool acceptsStreamMessageBatches = false;
 };
 
 class HandshakeRpcRemote : public RpcRemote<HandshakeRpcClient> {
@@ -70,7 +75,8 @@ public:
         StreamPartID streamPartId,
         std::vector<DhtAddress> neighborNodeIds,
         std::optional<DhtAddress> concurrentHandshakeNodeId = std::nullopt,
-        std::optional<DhtAddress> interleaveNodeId = std::nullopt) {
+        std::optional<DhtAddress> interleaveNodeId = std::nullopt,
+        bool acceptStreamMessageBatches = false) {
         StreamPartHandshakeRequest request;
         request.set_streampartid(streamPartId);
         request.set_requestid(Uuid::v4());
@@ -86,11 +92,15 @@ public:
             request.set_interleavenodeid(
                 Identifiers::getRawFromDhtAddress(interleaveNodeId.value()));
         }
+        request.set_acceptsstreammessagebatches(acceptStreamMessageBatches);
         auto options = this->formDhtRpcOptions({});
         try {
             const auto response = co_await this->getClient().handshake(
                 std::move(request), std::move(options));
-            HandshakeResponse result{.accepted = response.accepted()};
+            HandshakeResponse result{
+                .accepted = response.accepted(),
+                .acceptsStreamMessageBatches =
+                    response.acceptsstreammessagebatches()};
             if (response.has_interleavetargetdescriptor()) {
                 result.interleaveTargetDescriptor =
                     response.interleavetargetdescriptor();
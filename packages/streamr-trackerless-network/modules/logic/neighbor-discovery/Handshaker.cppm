@@ -68,6 +68,8 @@ struct HandshakerOptions {
     size_t maxNeighborCount;
     std::set<DhtAddress>& ongoingHandshakes;
     std::optional<std::chrono::milliseconds> rpcRequestTimeout = std::nullopt;
+    // Negotiate StreamMessage batches with new neighbors.
+    bool acceptStreamMessageBatches = false;
 };
 
 class Handshaker {
@@ -99,7 +101,9 @@ public:
                       -> folly::coro::Task<bool> {
                       return this->handshakeWithInterleaving(
                           std::move(target), std::move(remoteNodeId));
-                  }}) {
+                  },
+                  .acceptStreamMessageBatches =
+                      this->options.acceptStreamMessageBatches}) {
         this->options.rpcCommunicator
             .registerRpcMethodAsync<InterleaveRequest, InterleaveResponse>(
                 "interleaveRequest",
@@ -294,10 +298,11 @@ private:
         const auto result = co_await target->handshake(
             this->options.streamPartId,
             this->options.neighbors.getIds(),
-            concurrentNodeId);
+            concurrentNodeId,
+            std::nullopt,
+            this->options.acceptStreamMessageBatches);
         if (result.accepted) {
-            this->options.neighbors.add(this->createContentDeliveryRpcRemote(
-                target->getPeerDescriptor()));
+            this->addNeighbor(target->getPeerDescriptor(), result);
         }
         if (result.interleaveTargetDescriptor.has_value()) {
             co_await this->handshakeWithInterleaving(
@@ -317,15 +322,24 @@ private:
             this->options.streamPartId,
             this->options.neighbors.getIds(),
             std::nullopt,
-            remoteNodeId);
+            remoteNodeId,
+            this->options.acceptStreamMessageBatches);
         if (result.accepted) {
-            this->options.neighbors.add(this->createContentDeliveryRpcRemote(
-                remote->getPeerDescriptor()));
+            this->addNeighbor(remote->getPeerDescriptor(), result);
         }
         this->options.ongoingHandshakes.erase(targetNodeId);
         co_return result.accepted;
     }
 
+    void addNeighbor(
+        const PeerDescriptor& targetPeerDescriptor,
+        const HandshakeResponse& response) {
+        auto remote = this->createContentDeliveryRpcRemote(targetPeerDescriptor);
+        remote->setAcceptsStreamMessageBatches(
+            response.acceptsStreamMessageBatches);
+        this->options.neighbors.add(remote);
+    }
+
     std::shared_ptr<HandshakeRpcRemote> createRpcRemote(
         const PeerDescriptor& targetPeerDescriptor) {
         HandshakeRpcClient client{this->options.rpcCommunicator};
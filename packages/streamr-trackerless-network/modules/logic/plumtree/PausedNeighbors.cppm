@@ -0,0 +1,89 @@
+// Module streamr.trackerlessnetwork.PausedNeighbors
+// Ported from packages/trackerless-network/src/content-delivery-layer/
+// plumtree/PausedNeighbors.ts (v103.8.0-rc.3): per message chain, the
+// set of neighbors whose eager push is paused. PlumtreeManager keeps two
+// of these — the neighbors it asked to pause (local) and the neighbors
+// that asked it to pause (remote).
+//
+// Adaptation: guarded by a mutex — RPC handler threads and the
+// broadcast path read and mutate the sets concurrently.
+module;
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+export module streamr.trackerlessnetwork.PausedNeighbors;
+
+import streamr.dht.Identifiers;
+
+using streamr::dht::DhtAddress;
+
+export namespace streamr::trackerlessnetwork::plumtree {
+
+class PausedNeighbors {
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, std::set<DhtAddress>> pausedNeighbors;
+    size_t limit;
+
+public:
+    explicit PausedNeighbors(size_t limit) : limit(limit) {}
+
+    // Returns false if the chain already has `limit` paused neighbors.
+    bool add(const DhtAddress& node, const std::string& msgChainId) {
+        std::scoped_lock lock(this->mutex);
+        auto& paused = this->pausedNeighbors[msgChainId];
+        if (!paused.contains(node) && paused.size() >= this->limit) {
+            return false;
+        }
+        paused.insert(node);
+        return true;
+    }
+
+    void remove(const DhtAddress& node, const std::string& msgChainId) {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->pausedNeighbors.find(msgChainId);
+        if (it == this->pausedNeighbors.end()) {
+            return;
+        }
+        it->second.erase(node);
+        if (it->second.empty()) {
+            this->pausedNeighbors.erase(it);
+        }
+    }
+
+    void removeAll(const DhtAddress& node) {
+        std::scoped_lock lock(this->mutex);
+        std::erase_if(this->pausedNeighbors, [&node](auto& entry) {
+            entry.second.erase(node);
+            return entry.second.empty();
+        });
+    }
+
+    [[nodiscard]] bool isPaused(
+        const DhtAddress& node, const std::string& msgChainId) const {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->pausedNeighbors.find(msgChainId);
+        return it != this->pausedNeighbors.end() && it->second.contains(node);
+    }
+
+    [[nodiscard]] size_t size(const std::string& msgChainId) const {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->pausedNeighbors.find(msgChainId);
+        return it == this->pausedNeighbors.end() ? 0 : it->second.size();
+    }
+
+    // Snapshot: callers act on it outside the lock (they send RPCs).
+    [[nodiscard]] std::vector<std::pair<std::string, std::set<DhtAddress>>>
+    getAll() const {
+        std::scoped_lock lock(this->mutex);
+        return {this->pausedNeighbors.begin(), this->pausedNeighbors.end()};
+    }
+};
+
+} // namespace streamr::trackerlessnetwork::plumtree
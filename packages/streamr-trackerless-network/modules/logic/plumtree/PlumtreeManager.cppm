@@ -0,0 +1,465 @@
+// Module streamr.trackerlessnetwork.PlumtreeManager
+// Ported from packages/trackerless-network/src/content-delivery-layer/
+// plumtree/PlumtreeManager.ts (v103.8.0-rc.3): Plumtree (epidemic
+// broadcast tree) delivery on top of the neighbor list. Every neighbor
+// starts in the eager set; a neighbor that delivers a duplicate is asked
+// to pause (it then sends only MessageID metadata for that message
+// chain), which prunes the random overlay into a spanning tree per
+// chain. Metadata for messages this node has not seen repairs the tree:
+// the metadata sender is resumed and replays its buffer from the latest
+// timestamp this node has.
+//
+// Adaptations: the eager pushes are not sent here but returned to the
+// caller, which queues them on its Propagation; buffer replays go to the
+// same Propagation send queues through queueReplay. Metadata goes through
+// a bounded queue per paused neighbor, drained by one coroutine per
+// neighbor like Propagation's send queues. Pause and resume requests run
+// as tasks on a GuardedAsyncScope (TS awaits every send one by one inside
+// broadcast; the C++ broadcast is called from RPC delivery handlers,
+// which must not block). At least one neighbor per
+// chain is always left eager — the pause budget is
+// min(maxPausedNeighbors, neighbors - 1) — so a small neighborhood
+// cannot pause itself out of the data path while the metadata repair is
+// in flight. The TS 'message' event is not needed: the owning
+// ContentDeliveryLayerNode emits before handing the message here.
+module;
+
+// Coroutine definitions need std::coroutine_traits declared in THIS
+// translation unit; it cannot arrive through an imported BMI.
+#include <coroutine> // IWYU pragma: keep
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+export module streamr.trackerlessnetwork.PlumtreeManager;
+
+import streamr.trackerlessnetwork.protos;
+
+import streamr.utils.CoroutineHelper;
+import streamr.utils.GuardedAsyncScope;
+import streamr.utils.SharedExecutors;
+import streamr.trackerlessnetwork.NetworkRpcClient;
+import streamr.trackerlessnetwork.NodeList;
+import streamr.trackerlessnetwork.PausedNeighbors;
+import streamr.trackerlessnetwork.PlumtreeRpcLocal;
+import streamr.trackerlessnetwork.PlumtreeRpcRemote;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.dht.DhtCallContext;
+import streamr.dht.Identifiers;
+import streamr.dht.ListeningRpcCommunicator;
+import streamr.dht.protos;
+
+// Hoisted (file scope, NOT exported); fully qualified because relative
+// namespace names resolve differently at file scope than inside the
+// package namespace.
+using streamr::dht::DhtAddress;
+using streamr::dht::Identifiers;
+using streamr::dht::rpcprotocol::DhtCallContext;
+using streamr::dht::transport::ListeningRpcCommunicator;
+using streamr::utils::GuardedAsyncScope;
+
+export namespace streamr::trackerlessnetwork::plumtree {
+
+using ::dht::PeerDescriptor;
+
+constexpr size_t defaultMaxPausedNeighbors = 3;
+// Per-chain replay buffer for resumed neighbors (TS MAX_BUFFER_SIZE).
+constexpr size_t plumtreeBufferSize = 20;
+constexpr size_t defaultMetadataQueueHighWaterMark = 256;
+
+using QueueReplayFn = std::function<void(
+    const DhtAddress&, const std::vector<SharedStreamMessage>&)>;
+
+struct PlumtreeManagerOptions {
+    NodeList& neighbors;
+    PeerDescriptor localPeerDescriptor;
+    ListeningRpcCommunicator& rpcCommunicator;
+    // Sends a buffer replay to a resumed neighbor, in order, behind the
+    // sends already queued to it (Propagation::feedMessagesToNeighbor).
+    QueueReplayFn queueReplay;
+    size_t maxPausedNeighbors = defaultMaxPausedNeighbors;
+    // MessageIDs queued per paused neighbor; beyond this the oldest one
+    // is dropped.
+    size_t metadataQueueHighWaterMark = defaultMetadataQueueHighWaterMark;
+    std::optional<std::chrono::milliseconds> rpcRequestTimeout;
+};
+
+class PlumtreeManager {
+private:
+    // Metadata to one neighbor, in order. `draining` is set while a drain
+    // coroutine owns the queue; there is at most one per neighbor.
+    struct MetadataQueue {
+        std::shared_ptr<PlumtreeRpcRemote> remote;
+        std::deque<MessageID> pending;
+        bool draining = false;
+    };
+
+    PlumtreeManagerOptions options;
+    // Neighbors this node asked to pause (they send it metadata only).
+    PausedNeighbors localPausedNeighbors;
+    // Neighbors that asked this node to pause (it sends them metadata).
+    PausedNeighbors remotePausedNeighbors;
+    PlumtreeRpcLocal rpcLocal;
+    std::mutex mutex;
+    std::map<std::string, std::deque<SharedStreamMessage>> latestMessages;
+    std::map<std::string, std::set<int64_t>> metadataTimestampsAheadOfRealData;
+    std::map<DhtAddress, std::shared_ptr<MetadataQueue>> metadataQueues;
+    uint64_t droppedMetadata = 0;
+    GuardedAsyncScope scope;
+
+public:
+    explicit PlumtreeManager(PlumtreeManagerOptions options)
+        : options(std::move(options)),
+          localPausedNeighbors(this->options.maxPausedNeighbors),
+          remotePausedNeighbors(this->options.maxPausedNeighbors),
+          rpcLocal(PlumtreeRpcLocalOptions{
+              .neighbors = this->options.neighbors,
+              .remotePausedNeighbors = this->remotePausedNeighbors,
+              .onMetadata =
+                  [this](
+                      const MessageID& metadata,
+                      const PeerDescriptor& previousNode) {
+                      this->onMetadata(metadata, previousNode);
+                  },
+              .sendBuffer =
+                  [this](
+                      int64_t fromTimestamp,
+                      const std::string& msgChainId,
+                      const PeerDescriptor& remotePeerDescriptor) {
+                      this->sendBuffer(
+                          fromTimestamp, msgChainId, remotePeerDescriptor);
+                  }}) {
+        this->options.rpcCommunicator
+            .registerRpcMethod<PauseNeighborRequest, PauseNeighborResponse>(
+                "pauseNeighbor",
+                [this](
+                    const PauseNeighborRequest& req,
+                    const DhtCallContext& context) {
+                    return this->rpcLocal.pauseNeighbor(req, context);
+                });
+        this->options.rpcCommunicator
+            .registerRpcNotification<ResumeNeighborRequest>(
+                "resumeNeighbor",
+                [this](
+                    const ResumeNeighborRequest& req,
+                    const DhtCallContext& context) {
+                    this->rpcLocal.resumeNeighbor(req, context);
+                });
+        this->options.rpcCommunicator.registerRpcNotification<MessageID>(
+            "sendMetadata",
+            [this](const MessageID& req, const DhtCallContext& context) {
+                this->rpcLocal.sendMetadata(req, context);
+            });
+    }
+
+    ~PlumtreeManager() { this->stop(); }
+
+    PlumtreeManager(const PlumtreeManager&) = delete;
+    PlumtreeManager& operator=(const PlumtreeManager&) = delete;
+    PlumtreeManager(PlumtreeManager&&) = delete;
+    PlumtreeManager& operator=(PlumtreeManager&&) = delete;
+
+    void stop() { this->scope.close(); }
+
+    /**
+     * Buffers msg for replays, sends only its MessageID to the neighbors
+     * that paused this chain and returns the other neighbors (except
+     * previousNode): the eager-push targets. The caller sends msg to them
+     * through its Propagation, so eager pushes share the bounded,
+     * possibly batched per-neighbor send queues with all other sends.
+     */
+    [[nodiscard]] std::vector<DhtAddress> broadcast(
+        const SharedStreamMessage& serialized,
+        const std::optional<DhtAddress>& previousNode) {
+        const auto& msg = serialized->getMessage();
+        const auto& msgChainId = msg.messageid().messagechainid();
+        {
+            std::scoped_lock lock(this->mutex);
+            auto& buffer = this->latestMessages[msgChainId];
+            if (buffer.size() >= plumtreeBufferSize) {
+                buffer.pop_front();
+            }
+            buffer.push_back(serialized);
+            const auto ahead =
+                this->metadataTimestampsAheadOfRealData.find(msgChainId);
+            if (ahead != this->metadataTimestampsAheadOfRealData.end()) {
+                ahead->second.erase(msg.messageid().timestamp());
+                if (ahead->second.empty()) {
+                    this->metadataTimestampsAheadOfRealData.erase(ahead);
+                }
+            }
+        }
+        std::vector<DhtAddress> eagerTargets;
+        for (const auto& neighbor : this->options.neighbors.getAll()) {
+            auto neighborId = Identifiers::getNodeIdFromPeerDescriptor(
+                neighbor->getPeerDescriptor());
+            if (neighborId == previousNode) {
+                continue;
+            }
+            if (this->remotePausedNeighbors.isPaused(neighborId, msgChainId)) {
+                this->queueMetadata(
+                    neighborId, neighbor->getPeerDescriptor(), msg.messageid());
+            } else {
+                eagerTargets.push_back(std::move(neighborId));
+            }
+        }
+        return eagerTargets;
+    }
+
+    /**
+     * Asks a neighbor that delivered a duplicate to stop eager-pushing
+     * msgChainId. No-op if the pause budget for the chain is spent.
+     */
+    void pauseNeighbor(const DhtAddress& nodeId, const std::string& msgChainId) {
+        const auto neighbor = this->options.neighbors.get(nodeId);
+        if (!neighbor.has_value()) {
+            return;
+        }
+        const auto neighborCount = this->options.neighbors.size();
+        const auto budget = std::min(
+            this->options.maxPausedNeighbors,
+            neighborCount > 0 ? neighborCount - 1 : 0);
+        if (this->localPausedNeighbors.isPaused(nodeId, msgChainId) ||
+            this->localPausedNeighbors.size(msgChainId) >= budget ||
+            !this->localPausedNeighbors.add(nodeId, msgChainId)) {
+            return;
+        }
+        this->schedule(
+            [this,
+             remote = this->createRemote(neighbor.value()->getPeerDescriptor()),
+             nodeId,
+             msgChainId]() -> folly::coro::Task<void> {
+                if (!co_await remote->pauseNeighbor(msgChainId)) {
+                    this->localPausedNeighbors.remove(nodeId, msgChainId);
+                }
+            });
+    }
+
+    void resumeNeighbor(
+        const PeerDescriptor& node,
+        const std::string& msgChainId,
+        int64_t fromTimestamp) {
+        const auto nodeId = Identifiers::getNodeIdFromPeerDescriptor(node);
+        if (!this->localPausedNeighbors.isPaused(nodeId, msgChainId)) {
+            return;
+        }
+        this->localPausedNeighbors.remove(nodeId, msgChainId);
+        this->schedule(
+            [remote = this->createRemote(node),
+             msgChainId,
+             fromTimestamp]() -> folly::coro::Task<void> {
+                co_await remote->resumeNeighbor(msgChainId, fromTimestamp);
+            });
+    }
+
+    /**
+     * Node should invoke this when a neighbor leaves. If every remaining
+     * neighbor is paused for a chain, the first one is resumed so the
+     * chain keeps an eager path.
+     */
+    void onNeighborRemoved(const DhtAddress& nodeId) {
+        this->localPausedNeighbors.removeAll(nodeId);
+        this->remotePausedNeighbors.removeAll(nodeId);
+        {
+            // As in Propagation::onNeighborLeft, a draining queue stays
+            // mapped until its drain ends.
+            std::scoped_lock lock(this->mutex);
+            const auto it = this->metadataQueues.find(nodeId);
+            if (it != this->metadataQueues.end()) {
+                it->second->pending.clear();
+                if (!it->second->draining) {
+                    this->metadataQueues.erase(it);
+                }
+            }
+        }
+        const auto neighborCount = this->options.neighbors.size();
+        if (neighborCount == 0) {
+            return;
+        }
+        for (const auto& [msgChainId, paused] :
+             this->localPausedNeighbors.getAll()) {
+            if (paused.size() < neighborCount) {
+                continue;
+            }
+            const auto neighbor = this->options.neighbors.getFirst({});
+            if (neighbor.has_value()) {
+                this->resumeNeighbor(
+                    neighbor.value()->getPeerDescriptor(),
+                    msgChainId,
+                    this->getLatestMessageTimestamp(msgChainId));
+            }
+        }
+    }
+
+    [[nodiscard]] bool isNeighborPaused(
+        const DhtAddress& nodeId, const std::string& msgChainId) const {
+        return this->localPausedNeighbors.isPaused(nodeId, msgChainId) ||
+            this->remotePausedNeighbors.isPaused(nodeId, msgChainId);
+    }
+
+    [[nodiscard]] size_t getLocalPausedNeighborCount(
+        const std::string& msgChainId) const {
+        return this->localPausedNeighbors.size(msgChainId);
+    }
+
+    // MessageIDs queued (not yet sent) to the neighbor.
+    [[nodiscard]] size_t getMetadataQueueDepth(const DhtAddress& nodeId) {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->metadataQueues.find(nodeId);
+        return it == this->metadataQueues.end() ? 0
+                                                : it->second->pending.size();
+    }
+
+    // MessageIDs dropped from full metadata queues since construction.
+    [[nodiscard]] uint64_t getDroppedMetadataCount() {
+        std::scoped_lock lock(this->mutex);
+        return this->droppedMetadata;
+    }
+
+    int64_t getLatestMessageTimestamp(const std::string& msgChainId) {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->latestMessages.find(msgChainId);
+        if (it == this->latestMessages.end() || it->second.empty()) {
+            return 0;
+        }
+        return it->second.back()->getMessage().messageid().timestamp();
+    }
+
+private:
+    // Metadata newer than the buffered data means the eager path has a
+    // hole: after the second such timestamp the metadata sender is
+    // resumed and replays from what this node last received.
+    void onMetadata(const MessageID& msg, const PeerDescriptor& previousNode) {
+        const auto& msgChainId = msg.messagechainid();
+        const auto latestTimestamp = this->getLatestMessageTimestamp(msgChainId);
+        if (latestTimestamp >= msg.timestamp()) {
+            return;
+        }
+        size_t aheadCount = 0;
+        {
+            std::scoped_lock lock(this->mutex);
+            auto& ahead = this->metadataTimestampsAheadOfRealData[msgChainId];
+            ahead.insert(msg.timestamp());
+            aheadCount = ahead.size();
+        }
+        if (aheadCount > 1) {
+            this->resumeNeighbor(previousNode, msgChainId, latestTimestamp);
+        }
+    }
+
+    void sendBuffer(
+        int64_t fromTimestamp,
+        const std::string& msgChainId,
+        const PeerDescriptor& neighbor) {
+        std::vector<SharedStreamMessage> messages;
+        {
+            std::scoped_lock lock(this->mutex);
+            const auto it = this->latestMessages.find(msgChainId);
+            if (it == this->latestMessages.end()) {
+                return;
+            }
+            std::ranges::copy_if(
+                it->second,
+                std::back_inserter(messages),
+                [fromTimestamp](const SharedStreamMessage& message) {
+                    return message->getMessage().messageid().timestamp() >
+                        fromTimestamp;
+                });
+        }
+        if (messages.empty()) {
+            return;
+        }
+        this->options.queueReplay(
+            Identifiers::getNodeIdFromPeerDescriptor(neighbor), messages);
+    }
+
+    // Queues the MessageID behind the earlier ones to the same neighbor
+    // and starts a drain coroutine if none is running.
+    void queueMetadata(
+        const DhtAddress& nodeId,
+        const PeerDescriptor& peer,
+        const MessageID& messageId) {
+        std::shared_ptr<MetadataQueue> queue;
+        {
+            std::scoped_lock lock(this->mutex);
+            auto& slot = this->metadataQueues[nodeId];
+            if (!slot) {
+                slot = std::make_shared<MetadataQueue>();
+                slot->remote = this->createRemote(peer);
+            }
+            if (slot->pending.size() >=
+                std::max<size_t>(this->options.metadataQueueHighWaterMark, 1)) {
+                slot->pending.pop_front();
+                this->droppedMetadata++;
+            }
+            slot->pending.push_back(messageId);
+            if (slot->draining) {
+                return;
+            }
+            slot->draining = true;
+            queue = slot;
+        }
+        this->schedule(
+            [this, queue = std::move(queue), nodeId]()
+                -> folly::coro::Task<void> {
+                co_await this->drainMetadataQueue(queue, nodeId);
+            });
+    }
+
+    folly::coro::Task<void> drainMetadataQueue(
+        std::shared_ptr<MetadataQueue> queue, DhtAddress nodeId) {
+        while (true) {
+            MessageID messageId;
+            {
+                std::scoped_lock lock(this->mutex);
+                if (queue->pending.empty()) {
+                    // The queue stays mapped while it drains (see
+                    // onNeighborRemoved), so it is always this one.
+                    queue->draining = false;
+                    this->metadataQueues.erase(nodeId);
+                    co_return;
+                }
+                messageId = std::move(queue->pending.front());
+                queue->pending.pop_front();
+            }
+            // Never throws: failures are logged by the remote.
+            co_await queue->remote->sendMetadata(std::move(messageId));
+        }
+    }
+
+    std::shared_ptr<PlumtreeRpcRemote> createRemote(
+        const PeerDescriptor& peer) {
+        PlumtreeRpcClient client{this->options.rpcCommunicator};
+        return std::make_shared<PlumtreeRpcRemote>(
+            this->options.localPeerDescriptor,
+            peer,
+            client,
+            this->options.rpcRequestTimeout);
+    }
+
+    // The lambda owns everything the send needs (remotes are
+    // shared_ptrs); the pause and metadata tasks also capture `this`,
+    // which the scope outlives via stop() in the destructor.
+    template <typename Fn>
+    void schedule(Fn fn) {
+        this->scope.add(
+            streamr::utils::co_withExecutor(
+                &streamr::utils::SharedExecutors::worker(),
+                folly::coro::co_invoke(std::move(fn))));
+    }
+};
+
+} // namespace streamr::trackerlessnetwork::plumtree
@@ -0,0 +1,90 @@
+// Module streamr.trackerlessnetwork.PlumtreeRpcLocal
+// Ported from packages/trackerless-network/src/content-delivery-layer/
+// plumtree/PlumtreeRpcLocal.ts (v103.8.0-rc.3): the server side of the
+// Plumtree exchange. A neighbor asking to be paused is recorded in the
+// remote paused set (from then on it only gets MessageID metadata for
+// that chain); a resume clears the entry and replays the buffered
+// messages newer than the neighbor's last timestamp.
+//
+// Adaptation: a pause request from a non-neighbor, or one over the
+// remote pause limit, is answered with accepted=false (TS accepts it
+// silently and then ignores it), so the requester does not count it
+// against its pause budget.
+module;
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+
+export module streamr.trackerlessnetwork.PlumtreeRpcLocal;
+
+import streamr.trackerlessnetwork.protos;
+
+import streamr.trackerlessnetwork.NetworkRpcServer;
+import streamr.trackerlessnetwork.NodeList;
+import streamr.trackerlessnetwork.PausedNeighbors;
+import streamr.dht.DhtCallContext;
+import streamr.dht.Identifiers;
+import streamr.dht.protos;
+
+// Hoisted (file scope, NOT exported); fully qualified because relative
+// namespace names resolve differently at file scope than inside the
+// package namespace.
+using streamr::dht::DhtAddress;
+using streamr::dht::Identifiers;
+using streamr::dht::rpcprotocol::DhtCallContext;
+
+export namespace streamr::trackerlessnetwork::plumtree {
+
+using ::dht::PeerDescriptor;
+using PlumtreeRpc = ::streamr::protorpc::PlumtreeRpc<DhtCallContext>;
+
+struct PlumtreeRpcLocalOptions {
+    NodeList& neighbors;
+    PausedNeighbors& remotePausedNeighbors;
+    std::function<void(const MessageID&, const PeerDescriptor&)> onMetadata;
+    std::function<void(int64_t, const std::string&, const PeerDescriptor&)>
+        sendBuffer;
+};
+
+class PlumtreeRpcLocal : public PlumtreeRpc {
+private:
+    PlumtreeRpcLocalOptions options;
+
+public:
+    explicit PlumtreeRpcLocal(PlumtreeRpcLocalOptions options)
+        : options(std::move(options)) {}
+
+    PauseNeighborResponse pauseNeighbor(
+        const PauseNeighborRequest& request,
+        const DhtCallContext& context) override {
+        const auto sender = Identifiers::getNodeIdFromPeerDescriptor(
+            context.incomingSourceDescriptor.value());
+        PauseNeighborResponse response;
+        response.set_accepted(
+            this->options.neighbors.has(sender) &&
+            this->options.remotePausedNeighbors.add(
+                sender, request.messagechainid()));
+        return response;
+    }
+
+    void resumeNeighbor(
+        const ResumeNeighborRequest& request,
+        const DhtCallContext& context) override {
+        const auto& sender = context.incomingSourceDescriptor.value();
+        this->options.remotePausedNeighbors.remove(
+            Identifiers::getNodeIdFromPeerDescriptor(sender),
+            request.messagechainid());
+        this->options.sendBuffer(
+            request.fromtimestamp(), request.messagechainid(), sender);
+    }
+
+    void sendMetadata(
+        const MessageID& message, const DhtCallContext& context) override {
+        this->options.onMetadata(
+            message, context.incomingSourceDescriptor.value());
+    }
+};
+
+} // namespace streamr::trackerlessnetwork::plumtree
@@ -0,0 +1,102 @@
+// Module streamr.trackerlessnetwork.PlumtreeRpcRemote
+// Ported from packages/trackerless-network/src/content-delivery-layer/
+// plumtree/PlumtreeRpcRemote.ts (v103.8.0-rc.3): the client side of the
+// Plumtree pause/resume/metadata exchange. A failed or unanswered
+// pauseNeighbor counts as not accepted (a peer without the service is
+// simply never paused); the two notifications swallow errors.
+module;
+
+// Coroutine definitions need std::coroutine_traits declared in THIS
+// translation unit; it cannot arrive through an imported BMI.
+#include <coroutine> // IWYU pragma: keep
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+export module streamr.trackerlessnetwork.PlumtreeRpcRemote;
+
+import streamr.trackerlessnetwork.protos;
+
+import streamr.utils.CoroutineHelper;
+import streamr.trackerlessnetwork.NetworkRpcClient;
+import streamr.dht.DhtCallContext;
+import streamr.dht.Identifiers;
+import streamr.dht.RpcRemote;
+import streamr.dht.protos;
+import streamr.logger.SLogger;
+
+// Hoisted (file scope, NOT exported); fully qualified because relative
+// namespace names resolve differently at file scope than inside the
+// package namespace.
+using streamr::dht::Identifiers;
+using streamr::dht::contact::RpcRemote;
+using streamr::dht::rpcprotocol::DhtCallContext;
+using streamr::logger::SLogger;
+
+export namespace streamr::trackerlessnetwork::plumtree {
+
+using ::dht::PeerDescriptor;
+using PlumtreeRpcClient = streamr::protorpc::PlumtreeRpcClient<DhtCallContext>;
+
+class PlumtreeRpcRemote : public RpcRemote<PlumtreeRpcClient> {
+public:
+    PlumtreeRpcRemote(
+        PeerDescriptor localPeerDescriptor, // NOLINT
+        PeerDescriptor remotePeerDescriptor,
+        PlumtreeRpcClient client,
+        std::optional<std::chrono::milliseconds> timeout = std::nullopt)
+        : RpcRemote<PlumtreeRpcClient>(
+              std::move(localPeerDescriptor),
+              std::move(remotePeerDescriptor),
+              client,
+              timeout) {}
+
+    folly::coro::Task<bool> pauseNeighbor(std::string messageChainId) {
+        PauseNeighborRequest request;
+        request.set_messagechainid(std::move(messageChainId));
+        auto options = this->formDhtRpcOptions({});
+        try {
+            const auto response = co_await this->getClient().pauseNeighbor(
+                std::move(request), std::move(options));
+            co_return response.accepted();
+        } catch (const std::exception& err) {
+            SLogger::debug(
+                "pauseNeighbor to " +
+                Identifiers::getNodeIdFromPeerDescriptor(
+                    this->getPeerDescriptor()) +
+                " failed: " + std::string(err.what()));
+            co_return false;
+        }
+    }
+
+    folly::coro::Task<void> resumeNeighbor(
+        std::string messageChainId, int64_t fromTimestamp) {
+        ResumeNeighborRequest request;
+        request.set_messagechainid(std::move(messageChainId));
+        request.set_fromtimestamp(fromTimestamp);
+        auto options = this->formDhtRpcOptions({});
+        try {
+            co_await this->getClient().resumeNeighbor(
+                std::move(request), std::move(options));
+        } catch (const std::exception& err) {
+            SLogger::trace(
+                "Failed to send resumeNeighbor: " + std::string(err.what()));
+        }
+    }
+
+    folly::coro::Task<void> sendMetadata(MessageID messageId) {
+        auto options = this->formDhtRpcOptions({});
+        try {
+            co_await this->getClient().sendMetadata(
+                std::move(messageId), std::move(options));
+        } catch (const std::exception& err) {
+            SLogger::trace(
+                "Failed to send metadata: " + std::string(err.what()));
+        }
+    }
+};
+
+} // namespace streamr::trackerlessnetwork::plumtree
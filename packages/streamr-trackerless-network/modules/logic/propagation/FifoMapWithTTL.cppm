@@ -128,8 +128,9 @@ public:
         if (it == this->items.end()) {
             return;
         }
-        this->items.erase(it);
+        // the token must be read before erase() invalidates it
         this->dropQueue.remove(it->second.dropQueueToken);
+        this->items.erase(it);
         this->onItemDropped(key);
     }
 
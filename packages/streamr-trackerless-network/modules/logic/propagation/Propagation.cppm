@@ -9,13 +9,34 @@
 // propagation stalled (the 64-node Propagation test timeout). Sends are
 // now Task-returning and run as bounded tasks on a GuardedAsyncScope;
 // synchronous callers that need the outcome await collectResults().
+//
+// Serialize-once fan-out: tasks carry a SharedStreamMessage, so a message
+// is packed once and every target (including retries to neighbors that
+// join later) sends the same encoded bytes.
+//
+// Per-neighbor send queues: each target has one bounded FIFO drained by
+// a single coroutine, instead of one detached coroutine per (message,
+// neighbor). A slow neighbor now holds at most sendQueueHighWaterMark
+// queued sends; beyond that the overflow policy drops sends and counts
+// them.
+//
+// Micro-batching (opt-in, native-only): with PropagationOptions::batching
+// the drain coroutine of a neighbor that accepts StreamMessage batches
+// hands everything queued, up to a message and byte limit, to
+// sendBatchToNeighbor in one call. Like Nagle's algorithm it only waits
+// when there is a backlog: a lone queued message is sent at once, and a
+// backlog short of a full batch waits up to a short window for more.
 module;
 
 #include <coroutine> // IWYU pragma: keep
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -34,6 +55,7 @@ import streamr.utils.SharedExecutors;
 import streamr.dht.Identifiers;
 import streamr.dht.protos;
 import streamr.trackerlessnetwork.PropagationTaskStore;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified because relative namespace names resolve
@@ -45,19 +67,50 @@ export namespace streamr::trackerlessnetwork::propagation {
 
 using ::dht::PeerDescriptor;
 using SendToNeighborFn = std::function<folly::coro::Task<void>(
-    const DhtAddress&, const StreamMessage&)>;
+    const DhtAddress&, const SharedStreamMessage&)>;
+using SendBatchToNeighborFn = std::function<folly::coro::Task<void>(
+    const DhtAddress&, std::vector<SharedStreamMessage>)>;
+
+inline constexpr size_t DEFAULT_MAX_BATCH_MESSAGES = 64; // NOLINT
+inline constexpr size_t DEFAULT_MAX_BATCH_BYTES = 16 * 1024; // NOLINT
+inline constexpr std::chrono::milliseconds DEFAULT_BATCH_WINDOW{2};
+
+struct PropagationBatchingOptions {
+    SendBatchToNeighborFn sendBatchToNeighbor;
+    // Neighbors it returns false for get single sends (and no window).
+    std::function<bool(const DhtAddress&)> acceptsBatches;
+    size_t maxBatchMessages = DEFAULT_MAX_BATCH_MESSAGES;
+    // Serialized message bytes; a batch is flushed once it reaches this.
+    size_t maxBatchBytes = DEFAULT_MAX_BATCH_BYTES;
+    // How long a backlog short of a full batch waits for more sends.
+    std::chrono::milliseconds window = DEFAULT_BATCH_WINDOW;
+};
+
+// What a full per-neighbor send queue does with one more send.
+enum class SendQueueOverflowPolicy : uint8_t {
+    // Drop the oldest queued send: a lagging neighbor gets the freshest
+    // messages (the dropped ones are retried if it joins again).
+    DropOldest,
+    // Drop the incoming send.
+    DropNewest
+};
 
 struct PropagationOptions {
     SendToNeighborFn sendToNeighbor;
     size_t minPropagationTargets;
     std::optional<std::chrono::milliseconds> ttl;
     std::optional<size_t> maxMessages;
+    std::optional<size_t> sendQueueHighWaterMark;
+    SendQueueOverflowPolicy sendQueueOverflowPolicy =
+        SendQueueOverflowPolicy::DropOldest;
+    std::optional<PropagationBatchingOptions> batching;
 };
 
 inline constexpr size_t DEFAULT_MAX_MESSAGES = 150; // NOLINT
 // NOLINTNEXTLINE
 inline constexpr std::chrono::milliseconds DEFAULT_TTL =
     std::chrono::seconds(10);
+inline constexpr size_t DEFAULT_SEND_QUEUE_HIGH_WATER_MARK = 256; // NOLINT
 
 /**
  * Message propagation logic of a node. Given a message, this class will
@@ -71,13 +124,39 @@ inline constexpr std::chrono::milliseconds DEFAULT_TTL =
 
 class Propagation {
 private:
+    // Sends to one neighbor, in order. `draining` is set while a drain
+    // coroutine owns the queue; there is at most one per neighbor.
+    struct SendQueue {
+        std::deque<std::shared_ptr<PropagationTask>> pending;
+        size_t pendingBytes = 0;
+        bool draining = false;
+
+        void push(std::shared_ptr<PropagationTask> task) {
+            this->pendingBytes += messageSize(*task);
+            this->pending.push_back(std::move(task));
+        }
+
+        std::shared_ptr<PropagationTask> pop() {
+            auto task = std::move(this->pending.front());
+            this->pending.pop_front();
+            this->pendingBytes -= messageSize(*task);
+            return task;
+        }
+    };
+
     SendToNeighborFn sendToNeighbor;
     size_t minPropagationTargets;
+    size_t sendQueueHighWaterMark;
+    SendQueueOverflowPolicy sendQueueOverflowPolicy;
+    std::optional<PropagationBatchingOptions> batching;
     PropagationTaskStore activeTaskStore;
-    // Serializes handledNeighbors bookkeeping (sends themselves run
-    // concurrently and are bounded by the RPC timeouts inside
-    // sendToNeighbor).
-    std::mutex mutex;
+    // Serializes handledNeighbors bookkeeping and the send queues (sends
+    // to different neighbors run concurrently and are bounded by the RPC
+    // timeouts inside sendToNeighbor).
+    mutable std::mutex mutex;
+    std::map<DhtAddress, std::shared_ptr<SendQueue>> sendQueues;
+    size_t queuedSends = 0;
+    uint64_t droppedSends = 0;
     GuardedAsyncScope scope;
 
 public:
@@ -87,6 +166,12 @@ public:
               options.maxMessages.value_or(DEFAULT_MAX_MESSAGES)) {
         this->sendToNeighbor = options.sendToNeighbor;
         this->minPropagationTargets = options.minPropagationTargets;
+        this->sendQueueHighWaterMark = std::max<size_t>(
+            options.sendQueueHighWaterMark.value_or(
+                DEFAULT_SEND_QUEUE_HIGH_WATER_MARK),
+            1);
+        this->sendQueueOverflowPolicy = options.sendQueueOverflowPolicy;
+        this->batching = options.batching;
     }
 
     ~Propagation() { this->stop(); }
@@ -99,19 +184,45 @@ public:
      * often an RPC delivery handler, must not block on them).
      */
     void feedUnseenMessage(
-        const StreamMessage& message,
+        const SharedStreamMessage& message,
         const std::vector<DhtAddress>& targets,
         const std::optional<DhtAddress>& source) {
         auto task = std::make_shared<PropagationTask>(PropagationTask{
             .message = message,
             .source = source,
             .handledNeighbors = std::set<DhtAddress>()});
-        this->activeTaskStore.add(*task);
+        this->activeTaskStore.add(task);
         for (const auto& neighborId : targets) {
             this->scheduleSend(task, neighborId);
         }
     }
 
+    void feedUnseenMessage(
+        const StreamMessage& message,
+        const std::vector<DhtAddress>& targets,
+        const std::optional<DhtAddress>& source) {
+        this->feedUnseenMessage(
+            serializeStreamMessage(message), targets, source);
+    }
+
+    /**
+     * Queues messages for one neighbor only (a Plumtree buffer replay),
+     * in order, behind the sends already queued to it. They share the
+     * neighbor's bounded queue but are not kept for retries.
+     */
+    void feedMessagesToNeighbor(
+        const DhtAddress& neighborId,
+        const std::vector<SharedStreamMessage>& messages) {
+        for (const auto& message : messages) {
+            this->scheduleSend(
+                std::make_shared<PropagationTask>(PropagationTask{
+                    .message = message,
+                    .source = std::nullopt,
+                    .handledNeighbors = std::set<DhtAddress>()}),
+                neighborId);
+        }
+    }
+
     /**
      * Awaitable variant for callers that need the per-target outcome
      * (the proxy-client shared-library API): resolves once every send
@@ -124,10 +235,10 @@ public:
         std::vector<DhtAddress> targets,
         std::optional<DhtAddress> source) {
         auto task = std::make_shared<PropagationTask>(PropagationTask{
-            .message = std::move(message),
+            .message = serializeStreamMessage(std::move(message)),
             .source = std::move(source),
             .handledNeighbors = std::set<DhtAddress>()});
-        this->activeTaskStore.add(*task);
+        this->activeTaskStore.add(task);
         std::vector<folly::coro::Task<bool>> sends;
         sends.reserve(targets.size());
         for (const auto& neighborId : targets) {
@@ -153,27 +264,175 @@ public:
      * assignment.
      */
     void onNeighborJoined(const DhtAddress& neighborId) {
-        // store.get() returns snapshots; each retry marks its own copy
-        // (mirrors the pre-existing TS-comment semantics).
-        for (const auto& task : this->activeTaskStore.get()) {
-            this->scheduleSend(
-                std::make_shared<PropagationTask>(task), neighborId);
+        // The store hands out the live tasks (TS parity): a retry marks
+        // the same handledNeighbors as the original sends.
+        for (auto& task : this->activeTaskStore.get()) {
+            this->scheduleSend(std::move(task), neighborId);
         }
     }
 
+    /**
+     * Discards the sends still queued for a neighbor that has left. A
+     * send already in flight completes (or times out) on its own. The
+     * queue of a running drain stays in place until that drain ends, so
+     * if the neighbor joins again meanwhile its new sends queue up
+     * behind the in-flight one instead of starting a second drain.
+     */
+    void onNeighborLeft(const DhtAddress& neighborId) {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->sendQueues.find(neighborId);
+        if (it == this->sendQueues.end()) {
+            return;
+        }
+        this->queuedSends -= it->second->pending.size();
+        it->second->pending.clear();
+        it->second->pendingBytes = 0;
+        if (!it->second->draining) {
+            this->sendQueues.erase(it);
+        }
+    }
+
+    // Sends queued (not yet started) to the neighbor.
+    [[nodiscard]] size_t getSendQueueDepth(const DhtAddress& neighborId) const {
+        std::scoped_lock lock(this->mutex);
+        const auto it = this->sendQueues.find(neighborId);
+        return it == this->sendQueues.end() ? 0 : it->second->pending.size();
+    }
+
+    // Sends queued to all neighbors.
+    [[nodiscard]] size_t getSendQueueDepth() const {
+        std::scoped_lock lock(this->mutex);
+        return this->queuedSends;
+    }
+
+    // Sends dropped by the overflow policy since construction.
+    [[nodiscard]] uint64_t getDroppedSendCount() const {
+        std::scoped_lock lock(this->mutex);
+        return this->droppedSends;
+    }
+
 private:
+    // Queues the send behind earlier sends to the same neighbor and
+    // starts a drain coroutine if none is running. The same task queued
+    // twice (a retry racing the original send) is coalesced.
     void scheduleSend(
         std::shared_ptr<PropagationTask> task, DhtAddress neighborId) {
+        std::shared_ptr<SendQueue> queue;
+        {
+            std::scoped_lock lock(this->mutex);
+            if (task->handledNeighbors.contains(neighborId) ||
+                neighborId == task->source) {
+                return;
+            }
+            auto& slot = this->sendQueues[neighborId];
+            if (!slot) {
+                slot = std::make_shared<SendQueue>();
+            }
+            if (std::ranges::find(slot->pending, task) !=
+                slot->pending.end()) {
+                return;
+            }
+            if (slot->pending.size() >= this->sendQueueHighWaterMark) {
+                this->droppedSends++;
+                if (this->sendQueueOverflowPolicy ==
+                    SendQueueOverflowPolicy::DropNewest) {
+                    return;
+                }
+                slot->pop();
+                this->queuedSends--;
+            }
+            slot->push(std::move(task));
+            this->queuedSends++;
+            if (slot->draining) {
+                return;
+            }
+            slot->draining = true;
+            queue = slot;
+        }
         this->scope.add(
             streamr::utils::co_withExecutor(
                 &streamr::utils::SharedExecutors::worker(),
-                folly::coro::co_invoke(
-                    [this,
-                     task = std::move(task),
-                     neighborId =
-                         std::move(neighborId)]() -> folly::coro::Task<void> {
-                        co_await this->sendAndAwaitThenMark(task, neighborId);
-                    })));
+                this->drainSendQueue(std::move(queue), std::move(neighborId))));
+    }
+
+    folly::coro::Task<void> drainSendQueue(
+        std::shared_ptr<SendQueue> queue, DhtAddress neighborId) {
+        while (true) {
+            // Checked per round: the neighbor may have left and joined
+            // again with another handshake.
+            const bool batching = this->batching.has_value() &&
+                this->batching->acceptsBatches(neighborId);
+            if (batching && this->hasPartialBacklog(*queue)) {
+                co_await folly::coro::sleep(this->batching->window);
+            }
+            std::vector<std::shared_ptr<PropagationTask>> tasks;
+            {
+                std::scoped_lock lock(this->mutex);
+                if (queue->pending.empty()) {
+                    // The queue stays mapped while it drains (see
+                    // onNeighborLeft), so it is always this one.
+                    queue->draining = false;
+                    this->sendQueues.erase(neighborId);
+                    co_return;
+                }
+                size_t bytes = 0;
+                do {
+                    bytes += messageSize(*queue->pending.front());
+                    tasks.push_back(queue->pop());
+                    this->queuedSends--;
+                } while (batching && !queue->pending.empty() &&
+                         tasks.size() < this->batching->maxBatchMessages &&
+                         bytes < this->batching->maxBatchBytes);
+            }
+            if (tasks.size() == 1) {
+                co_await this->sendAndAwaitThenMark(tasks[0], neighborId);
+            } else {
+                co_await this->sendBatchAndMark(
+                    std::move(tasks), neighborId);
+            }
+        }
+    }
+
+    // More than one send queued, but less than a full batch.
+    bool hasPartialBacklog(const SendQueue& queue) const {
+        std::scoped_lock lock(this->mutex);
+        return queue.pending.size() > 1 &&
+            queue.pending.size() < this->batching->maxBatchMessages &&
+            queue.pendingBytes < this->batching->maxBatchBytes;
+    }
+
+    static size_t messageSize(const PropagationTask& task) {
+        return task.message->getBody().value().size();
+    }
+
+    folly::coro::Task<void> sendBatchAndMark(
+        std::vector<std::shared_ptr<PropagationTask>> tasks,
+        DhtAddress neighborId) {
+        std::vector<SharedStreamMessage> messages;
+        {
+            std::scoped_lock lock(this->mutex);
+            std::erase_if(tasks, [&neighborId](const auto& task) {
+                return task->handledNeighbors.contains(neighborId) ||
+                    neighborId == task->source;
+            });
+        }
+        if (tasks.empty()) {
+            co_return;
+        }
+        messages.reserve(tasks.size());
+        for (const auto& task : tasks) {
+            messages.push_back(task->message);
+        }
+        try {
+            co_await this->batching->sendBatchToNeighbor(
+                neighborId, std::move(messages));
+        } catch (...) {
+            co_return;
+        }
+        std::scoped_lock lock(this->mutex);
+        for (const auto& task : tasks) {
+            this->markHandled(*task, neighborId);
+        }
     }
 
     folly::coro::Task<bool> sendAndAwaitThenMark(
@@ -197,15 +456,18 @@ private:
         // logic as is (mirrors the TS comment).
         {
             std::scoped_lock lock(this->mutex);
-            task->handledNeighbors.insert(neighborId);
-            if (task->handledNeighbors.size() >= this->minPropagationTargets) {
-                this->activeTaskStore.remove(
-                    PropagationTaskStore::messageIdToMessageRef(
-                        task->message.messageid()));
-            }
+            this->markHandled(*task, neighborId);
         }
         co_return true;
     }
+
+    // Caller holds mutex.
+    void markHandled(PropagationTask& task, const DhtAddress& neighborId) {
+        task.handledNeighbors.insert(neighborId);
+        if (task.handledNeighbors.size() >= this->minPropagationTargets) {
+            this->activeTaskStore.remove(task.message->getMessage().messageid());
+        }
+    }
 };
 
 } // namespace streamr::trackerlessnetwork::propagation
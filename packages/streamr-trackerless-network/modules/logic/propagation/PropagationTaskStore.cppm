@@ -2,21 +2,34 @@
 // CONSOLIDATED from the former header
 // logic/propagation/PropagationTaskStore.hpp (MODERNIZATION.md Phase 2.6): this
 // file is now the source of truth.
+//
+// Adaptations: TS backs the store with FifoMapWithTTL. Here it is a
+// fixed-capacity ring buffer in insertion order plus a hash index from
+// message ref to ring position, behind one per-store mutex (the
+// FifoMapWithTTL port took two recursive mutexes per call and a
+// process-global one per insert). Tasks are stored as shared_ptrs, so
+// get() hands out the live tasks instead of deep copies — as TS does,
+// where values() returns the stored task objects.
 module;
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
+#include <folly/container/F14Map.h>
 
 export module streamr.trackerlessnetwork.PropagationTaskStore;
 
 import streamr.trackerlessnetwork.protos;
 
 import streamr.dht.Identifiers;
-import streamr.trackerlessnetwork.FifoMapWithTTL;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
 
 // Hoisted from the former header (file scope, NOT exported);
 // fully qualified because relative namespace names resolve
@@ -25,32 +38,124 @@ using streamr::dht::DhtAddress;
 export namespace streamr::trackerlessnetwork::propagation {
 
 struct PropagationTask {
-    StreamMessage message;
+    // Shared by the task copies and every send: encoded once.
+    SharedStreamMessage message;
     std::optional<std::string> source;
     std::set<DhtAddress> handledNeighbors;
 };
 
+/**
+ * The messages Propagation still tries to deliver to neighbors that join
+ * later. Holds at most maxTasks tasks, each for at most ttl; adding to a
+ * full store drops the oldest task.
+ *
+ * Removing a task leaves a hole in the ring; the ring has room for twice
+ * maxTasks entries and is compacted when the holes fill it, so add() and
+ * remove() are amortized O(1).
+ *
+ * Thread-safe. The tasks themselves are not guarded by the store: their
+ * owner (Propagation) serializes access to handledNeighbors.
+ */
 class PropagationTaskStore {
 private:
-    FifoMapWithTTL<MessageRef, PropagationTask> tasks;
+    // MessageRef fields of the task's MessageID (TS parity: the key
+    // does not include the publisher or the message chain).
+    struct Key {
+        int64_t timestamp;
+        int32_t sequenceNumber;
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            return static_cast<size_t>(
+                static_cast<uint64_t>(key.timestamp) ^
+                (static_cast<uint64_t>(
+                     static_cast<uint32_t>(key.sequenceNumber)) *
+                 0x9E3779B97F4A7C15ULL)); // NOLINT(readability-magic-numbers)
+        }
+    };
+
+    struct Slot {
+        std::shared_ptr<PropagationTask> task; // null = removed
+        Key key{};
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    std::chrono::milliseconds ttl;
+    size_t maxTasks;
+    std::vector<Slot> ring;
+    // Positions grow monotonically; a position's slot is
+    // ring[position % ring.size()]. [head, tail) is the occupied range.
+    uint64_t head = 0;
+    uint64_t tail = 0;
+    folly::F14FastMap<Key, uint64_t, KeyHash> index;
+    mutable std::mutex mutex;
 
 public:
     PropagationTaskStore(std::chrono::milliseconds ttl, size_t maxTasks)
-        : tasks(
-              FifoMapWithTtlOptions<MessageRef>{
-                  .ttl = ttl,
-                  .maxSize = maxTasks,
-              }) {}
+        : ttl(ttl), maxTasks(maxTasks), ring(2 * maxTasks) {
+        this->index.reserve(maxTasks);
+    }
 
-    std::vector<PropagationTask> get() { return this->tasks.values(); }
+    // The live, unexpired tasks, oldest first.
+    std::vector<std::shared_ptr<PropagationTask>> get(
+        std::chrono::steady_clock::time_point now =
+            std::chrono::steady_clock::now()) {
+        std::scoped_lock lock(this->mutex);
+        this->expire(now);
+        std::vector<std::shared_ptr<PropagationTask>> tasks;
+        tasks.reserve(this->index.size());
+        for (auto position = this->head; position < this->tail; ++position) {
+            const auto& slot = this->slotAt(position);
+            if (slot.task) {
+                tasks.push_back(slot.task);
+            }
+        }
+        return tasks;
+    }
 
-    void add(const PropagationTask& task) {
-        const auto messageId = task.message.messageid();
-        MessageRef messageRef;
-        this->tasks.set(messageIdToMessageRef(messageId), task);
+    // Replaces an existing task for the same message.
+    void add(
+        std::shared_ptr<PropagationTask> task,
+        std::chrono::steady_clock::time_point now =
+            std::chrono::steady_clock::now()) {
+        if (this->maxTasks == 0) {
+            return;
+        }
+        const auto key = toKey(task->message->getMessage().messageid());
+        std::scoped_lock lock(this->mutex);
+        this->removeLocked(key);
+        this->expire(now);
+        if (this->index.size() == this->maxTasks) {
+            this->dropOldest();
+        }
+        if (this->tail - this->head == this->ring.size()) {
+            this->compact();
+        }
+        this->slotAt(this->tail) = Slot{
+            .task = std::move(task), .key = key, .expiresAt = now + this->ttl};
+        this->index.emplace(key, this->tail);
+        this->tail++;
     }
 
-    void remove(const MessageRef& messageId) { this->tasks.remove(messageId); }
+    void remove(const MessageID& messageId) {
+        std::scoped_lock lock(this->mutex);
+        this->removeLocked(toKey(messageId));
+    }
+
+    void remove(const MessageRef& messageRef) {
+        std::scoped_lock lock(this->mutex);
+        this->removeLocked(
+            Key{.timestamp = messageRef.timestamp(),
+                .sequenceNumber = messageRef.sequencenumber()});
+    }
+
+    [[nodiscard]] size_t size() const {
+        std::scoped_lock lock(this->mutex);
+        return this->index.size();
+    }
 
     static MessageRef messageIdToMessageRef(const MessageID& messageId) {
         MessageRef messageRef;
@@ -58,6 +163,72 @@ public:
         messageRef.set_timestamp(messageId.timestamp());
         return messageRef;
     }
+
+private:
+    static Key toKey(const MessageID& messageId) {
+        return Key{
+            .timestamp = messageId.timestamp(),
+            .sequenceNumber = messageId.sequencenumber()};
+    }
+
+    Slot& slotAt(uint64_t position) {
+        return this->ring[position % this->ring.size()];
+    }
+
+    void removeLocked(const Key& key) {
+        const auto it = this->index.find(key);
+        if (it == this->index.end()) {
+            return;
+        }
+        this->slotAt(it->second).task.reset();
+        this->index.erase(it);
+        this->skipHoles();
+    }
+
+    void skipHoles() {
+        while (this->head < this->tail && !this->slotAt(this->head).task) {
+            this->head++;
+        }
+    }
+
+    // Every task gets the same ttl and now only moves forward, so the
+    // expired tasks are always the oldest ones.
+    void expire(std::chrono::steady_clock::time_point now) {
+        this->skipHoles();
+        while (this->head < this->tail &&
+               this->slotAt(this->head).expiresAt <= now) {
+            this->dropOldest();
+        }
+    }
+
+    // head is never a hole (skipHoles runs after every removal).
+    void dropOldest() {
+        auto& slot = this->slotAt(this->head);
+        this->index.erase(slot.key);
+        slot.task.reset();
+        this->head++;
+        this->skipHoles();
+    }
+
+    // Called when the ring is full but holds fewer than maxTasks tasks:
+    // at least half of the range is holes, so slides the tasks towards
+    // head (order kept) and frees at least maxTasks positions.
+    void compact() {
+        auto write = this->head;
+        for (auto read = this->head; read < this->tail; ++read) {
+            auto& slot = this->slotAt(read);
+            if (!slot.task) {
+                continue;
+            }
+            if (read != write) {
+                this->slotAt(write) = std::move(slot);
+                slot.task.reset();
+                this->index[this->slotAt(write).key] = write;
+            }
+            write++;
+        }
+        this->tail = write;
+    }
 };
 
 } // namespace streamr::trackerlessnetwork::propagation
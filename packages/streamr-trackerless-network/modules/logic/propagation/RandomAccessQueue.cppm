@@ -3,6 +3,7 @@
 // (MODERNIZATION.md Phase 2.6): this file is now the source of truth.
 module;
 
+#include <atomic>
 #include <cstddef>
 #include <map>
 #include <mutex>
@@ -24,12 +25,10 @@ public:
     QueueToken& operator=(QueueToken&&) = default;
 
     static QueueToken create() {
-        // Use a "magic static"
-        // https://blog.mbedded.ninja/programming/languages/c-plus-plus/magic-statics/
-        static size_t counter = 1;
-        static std::mutex queueTokenReferenceCounterMutex;
-        std::lock_guard<std::mutex> lock{queueTokenReferenceCounterMutex};
-        return QueueToken(counter++);
+        // Process-wide and lock-free: a shared mutex here serialized
+        // every queue in the process.
+        static std::atomic<size_t> counter{1};
+        return QueueToken(counter.fetch_add(1, std::memory_order_relaxed));
     }
     [[nodiscard]] size_t getId() const { return this->id; }
 };
@@ -47,11 +47,12 @@ import streamr.utils.EthereumAddress;
 import streamr.utils.StreamPartID;
 import streamr.trackerlessnetwork.ContentDeliveryRpcLocal;
 import streamr.trackerlessnetwork.ContentDeliveryRpcRemote;
-import streamr.trackerlessnetwork.DuplicateMessageDetector;
+import streamr.trackerlessnetwork.DuplicateDetectorIndex;
 import streamr.trackerlessnetwork.NodeList;
 import streamr.trackerlessnetwork.Propagation;
 import streamr.trackerlessnetwork.ProxyConnectionRpcLocal;
 import streamr.trackerlessnetwork.ProxyConnectionRpcRemote;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
 import streamr.trackerlessnetwork.Utils;
 import streamr.trackerlessnetwork.formStreamPartDeliveryServiceId;
 
@@ -89,6 +90,7 @@ struct ProxyClientOptions {
     StreamPartID streamPartId;
     ConnectionLocker& connectionLocker;
     std::optional<size_t> minPropagationTargets;
+    DuplicateDetectorIndexOptions duplicateDetectorOptions;
 };
 
 struct ProxyDefinition {
@@ -139,7 +141,7 @@ private:
     ListeningRpcCommunicator rpcCommunicator;
     ContentDeliveryRpcLocal contentDeliveryRpcLocal;
     ProxyClientOptions options;
-    std::map<std::string, DuplicateMessageDetector> duplicateDetectors;
+    DuplicateDetectorIndex duplicateDetectors;
     std::optional<ProxyDefinition> definition;
     std::map<DhtAddress, ProxyConnection> connections;
     // TS is single-threaded; here setProxies (API thread) races
@@ -208,7 +210,8 @@ public:
                   .sendToNeighbor =
                       [this](
                           const DhtAddress& neighborId,
-                          const StreamMessage& msg) -> folly::coro::Task<void> {
+                          const SharedStreamMessage& msg)
+                      -> folly::coro::Task<void> {
                       const auto remote = this->neighbors.get(neighborId);
                       if (remote.has_value()) {
                           co_await remote.value()->sendStreamMessage(msg);
@@ -222,7 +225,8 @@ public:
                       ? options.minPropagationTargets.value()
                       : 2,
               }),
-          options(std::move(options)) {}
+          options(std::move(options)),
+          duplicateDetectors(this->options.duplicateDetectorOptions) {}
 
 private:
     void registerDefaultServerMethods() {
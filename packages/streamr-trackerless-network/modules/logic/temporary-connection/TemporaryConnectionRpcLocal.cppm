@@ -43,8 +43,6 @@ export namespace streamr::trackerlessnetwork {
 using ::dht::PeerDescriptor;
 using TemporaryConnectionRpc =
     streamr::protorpc::TemporaryConnectionRpc<DhtCallContext>;
-using ContentDeliveryRpcClient =
-    streamr::protorpc::ContentDeliveryRpcClient<DhtCallContext>;
 
 struct TemporaryConnectionRpcLocalOptions {
     PeerDescriptor localPeerDescriptor;
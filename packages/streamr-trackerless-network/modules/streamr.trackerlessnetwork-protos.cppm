@@ -34,6 +34,7 @@ export using ::ProxyConnectionRequest;
 export using ::ProxyConnectionResponse;
 export using ::ResumeNeighborRequest;
 export using ::StreamMessage;
+export using ::StreamMessageBatch;
 export using ::StreamPartHandshakeRequest;
 export using ::StreamPartHandshakeResponse;
 export using ::StreamPartitionInfo;
@@ -220,6 +220,59 @@ struct RouteMessageAckDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouteMessageAckDefaultTypeInternal _RouteMessageAck_default_instance_;
 
+inline constexpr ReplicaKeys::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        keys_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReplicaKeys::ReplicaKeys(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReplicaKeys_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReplicaKeysDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaKeysDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaKeysDefaultTypeInternal() {}
+  union {
+    ReplicaKeys _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaKeysDefaultTypeInternal _ReplicaKeys_default_instance_;
+
+inline constexpr ReplicaDigest::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        key_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        digest_{::uint64_t{0u}} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReplicaDigest::ReplicaDigest(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReplicaDigest_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReplicaDigestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaDigestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaDigestDefaultTypeInternal() {}
+  union {
+    ReplicaDigest _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaDigestDefaultTypeInternal _ReplicaDigest_default_instance_;
+
 inline constexpr RecursiveOperationRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -636,6 +689,31 @@ struct StoreDataRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StoreDataRequestDefaultTypeInternal _StoreDataRequest_default_instance_;
 
+inline constexpr ReplicaDigests::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        digests_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReplicaDigests::ReplicaDigests(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReplicaDigests_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReplicaDigestsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicaDigestsDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicaDigestsDefaultTypeInternal() {}
+  union {
+    ReplicaDigests _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicaDigestsDefaultTypeInternal _ReplicaDigests_default_instance_;
+
 inline constexpr PeerDescriptor::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -801,6 +879,31 @@ struct ReplicateDataRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicateDataRequestDefaultTypeInternal _ReplicateDataRequest_default_instance_;
 
+inline constexpr ReplicateDataBatch::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        entries_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR ReplicateDataBatch::ReplicateDataBatch(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(ReplicateDataBatch_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct ReplicateDataBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicateDataBatchDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicateDataBatchDefaultTypeInternal() {}
+  union {
+    ReplicateDataBatch _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicateDataBatchDefaultTypeInternal _ReplicateDataBatch_default_instance_;
+
 inline constexpr RecursiveOperationResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -1409,6 +1512,28 @@ const ::uint32_t
         4, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::dht::ExternalFindClosestNodesResponse, _impl_.closestnodes_),
         0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicateDataBatch, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicateDataBatch, _impl_.entries_),
+        0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaDigest, _impl_._has_bits_),
+        5, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaDigest, _impl_.key_),
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaDigest, _impl_.digest_),
+        0,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaDigests, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaDigests, _impl_.digests_),
+        0,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaKeys, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::dht::ReplicaKeys, _impl_.keys_),
+        0,
 };
 
 static const ::_pbi::MigrationSchema
@@ -1451,6 +1576,10 @@ static const ::_pbi::MigrationSchema
         {293, sizeof(::dht::ExternalFetchDataResponse)},
         {298, sizeof(::dht::ExternalFindClosestNodesRequest)},
         {303, sizeof(::dht::ExternalFindClosestNodesResponse)},
+        {308, sizeof(::dht::ReplicateDataBatch)},
+        {313, sizeof(::dht::ReplicaDigest)},
+        {320, sizeof(::dht::ReplicaDigests)},
+        {325, sizeof(::dht::ReplicaKeys)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::dht::_StoreDataRequest_default_instance_._instance,
@@ -1491,6 +1620,10 @@ static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::dht::_ExternalFetchDataResponse_default_instance_._instance,
     &::dht::_ExternalFindClosestNodesRequest_default_instance_._instance,
     &::dht::_ExternalFindClosestNodesResponse_default_instance_._instance,
+    &::dht::_ReplicateDataBatch_default_instance_._instance,
+    &::dht::_ReplicaDigest_default_instance_._instance,
+    &::dht::_ReplicaDigests_default_instance_._instance,
+    &::dht::_ReplicaKeys_default_instance_._instance,
 };
 const char descriptor_table_protodef_packages_2fdht_2fprotos_2fDhtRpc_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
@@ -1595,60 +1728,68 @@ const char descriptor_table_protodef_packages_2fdht_2fprotos_2fDhtRpc_2eproto[]
     "aEntry\"1\n\037ExternalFindClosestNodesReques"
     "t\022\016\n\006nodeId\030\001 \001(\014\"M\n ExternalFindClosest"
     "NodesResponse\022)\n\014closestNodes\030\001 \003(\0132\023.dh"
-    "t.PeerDescriptor*M\n\022RecursiveOperation\022\026"
-    "\n\022FIND_CLOSEST_NODES\020\000\022\016\n\nFETCH_DATA\020\001\022\017"
-    "\n\013DELETE_DATA\020\002*#\n\010NodeType\022\n\n\006NODEJS\020\000\022"
-    "\013\n\007BROWSER\020\001*c\n\020RpcResponseError\022\021\n\rSERV"
-    "ER_TIMOUT\020\000\022\022\n\016CLIENT_TIMEOUT\020\001\022\020\n\014SERVE"
-    "R_ERROR\020\002\022\026\n\022UNKNOWN_RPC_METHOD\020\003*\?\n\021Rou"
-    "teMessageError\022\016\n\nNO_TARGETS\020\000\022\r\n\tDUPLIC"
-    "ATE\020\001\022\013\n\007STOPPED\020\002*p\n\016HandshakeError\022\030\n\024"
-    "DUPLICATE_CONNECTION\020\000\022\"\n\036INVALID_TARGET"
-    "_PEER_DESCRIPTOR\020\001\022 \n\034UNSUPPORTED_PROTOC"
-    "OL_VERSION\020\002*)\n\016DisconnectMode\022\n\n\006NORMAL"
-    "\020\000\022\013\n\007LEAVING\020\0012\216\002\n\nDhtNodeRpc\022F\n\017getClo"
-    "sestPeers\022\030.dht.ClosestPeersRequest\032\031.dh"
-    "t.ClosestPeersResponse\022R\n\023getClosestRing"
-    "Peers\022\034.dht.ClosestRingPeersRequest\032\035.dh"
-    "t.ClosestRingPeersResponse\022+\n\004ping\022\020.dht"
-    ".PingRequest\032\021.dht.PingResponse\0227\n\013leave"
-    "Notice\022\020.dht.LeaveNotice\032\026.google.protob"
-    "uf.Empty2\215\001\n\tRouterRpc\022>\n\014routeMessage\022\030"
-    ".dht.RouteMessageWrapper\032\024.dht.RouteMess"
-    "ageAck\022@\n\016forwardMessage\022\030.dht.RouteMess"
-    "ageWrapper\032\024.dht.RouteMessageAck2W\n\025Recu"
-    "rsiveOperationRpc\022>\n\014routeRequest\022\030.dht."
-    "RouteMessageWrapper\032\024.dht.RouteMessageAc"
-    "k2\212\001\n\010StoreRpc\022:\n\tstoreData\022\025.dht.StoreD"
-    "ataRequest\032\026.dht.StoreDataResponse\022B\n\rre"
-    "plicateData\022\031.dht.ReplicateDataRequest\032\026"
-    ".google.protobuf.Empty2g\n\034RecursiveOpera"
-    "tionSessionRpc\022G\n\014sendResponse\022\037.dht.Rec"
-    "ursiveOperationResponse\032\026.google.protobu"
-    "f.Empty2k\n\033WebsocketClientConnectorRpc\022L"
-    "\n\021requestConnection\022\037.dht.WebsocketConne"
-    "ctionRequest\032\026.google.protobuf.Empty2\202\002\n"
-    "\022WebrtcConnectorRpc\022I\n\021requestConnection"
-    "\022\034.dht.WebrtcConnectionRequest\032\026.google."
-    "protobuf.Empty\0221\n\010rtcOffer\022\r.dht.RtcOffe"
-    "r\032\026.google.protobuf.Empty\0223\n\trtcAnswer\022\016"
-    ".dht.RtcAnswer\032\026.google.protobuf.Empty\0229"
-    "\n\014iceCandidate\022\021.dht.IceCandidate\032\026.goog"
-    "le.protobuf.Empty2\207\002\n\021ConnectionLockRpc\022"
-    "2\n\013lockRequest\022\020.dht.LockRequest\032\021.dht.L"
-    "ockResponse\022;\n\runlockRequest\022\022.dht.Unloc"
-    "kRequest\032\026.google.protobuf.Empty\022C\n\022grac"
-    "efulDisconnect\022\025.dht.DisconnectNotice\032\026."
-    "google.protobuf.Empty\022<\n\nsetPrivate\022\026.dh"
-    "t.SetPrivateRequest\032\026.google.protobuf.Em"
-    "pty2\241\002\n\016ExternalApiRpc\022R\n\021externalFetchD"
-    "ata\022\035.dht.ExternalFetchDataRequest\032\036.dht"
-    ".ExternalFetchDataResponse\022R\n\021externalSt"
-    "oreData\022\035.dht.ExternalStoreDataRequest\032\036"
-    ".dht.ExternalStoreDataResponse\022g\n\030extern"
-    "alFindClosestNodes\022$.dht.ExternalFindClo"
-    "sestNodesRequest\032%.dht.ExternalFindClose"
-    "stNodesResponseB\002H\002b\006proto3"
+    "t.PeerDescriptor\"5\n\022ReplicateDataBatch\022\037"
+    "\n\007entries\030\001 \003(\0132\016.dht.DataEntry\",\n\rRepli"
+    "caDigest\022\013\n\003key\030\001 \001(\014\022\016\n\006digest\030\002 \001(\006\"5\n"
+    "\016ReplicaDigests\022#\n\007digests\030\001 \003(\0132\022.dht.R"
+    "eplicaDigest\"\033\n\013ReplicaKeys\022\014\n\004keys\030\001 \003("
+    "\014*M\n\022RecursiveOperation\022\026\n\022FIND_CLOSEST_"
+    "NODES\020\000\022\016\n\nFETCH_DATA\020\001\022\017\n\013DELETE_DATA\020\002"
+    "*#\n\010NodeType\022\n\n\006NODEJS\020\000\022\013\n\007BROWSER\020\001*c\n"
+    "\020RpcResponseError\022\021\n\rSERVER_TIMOUT\020\000\022\022\n\016"
+    "CLIENT_TIMEOUT\020\001\022\020\n\014SERVER_ERROR\020\002\022\026\n\022UN"
+    "KNOWN_RPC_METHOD\020\003*\?\n\021RouteMessageError\022"
+    "\016\n\nNO_TARGETS\020\000\022\r\n\tDUPLICATE\020\001\022\013\n\007STOPPE"
+    "D\020\002*p\n\016HandshakeError\022\030\n\024DUPLICATE_CONNE"
+    "CTION\020\000\022\"\n\036INVALID_TARGET_PEER_DESCRIPTO"
+    "R\020\001\022 \n\034UNSUPPORTED_PROTOCOL_VERSION\020\002*)\n"
+    "\016DisconnectMode\022\n\n\006NORMAL\020\000\022\013\n\007LEAVING\020\001"
+    "2\216\002\n\nDhtNodeRpc\022F\n\017getClosestPeers\022\030.dht"
+    ".ClosestPeersRequest\032\031.dht.ClosestPeersR"
+    "esponse\022R\n\023getClosestRingPeers\022\034.dht.Clo"
+    "sestRingPeersRequest\032\035.dht.ClosestRingPe"
+    "ersResponse\022+\n\004ping\022\020.dht.PingRequest\032\021."
+    "dht.PingResponse\0227\n\013leaveNotice\022\020.dht.Le"
+    "aveNotice\032\026.google.protobuf.Empty2\215\001\n\tRo"
+    "uterRpc\022>\n\014routeMessage\022\030.dht.RouteMessa"
+    "geWrapper\032\024.dht.RouteMessageAck\022@\n\016forwa"
+    "rdMessage\022\030.dht.RouteMessageWrapper\032\024.dh"
+    "t.RouteMessageAck2W\n\025RecursiveOperationR"
+    "pc\022>\n\014routeRequest\022\030.dht.RouteMessageWra"
+    "pper\032\024.dht.RouteMessageAck2\210\002\n\010StoreRpc\022"
+    ":\n\tstoreData\022\025.dht.StoreDataRequest\032\026.dh"
+    "t.StoreDataResponse\022B\n\rreplicateData\022\031.d"
+    "ht.ReplicateDataRequest\032\026.google.protobu"
+    "f.Empty\0225\n\014syncReplicas\022\023.dht.ReplicaDig"
+    "ests\032\020.dht.ReplicaKeys\022E\n\022replicateDataB"
+    "atch\022\027.dht.ReplicateDataBatch\032\026.google.p"
+    "rotobuf.Empty2g\n\034RecursiveOperationSessi"
+    "onRpc\022G\n\014sendResponse\022\037.dht.RecursiveOpe"
+    "rationResponse\032\026.google.protobuf.Empty2k"
+    "\n\033WebsocketClientConnectorRpc\022L\n\021request"
+    "Connection\022\037.dht.WebsocketConnectionRequ"
+    "est\032\026.google.protobuf.Empty2\202\002\n\022WebrtcCo"
+    "nnectorRpc\022I\n\021requestConnection\022\034.dht.We"
+    "brtcConnectionRequest\032\026.google.protobuf."
+    "Empty\0221\n\010rtcOffer\022\r.dht.RtcOffer\032\026.googl"
+    "e.protobuf.Empty\0223\n\trtcAnswer\022\016.dht.RtcA"
+    "nswer\032\026.google.protobuf.Empty\0229\n\014iceCand"
+    "idate\022\021.dht.IceCandidate\032\026.google.protob"
+    "uf.Empty2\207\002\n\021ConnectionLockRpc\0222\n\013lockRe"
+    "quest\022\020.dht.LockRequest\032\021.dht.LockRespon"
+    "se\022;\n\runlockRequest\022\022.dht.UnlockRequest\032"
+    "\026.google.protobuf.Empty\022C\n\022gracefulDisco"
+    "nnect\022\025.dht.DisconnectNotice\032\026.google.pr"
+    "otobuf.Empty\022<\n\nsetPrivate\022\026.dht.SetPriv"
+    "ateRequest\032\026.google.protobuf.Empty2\241\002\n\016E"
+    "xternalApiRpc\022R\n\021externalFetchData\022\035.dht"
+    ".ExternalFetchDataRequest\032\036.dht.External"
+    "FetchDataResponse\022R\n\021externalStoreData\022\035"
+    ".dht.ExternalStoreDataRequest\032\036.dht.Exte"
+    "rnalStoreDataResponse\022g\n\030externalFindClo"
+    "sestNodes\022$.dht.ExternalFindClosestNodes"
+    "Request\032%.dht.ExternalFindClosestNodesRe"
+    "sponseB\002H\002b\006proto3"
 };
 static const ::_pbi::DescriptorTable* PROTOBUF_NONNULL const
     descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto_deps[4] = {
@@ -1661,13 +1802,13 @@ static ::absl::once_flag descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2epro
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto = {
     false,
     false,
-    6187,
+    6498,
     descriptor_table_protodef_packages_2fdht_2fprotos_2fDhtRpc_2eproto,
     "packages/dht/protos/DhtRpc.proto",
     &descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto_once,
     descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto_deps,
     4,
-    38,
+    42,
     schemas,
     file_default_instances,
     TableStruct_packages_2fdht_2fprotos_2fDhtRpc_2eproto::offsets,
@@ -8291,6 +8432,655 @@ void ExternalFindClosestNodesResponse::InternalSwap(ExternalFindClosestNodesResp
 ::google::protobuf::Metadata ExternalFindClosestNodesResponse::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class ReplicateDataBatch::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ReplicateDataBatch>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_._has_bits_);
+};
+
+ReplicateDataBatch::ReplicateDataBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicateDataBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:dht.ReplicateDataBatch)
+}
+PROTOBUF_NDEBUG_INLINE ReplicateDataBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::dht::ReplicateDataBatch& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        entries_{visibility, arena, from.entries_} {}
+
+ReplicateDataBatch::ReplicateDataBatch(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ReplicateDataBatch& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicateDataBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ReplicateDataBatch* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:dht.ReplicateDataBatch)
+}
+PROTOBUF_NDEBUG_INLINE ReplicateDataBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        entries_{visibility, arena} {}
+
+inline void ReplicateDataBatch::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ReplicateDataBatch::~ReplicateDataBatch() {
+  // @@protoc_insertion_point(destructor:dht.ReplicateDataBatch)
+  SharedDtor(*this);
+}
+inline void ReplicateDataBatch::SharedDtor(MessageLite& self) {
+  ReplicateDataBatch& this_ = static_cast<ReplicateDataBatch&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ReplicateDataBatch::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ReplicateDataBatch(arena);
+}
+constexpr auto ReplicateDataBatch::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_.entries_) +
+          decltype(ReplicateDataBatch::_impl_.entries_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(ReplicateDataBatch), alignof(ReplicateDataBatch), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ReplicateDataBatch::PlacementNew_,
+                                 sizeof(ReplicateDataBatch),
+                                 alignof(ReplicateDataBatch));
+  }
+}
+constexpr auto ReplicateDataBatch::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ReplicateDataBatch_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ReplicateDataBatch::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReplicateDataBatch>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ReplicateDataBatch::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&ReplicateDataBatch::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_._cached_size_),
+          false,
+      },
+      &ReplicateDataBatch::kDescriptorMethods,
+      &descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ReplicateDataBatch_class_data_ =
+        ReplicateDataBatch::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ReplicateDataBatch::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReplicateDataBatch_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReplicateDataBatch_class_data_.tc_table);
+  return ReplicateDataBatch_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+ReplicateDataBatch::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    ReplicateDataBatch_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::dht::ReplicateDataBatch>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .dht.DataEntry entries = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_.entries_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .dht.DataEntry entries = 1;
+    {PROTOBUF_FIELD_OFFSET(ReplicateDataBatch, _impl_.entries_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::dht::DataEntry>()},
+  }},
+  {{
+  }},
+};
+void ReplicateDataBatch::InternalSwap(ReplicateDataBatch* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata ReplicateDataBatch::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ReplicaDigest::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ReplicaDigest>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_._has_bits_);
+};
+
+ReplicaDigest::ReplicaDigest(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaDigest_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:dht.ReplicaDigest)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaDigest::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::dht::ReplicaDigest& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        key_(arena, from.key_) {}
+
+ReplicaDigest::ReplicaDigest(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ReplicaDigest& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaDigest_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ReplicaDigest* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.digest_ = from._impl_.digest_;
+
+  // @@protoc_insertion_point(copy_constructor:dht.ReplicaDigest)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaDigest::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        key_(arena) {}
+
+inline void ReplicaDigest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.digest_ = {};
+}
+ReplicaDigest::~ReplicaDigest() {
+  // @@protoc_insertion_point(destructor:dht.ReplicaDigest)
+  SharedDtor(*this);
+}
+inline void ReplicaDigest::SharedDtor(MessageLite& self) {
+  ReplicaDigest& this_ = static_cast<ReplicaDigest&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.key_.Destroy();
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ReplicaDigest::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ReplicaDigest(arena);
+}
+constexpr auto ReplicaDigest::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ReplicaDigest),
+                                            alignof(ReplicaDigest));
+}
+constexpr auto ReplicaDigest::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ReplicaDigest_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ReplicaDigest::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReplicaDigest>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ReplicaDigest::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&ReplicaDigest::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_._cached_size_),
+          false,
+      },
+      &ReplicaDigest::kDescriptorMethods,
+      &descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ReplicaDigest_class_data_ =
+        ReplicaDigest::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ReplicaDigest::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReplicaDigest_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReplicaDigest_class_data_.tc_table);
+  return ReplicaDigest_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<1, 2, 0, 0, 2>
+ReplicaDigest::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_._has_bits_),
+    0, // no _extensions_
+    2, 8,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967292,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    2,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    ReplicaDigest_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::dht::ReplicaDigest>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // fixed64 digest = 2;
+    {::_pbi::TcParser::FastF64S1,
+     {17, 1, 0,
+      PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_.digest_)}},
+    // bytes key = 1;
+    {::_pbi::TcParser::FastBS1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_.key_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // bytes key = 1;
+    {PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_.key_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
+    // fixed64 digest = 2;
+    {PROTOBUF_FIELD_OFFSET(ReplicaDigest, _impl_.digest_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kFixed64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+void ReplicaDigest::InternalSwap(ReplicaDigest* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata ReplicaDigest::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ReplicaDigests::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ReplicaDigests>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_._has_bits_);
+};
+
+ReplicaDigests::ReplicaDigests(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaDigests_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:dht.ReplicaDigests)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaDigests::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::dht::ReplicaDigests& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        digests_{visibility, arena, from.digests_} {}
+
+ReplicaDigests::ReplicaDigests(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ReplicaDigests& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaDigests_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ReplicaDigests* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:dht.ReplicaDigests)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaDigests::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        digests_{visibility, arena} {}
+
+inline void ReplicaDigests::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ReplicaDigests::~ReplicaDigests() {
+  // @@protoc_insertion_point(destructor:dht.ReplicaDigests)
+  SharedDtor(*this);
+}
+inline void ReplicaDigests::SharedDtor(MessageLite& self) {
+  ReplicaDigests& this_ = static_cast<ReplicaDigests&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ReplicaDigests::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ReplicaDigests(arena);
+}
+constexpr auto ReplicaDigests::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_.digests_) +
+          decltype(ReplicaDigests::_impl_.digests_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(ReplicaDigests), alignof(ReplicaDigests), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ReplicaDigests::PlacementNew_,
+                                 sizeof(ReplicaDigests),
+                                 alignof(ReplicaDigests));
+  }
+}
+constexpr auto ReplicaDigests::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ReplicaDigests_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ReplicaDigests::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReplicaDigests>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ReplicaDigests::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&ReplicaDigests::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_._cached_size_),
+          false,
+      },
+      &ReplicaDigests::kDescriptorMethods,
+      &descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ReplicaDigests_class_data_ =
+        ReplicaDigests::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ReplicaDigests::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReplicaDigests_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReplicaDigests_class_data_.tc_table);
+  return ReplicaDigests_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+ReplicaDigests::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    ReplicaDigests_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::dht::ReplicaDigests>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated .dht.ReplicaDigest digests = 1;
+    {::_pbi::TcParser::FastMtR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_.digests_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated .dht.ReplicaDigest digests = 1;
+    {PROTOBUF_FIELD_OFFSET(ReplicaDigests, _impl_.digests_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::dht::ReplicaDigest>()},
+  }},
+  {{
+  }},
+};
+void ReplicaDigests::InternalSwap(ReplicaDigests* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata ReplicaDigests::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
+class ReplicaKeys::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<ReplicaKeys>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_._has_bits_);
+};
+
+ReplicaKeys::ReplicaKeys(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaKeys_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:dht.ReplicaKeys)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaKeys::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::dht::ReplicaKeys& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        keys_{visibility, arena, from.keys_} {}
+
+ReplicaKeys::ReplicaKeys(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const ReplicaKeys& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, ReplicaKeys_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  ReplicaKeys* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:dht.ReplicaKeys)
+}
+PROTOBUF_NDEBUG_INLINE ReplicaKeys::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        keys_{visibility, arena} {}
+
+inline void ReplicaKeys::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+ReplicaKeys::~ReplicaKeys() {
+  // @@protoc_insertion_point(destructor:dht.ReplicaKeys)
+  SharedDtor(*this);
+}
+inline void ReplicaKeys::SharedDtor(MessageLite& self) {
+  ReplicaKeys& this_ = static_cast<ReplicaKeys&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL ReplicaKeys::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) ReplicaKeys(arena);
+}
+constexpr auto ReplicaKeys::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_.keys_) +
+          decltype(ReplicaKeys::_impl_.keys_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(ReplicaKeys), alignof(ReplicaKeys), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&ReplicaKeys::PlacementNew_,
+                                 sizeof(ReplicaKeys),
+                                 alignof(ReplicaKeys));
+  }
+}
+constexpr auto ReplicaKeys::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_ReplicaKeys_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &ReplicaKeys::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<ReplicaKeys>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &ReplicaKeys::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&ReplicaKeys::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_._cached_size_),
+          false,
+      },
+      &ReplicaKeys::kDescriptorMethods,
+      &descriptor_table_packages_2fdht_2fprotos_2fDhtRpc_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull ReplicaKeys_class_data_ =
+        ReplicaKeys::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+ReplicaKeys::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&ReplicaKeys_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(ReplicaKeys_class_data_.tc_table);
+  return ReplicaKeys_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2>
+ReplicaKeys::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    ReplicaKeys_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::dht::ReplicaKeys>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated bytes keys = 1;
+    {::_pbi::TcParser::FastBR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_.keys_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated bytes keys = 1;
+    {PROTOBUF_FIELD_OFFSET(ReplicaKeys, _impl_.keys_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kBytes | ::_fl::kRepSString)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+void ReplicaKeys::InternalSwap(ReplicaKeys* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata ReplicaKeys::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace dht
 namespace google {
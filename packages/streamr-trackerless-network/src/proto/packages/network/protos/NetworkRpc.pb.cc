@@ -83,7 +83,8 @@ inline constexpr StreamPartHandshakeRequest::Impl_::Impl_(
             ::_pbi::ConstantInitialized()),
         interleavenodeid_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        acceptsstreammessagebatches_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR StreamPartHandshakeRequest::StreamPartHandshakeRequest(::_pbi::ConstantInitialized)
@@ -105,6 +106,31 @@ struct StreamPartHandshakeRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamPartHandshakeRequestDefaultTypeInternal _StreamPartHandshakeRequest_default_instance_;
 
+inline constexpr StreamMessageBatch::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        messages_{} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR StreamMessageBatch::StreamMessageBatch(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(StreamMessageBatch_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct StreamMessageBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StreamMessageBatchDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StreamMessageBatchDefaultTypeInternal() {}
+  union {
+    StreamMessageBatch _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamMessageBatchDefaultTypeInternal _StreamMessageBatch_default_instance_;
+
 inline constexpr ResumeNeighborRequest::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -526,7 +552,8 @@ inline constexpr StreamPartHandshakeResponse::Impl_::Impl_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
         interleavetargetdescriptor_{nullptr},
-        accepted_{false} {}
+        accepted_{false},
+        acceptsstreammessagebatches_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR StreamPartHandshakeResponse::StreamPartHandshakeResponse(::_pbi::ConstantInitialized)
@@ -839,26 +866,30 @@ const ::uint32_t
         1,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_._has_bits_),
-        8, // hasbit index offset
+        9, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.streampartid_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.requestid_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.concurrenthandshakenodeid_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.neighbornodeids_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.interleavenodeid_),
+        PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeRequest, _impl_.acceptsstreammessagebatches_),
         1,
         2,
         3,
         0,
         4,
+        5,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeResponse, _impl_._has_bits_),
-        6, // hasbit index offset
+        7, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeResponse, _impl_.accepted_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeResponse, _impl_.requestid_),
         PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeResponse, _impl_.interleavetargetdescriptor_),
+        PROTOBUF_FIELD_OFFSET(::StreamPartHandshakeResponse, _impl_.acceptsstreammessagebatches_),
         2,
         0,
         1,
+        3,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::InterleaveRequest, _impl_._has_bits_),
         4, // hasbit index offset
@@ -958,6 +989,11 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::ResumeNeighborRequest, _impl_.fromtimestamp_),
         0,
         1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::StreamMessageBatch, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::StreamMessageBatch, _impl_.messages_),
+        0,
 };
 
 static const ::_pbi::MigrationSchema
@@ -970,24 +1006,25 @@ static const ::_pbi::MigrationSchema
         {67, sizeof(::GroupKeyResponse)},
         {78, sizeof(::EncryptedGroupKey)},
         {85, sizeof(::StreamPartHandshakeRequest)},
-        {98, sizeof(::StreamPartHandshakeResponse)},
-        {107, sizeof(::InterleaveRequest)},
-        {112, sizeof(::InterleaveResponse)},
-        {117, sizeof(::LeaveStreamPartNotice)},
-        {124, sizeof(::NeighborUpdate)},
-        {133, sizeof(::ProxyConnectionRequest)},
-        {140, sizeof(::ProxyConnectionResponse)},
-        {145, sizeof(::TemporaryConnectionRequest)},
-        {146, sizeof(::TemporaryConnectionResponse)},
-        {151, sizeof(::CloseTemporaryConnection)},
-        {152, sizeof(::StreamPartitionInfo)},
-        {163, sizeof(::ContentDeliveryLayerNeighborInfo)},
-        {170, sizeof(::ControlLayerInfo)},
-        {177, sizeof(::NodeInfoRequest)},
-        {178, sizeof(::NodeInfoResponse)},
-        {189, sizeof(::PauseNeighborRequest)},
-        {194, sizeof(::PauseNeighborResponse)},
-        {199, sizeof(::ResumeNeighborRequest)},
+        {100, sizeof(::StreamPartHandshakeResponse)},
+        {111, sizeof(::InterleaveRequest)},
+        {116, sizeof(::InterleaveResponse)},
+        {121, sizeof(::LeaveStreamPartNotice)},
+        {128, sizeof(::NeighborUpdate)},
+        {137, sizeof(::ProxyConnectionRequest)},
+        {144, sizeof(::ProxyConnectionResponse)},
+        {149, sizeof(::TemporaryConnectionRequest)},
+        {150, sizeof(::TemporaryConnectionResponse)},
+        {155, sizeof(::CloseTemporaryConnection)},
+        {156, sizeof(::StreamPartitionInfo)},
+        {167, sizeof(::ContentDeliveryLayerNeighborInfo)},
+        {174, sizeof(::ControlLayerInfo)},
+        {181, sizeof(::NodeInfoRequest)},
+        {182, sizeof(::NodeInfoResponse)},
+        {193, sizeof(::PauseNeighborRequest)},
+        {198, sizeof(::PauseNeighborResponse)},
+        {203, sizeof(::ResumeNeighborRequest)},
+        {210, sizeof(::StreamMessageBatch)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::_MessageID_default_instance_._instance,
@@ -1016,6 +1053,7 @@ static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::_PauseNeighborRequest_default_instance_._instance,
     &::_PauseNeighborResponse_default_instance_._instance,
     &::_ResumeNeighborRequest_default_instance_._instance,
+    &::_StreamMessageBatch_default_instance_._instance,
 };
 const char descriptor_table_protodef_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
@@ -1048,81 +1086,85 @@ const char descriptor_table_protodef_packages_2fnetwork_2fprotos_2fNetworkRpc_2e
     "ientId\030\002 \001(\014\022%\n\tgroupKeys\030\003 \003(\0132\022.Encryp"
     "tedGroupKey\0221\n\016encryptionType\030\004 \001(\0162\031.As"
     "ymmetricEncryptionType\"-\n\021EncryptedGroup"
-    "Key\022\n\n\002id\030\001 \001(\t\022\014\n\004data\030\002 \001(\014\"\330\001\n\032Stream"
+    "Key\022\n\n\002id\030\001 \001(\t\022\014\n\004data\030\002 \001(\014\"\376\001\n\032Stream"
     "PartHandshakeRequest\022\024\n\014streamPartId\030\001 \001"
     "(\t\022\021\n\trequestId\030\002 \001(\t\022&\n\031concurrentHands"
     "hakeNodeId\030\003 \001(\014H\000\210\001\001\022\027\n\017neighborNodeIds"
-    "\030\004 \003(\014\022\035\n\020interleaveNodeId\030\005 \001(\014H\001\210\001\001B\034\n"
-    "\032_concurrentHandshakeNodeIdB\023\n\021_interlea"
-    "veNodeId\"\237\001\n\033StreamPartHandshakeResponse"
-    "\022\020\n\010accepted\030\001 \001(\010\022\021\n\trequestId\030\002 \001(\t\022<\n"
-    "\032interleaveTargetDescriptor\030\003 \001(\0132\023.dht."
-    "PeerDescriptorH\000\210\001\001B\035\n\033_interleaveTarget"
-    "Descriptor\"L\n\021InterleaveRequest\0227\n\032inter"
-    "leaveTargetDescriptor\030\001 \001(\0132\023.dht.PeerDe"
-    "scriptor\"&\n\022InterleaveResponse\022\020\n\010accept"
-    "ed\030\001 \001(\010\"C\n\025LeaveStreamPartNotice\022\024\n\014str"
-    "eamPartId\030\001 \001(\t\022\024\n\014isEntryPoint\030\002 \001(\010\"j\n"
-    "\016NeighborUpdate\022\024\n\014streamPartId\030\001 \001(\t\022\020\n"
-    "\010removeMe\030\002 \001(\010\0220\n\023neighborDescriptors\030\003"
-    " \003(\0132\023.dht.PeerDescriptor\"_\n\026ProxyConnec"
-    "tionRequest\022\'\n\tdirection\030\001 \001(\0162\017.ProxyDi"
-    "rectionH\000\210\001\001\022\016\n\006userId\030\002 \001(\014B\014\n\n_directi"
-    "on\"+\n\027ProxyConnectionResponse\022\020\n\010accepte"
-    "d\030\001 \001(\010\"\034\n\032TemporaryConnectionRequest\"/\n"
-    "\033TemporaryConnectionResponse\022\020\n\010accepted"
-    "\030\001 \001(\010\"\032\n\030CloseTemporaryConnection\"\345\001\n\023S"
-    "treamPartitionInfo\022\n\n\002id\030\001 \001(\t\0222\n\025contro"
-    "lLayerNeighbors\030\002 \003(\0132\023.dht.PeerDescript"
-    "or\022D\n\'deprecatedContentDeliveryLayerNeig"
-    "hbors\030\003 \003(\0132\023.dht.PeerDescriptor\022H\n\035cont"
-    "entDeliveryLayerNeighbors\030\004 \003(\0132!.Conten"
-    "tDeliveryLayerNeighborInfo\"i\n ContentDel"
-    "iveryLayerNeighborInfo\022+\n\016peerDescriptor"
-    "\030\001 \001(\0132\023.dht.PeerDescriptor\022\020\n\003rtt\030\002 \001(\005"
-    "H\000\210\001\001B\006\n\004_rtt\"d\n\020ControlLayerInfo\022&\n\tnei"
-    "ghbors\030\001 \003(\0132\023.dht.PeerDescriptor\022(\n\013con"
-    "nections\030\002 \003(\0132\023.dht.PeerDescriptor\"\021\n\017N"
-    "odeInfoRequest\"\264\001\n\020NodeInfoResponse\022+\n\016p"
-    "eerDescriptor\030\001 \001(\0132\023.dht.PeerDescriptor"
-    "\022.\n\020streamPartitions\030\002 \003(\0132\024.StreamParti"
-    "tionInfo\022\'\n\014controlLayer\030\003 \001(\0132\021.Control"
-    "LayerInfo\022\032\n\022applicationVersion\030\004 \001(\t\".\n"
-    "\024PauseNeighborRequest\022\026\n\016messageChainId\030"
-    "\001 \001(\t\")\n\025PauseNeighborResponse\022\020\n\010accept"
-    "ed\030\001 \001(\010\"F\n\025ResumeNeighborRequest\022\026\n\016mes"
-    "sageChainId\030\001 \001(\t\022\025\n\rfromTimestamp\030\002 \001(\003"
-    "*#\n\013ContentType\022\010\n\004JSON\020\000\022\n\n\006BINARY\020\001*#\n"
-    "\016EncryptionType\022\010\n\004NONE\020\000\022\007\n\003AES\020\001*/\n\030As"
-    "ymmetricEncryptionType\022\007\n\003RSA\020\000\022\n\n\006ML_KE"
-    "M\020\001*v\n\rSignatureType\022\032\n\026ECDSA_SECP256K1_"
-    "LEGACY\020\000\022\027\n\023ECDSA_SECP256K1_EVM\020\001\022\014\n\010ERC"
-    "_1271\020\002\022\r\n\tML_DSA_87\020\003\022\023\n\017ECDSA_SECP256R"
-    "1\020\004*,\n\016ProxyDirection\022\013\n\007PUBLISH\020\000\022\r\n\tSU"
-    "BSCRIBE\020\0012\232\001\n\022ContentDeliveryRpc\022;\n\021send"
-    "StreamMessage\022\016.StreamMessage\032\026.google.p"
-    "rotobuf.Empty\022G\n\025leaveStreamPartNotice\022\026"
-    ".LeaveStreamPartNotice\032\026.google.protobuf"
-    ".Empty2\\\n\022ProxyConnectionRpc\022F\n\021requestC"
-    "onnection\022\027.ProxyConnectionRequest\032\030.Pro"
-    "xyConnectionResponse2\224\001\n\014HandshakeRpc\022F\n"
-    "\thandshake\022\033.StreamPartHandshakeRequest\032"
-    "\034.StreamPartHandshakeResponse\022<\n\021interle"
-    "aveRequest\022\022.InterleaveRequest\032\023.Interle"
-    "aveResponse2G\n\021NeighborUpdateRpc\0222\n\016neig"
-    "hborUpdate\022\017.NeighborUpdate\032\017.NeighborUp"
-    "date2\253\001\n\026TemporaryConnectionRpc\022K\n\016openC"
-    "onnection\022\033.TemporaryConnectionRequest\032\034"
-    ".TemporaryConnectionResponse\022D\n\017closeCon"
-    "nection\022\031.CloseTemporaryConnection\032\026.goo"
-    "gle.protobuf.Empty2=\n\013NodeInfoRpc\022.\n\007get"
-    "Info\022\020.NodeInfoRequest\032\021.NodeInfoRespons"
-    "e2\303\001\n\013PlumtreeRpc\022>\n\rpauseNeighbor\022\025.Pau"
-    "seNeighborRequest\032\026.PauseNeighborRespons"
-    "e\022@\n\016resumeNeighbor\022\026.ResumeNeighborRequ"
-    "est\032\026.google.protobuf.Empty\0222\n\014sendMetad"
-    "ata\022\n.MessageID\032\026.google.protobuf.EmptyB"
-    "\002H\002b\006proto3"
+    "\030\004 \003(\014\022\035\n\020interleaveNodeId\030\005 \001(\014H\001\210\001\001\022$\n"
+    "\033acceptsStreamMessageBatches\030\350\007 \001(\010B\034\n\032_"
+    "concurrentHandshakeNodeIdB\023\n\021_interleave"
+    "NodeId\"\305\001\n\033StreamPartHandshakeResponse\022\020"
+    "\n\010accepted\030\001 \001(\010\022\021\n\trequestId\030\002 \001(\t\022<\n\032i"
+    "nterleaveTargetDescriptor\030\003 \001(\0132\023.dht.Pe"
+    "erDescriptorH\000\210\001\001\022$\n\033acceptsStreamMessag"
+    "eBatches\030\350\007 \001(\010B\035\n\033_interleaveTargetDesc"
+    "riptor\"L\n\021InterleaveRequest\0227\n\032interleav"
+    "eTargetDescriptor\030\001 \001(\0132\023.dht.PeerDescri"
+    "ptor\"&\n\022InterleaveResponse\022\020\n\010accepted\030\001"
+    " \001(\010\"C\n\025LeaveStreamPartNotice\022\024\n\014streamP"
+    "artId\030\001 \001(\t\022\024\n\014isEntryPoint\030\002 \001(\010\"j\n\016Nei"
+    "ghborUpdate\022\024\n\014streamPartId\030\001 \001(\t\022\020\n\010rem"
+    "oveMe\030\002 \001(\010\0220\n\023neighborDescriptors\030\003 \003(\013"
+    "2\023.dht.PeerDescriptor\"_\n\026ProxyConnection"
+    "Request\022\'\n\tdirection\030\001 \001(\0162\017.ProxyDirect"
+    "ionH\000\210\001\001\022\016\n\006userId\030\002 \001(\014B\014\n\n_direction\"+"
+    "\n\027ProxyConnectionResponse\022\020\n\010accepted\030\001 "
+    "\001(\010\"\034\n\032TemporaryConnectionRequest\"/\n\033Tem"
+    "poraryConnectionResponse\022\020\n\010accepted\030\001 \001"
+    "(\010\"\032\n\030CloseTemporaryConnection\"\345\001\n\023Strea"
+    "mPartitionInfo\022\n\n\002id\030\001 \001(\t\0222\n\025controlLay"
+    "erNeighbors\030\002 \003(\0132\023.dht.PeerDescriptor\022D"
+    "\n\'deprecatedContentDeliveryLayerNeighbor"
+    "s\030\003 \003(\0132\023.dht.PeerDescriptor\022H\n\035contentD"
+    "eliveryLayerNeighbors\030\004 \003(\0132!.ContentDel"
+    "iveryLayerNeighborInfo\"i\n ContentDeliver"
+    "yLayerNeighborInfo\022+\n\016peerDescriptor\030\001 \001"
+    "(\0132\023.dht.PeerDescriptor\022\020\n\003rtt\030\002 \001(\005H\000\210\001"
+    "\001B\006\n\004_rtt\"d\n\020ControlLayerInfo\022&\n\tneighbo"
+    "rs\030\001 \003(\0132\023.dht.PeerDescriptor\022(\n\013connect"
+    "ions\030\002 \003(\0132\023.dht.PeerDescriptor\"\021\n\017NodeI"
+    "nfoRequest\"\264\001\n\020NodeInfoResponse\022+\n\016peerD"
+    "escriptor\030\001 \001(\0132\023.dht.PeerDescriptor\022.\n\020"
+    "streamPartitions\030\002 \003(\0132\024.StreamPartition"
+    "Info\022\'\n\014controlLayer\030\003 \001(\0132\021.ControlLaye"
+    "rInfo\022\032\n\022applicationVersion\030\004 \001(\t\".\n\024Pau"
+    "seNeighborRequest\022\026\n\016messageChainId\030\001 \001("
+    "\t\")\n\025PauseNeighborResponse\022\020\n\010accepted\030\001"
+    " \001(\010\"F\n\025ResumeNeighborRequest\022\026\n\016message"
+    "ChainId\030\001 \001(\t\022\025\n\rfromTimestamp\030\002 \001(\003\"&\n\022"
+    "StreamMessageBatch\022\020\n\010messages\030\001 \003(\014*#\n\013"
+    "ContentType\022\010\n\004JSON\020\000\022\n\n\006BINARY\020\001*#\n\016Enc"
+    "ryptionType\022\010\n\004NONE\020\000\022\007\n\003AES\020\001*/\n\030Asymme"
+    "tricEncryptionType\022\007\n\003RSA\020\000\022\n\n\006ML_KEM\020\001*"
+    "v\n\rSignatureType\022\032\n\026ECDSA_SECP256K1_LEGA"
+    "CY\020\000\022\027\n\023ECDSA_SECP256K1_EVM\020\001\022\014\n\010ERC_127"
+    "1\020\002\022\r\n\tML_DSA_87\020\003\022\023\n\017ECDSA_SECP256R1\020\004*"
+    ",\n\016ProxyDirection\022\013\n\007PUBLISH\020\000\022\r\n\tSUBSCR"
+    "IBE\020\0012\341\001\n\022ContentDeliveryRpc\022;\n\021sendStre"
+    "amMessage\022\016.StreamMessage\032\026.google.proto"
+    "buf.Empty\022G\n\025leaveStreamPartNotice\022\026.Lea"
+    "veStreamPartNotice\032\026.google.protobuf.Emp"
+    "ty\022E\n\026sendStreamMessageBatch\022\023.StreamMes"
+    "sageBatch\032\026.google.protobuf.Empty2\\\n\022Pro"
+    "xyConnectionRpc\022F\n\021requestConnection\022\027.P"
+    "roxyConnectionRequest\032\030.ProxyConnectionR"
+    "esponse2\224\001\n\014HandshakeRpc\022F\n\thandshake\022\033."
+    "StreamPartHandshakeRequest\032\034.StreamPartH"
+    "andshakeResponse\022<\n\021interleaveRequest\022\022."
+    "InterleaveRequest\032\023.InterleaveResponse2G"
+    "\n\021NeighborUpdateRpc\0222\n\016neighborUpdate\022\017."
+    "NeighborUpdate\032\017.NeighborUpdate2\253\001\n\026Temp"
+    "oraryConnectionRpc\022K\n\016openConnection\022\033.T"
+    "emporaryConnectionRequest\032\034.TemporaryCon"
+    "nectionResponse\022D\n\017closeConnection\022\031.Clo"
+    "seTemporaryConnection\032\026.google.protobuf."
+    "Empty2=\n\013NodeInfoRpc\022.\n\007getInfo\022\020.NodeIn"
+    "foRequest\032\021.NodeInfoResponse2\303\001\n\013Plumtre"
+    "eRpc\022>\n\rpauseNeighbor\022\025.PauseNeighborReq"
+    "uest\032\026.PauseNeighborResponse\022@\n\016resumeNe"
+    "ighbor\022\026.ResumeNeighborRequest\032\026.google."
+    "protobuf.Empty\0222\n\014sendMetadata\022\n.Message"
+    "ID\032\026.google.protobuf.EmptyB\002H\002b\006proto3"
 };
 static const ::_pbi::DescriptorTable* PROTOBUF_NONNULL const
     descriptor_table_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto_deps[2] = {
@@ -1133,13 +1175,13 @@ static ::absl::once_flag descriptor_table_packages_2fnetwork_2fprotos_2fNetworkR
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto = {
     false,
     false,
-    4131,
+    4318,
     descriptor_table_protodef_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto,
     "packages/network/protos/NetworkRpc.proto",
     &descriptor_table_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto_once,
     descriptor_table_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto_deps,
     2,
-    26,
+    27,
     schemas,
     file_default_instances,
     TableStruct_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto::offsets,
@@ -2632,6 +2674,7 @@ StreamPartHandshakeRequest::StreamPartHandshakeRequest(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  _impl_.acceptsstreammessagebatches_ = from._impl_.acceptsstreammessagebatches_;
 
   // @@protoc_insertion_point(copy_constructor:StreamPartHandshakeRequest)
 }
@@ -2647,6 +2690,7 @@ PROTOBUF_NDEBUG_INLINE StreamPartHandshakeRequest::Impl_::Impl_(
 
 inline void StreamPartHandshakeRequest::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.acceptsstreammessagebatches_ = {};
 }
 StreamPartHandshakeRequest::~StreamPartHandshakeRequest() {
   // @@protoc_insertion_point(destructor:StreamPartHandshakeRequest)
@@ -2722,16 +2766,16 @@ StreamPartHandshakeRequest::GetClassData() const {
   return StreamPartHandshakeRequest_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 0, 56, 2>
+const ::_pbi::TcParseTable<3, 6, 0, 56, 7>
 StreamPartHandshakeRequest::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(StreamPartHandshakeRequest, _impl_._has_bits_),
     0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
+    1000, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967264,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
+    6,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     StreamPartHandshakeRequest_class_data_.base(),
@@ -2741,7 +2785,10 @@ StreamPartHandshakeRequest::_table_ = {
     ::_pbi::TcParser::GetTable<::StreamPartHandshakeRequest>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // bool acceptsStreamMessageBatches = 1000;
+    {::_pbi::TcParser::FastV8S2,
+     {16064, 5, 0,
+      PROTOBUF_FIELD_OFFSET(StreamPartHandshakeRequest, _impl_.acceptsstreammessagebatches_)}},
     // string streamPartId = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 1, 0,
@@ -2765,6 +2812,8 @@ StreamPartHandshakeRequest::_table_ = {
     {::_pbi::TcParser::MiniParse, {}},
     {::_pbi::TcParser::MiniParse, {}},
   }}, {{
+    1000, 0, 1,
+    65534, 5,
     65535, 65535
   }}, {{
     // string streamPartId = 1;
@@ -2777,6 +2826,8 @@ StreamPartHandshakeRequest::_table_ = {
     {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeRequest, _impl_.neighbornodeids_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kBytes | ::_fl::kRepSString)},
     // optional bytes interleaveNodeId = 5;
     {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeRequest, _impl_.interleavenodeid_), _Internal::kHasBitsOffset + 4, 0, (0 | ::_fl::kFcOptional | ::_fl::kBytes | ::_fl::kRepAString)},
+    // bool acceptsStreamMessageBatches = 1000;
+    {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeRequest, _impl_.acceptsstreammessagebatches_), _Internal::kHasBitsOffset + 5, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   // no aux_entries
   {{
@@ -2843,7 +2894,13 @@ StreamPartHandshakeResponse::StreamPartHandshakeResponse(
   _impl_.interleavetargetdescriptor_ = (CheckHasBit(cached_has_bits, 0x00000002U))
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.interleavetargetdescriptor_)
                 : nullptr;
-  _impl_.accepted_ = from._impl_.accepted_;
+  ::memcpy(reinterpret_cast<char*>(&_impl_) +
+               offsetof(Impl_, accepted_),
+           reinterpret_cast<const char*>(&from._impl_) +
+               offsetof(Impl_, accepted_),
+           offsetof(Impl_, acceptsstreammessagebatches_) -
+               offsetof(Impl_, accepted_) +
+               sizeof(Impl_::acceptsstreammessagebatches_));
 
   // @@protoc_insertion_point(copy_constructor:StreamPartHandshakeResponse)
 }
@@ -2858,9 +2915,9 @@ inline void StreamPartHandshakeResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLA
   ::memset(reinterpret_cast<char*>(&_impl_) +
                offsetof(Impl_, interleavetargetdescriptor_),
            0,
-           offsetof(Impl_, accepted_) -
+           offsetof(Impl_, acceptsstreammessagebatches_) -
                offsetof(Impl_, interleavetargetdescriptor_) +
-               sizeof(Impl_::accepted_));
+               sizeof(Impl_::acceptsstreammessagebatches_));
 }
 StreamPartHandshakeResponse::~StreamPartHandshakeResponse() {
   // @@protoc_insertion_point(destructor:StreamPartHandshakeResponse)
@@ -2922,16 +2979,16 @@ StreamPartHandshakeResponse::GetClassData() const {
   return StreamPartHandshakeResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 45, 2>
+const ::_pbi::TcParseTable<2, 4, 1, 45, 7>
 StreamPartHandshakeResponse::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_._has_bits_),
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    1000, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
     4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    4,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     StreamPartHandshakeResponse_class_data_.base(),
@@ -2941,7 +2998,10 @@ StreamPartHandshakeResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::StreamPartHandshakeResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    {::_pbi::TcParser::MiniParse, {}},
+    // bool acceptsStreamMessageBatches = 1000;
+    {::_pbi::TcParser::FastV8S2,
+     {16064, 3, 0,
+      PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_.acceptsstreammessagebatches_)}},
     // bool accepted = 1;
     {::_pbi::TcParser::FastV8S1,
      {8, 2, 0,
@@ -2955,6 +3015,8 @@ StreamPartHandshakeResponse::_table_ = {
      {26, 1, 0,
       PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_.interleavetargetdescriptor_)}},
   }}, {{
+    1000, 0, 1,
+    65534, 3,
     65535, 65535
   }}, {{
     // bool accepted = 1;
@@ -2963,6 +3025,8 @@ StreamPartHandshakeResponse::_table_ = {
     {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_.requestid_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
     // optional .dht.PeerDescriptor interleaveTargetDescriptor = 3;
     {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_.interleavetargetdescriptor_), _Internal::kHasBitsOffset + 1, 0, (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // bool acceptsStreamMessageBatches = 1000;
+    {PROTOBUF_FIELD_OFFSET(StreamPartHandshakeResponse, _impl_.acceptsstreammessagebatches_), _Internal::kHasBitsOffset + 3, 0, (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::dht::PeerDescriptor>()},
@@ -5618,6 +5682,168 @@ void ResumeNeighborRequest::InternalSwap(ResumeNeighborRequest* PROTOBUF_RESTRIC
 ::google::protobuf::Metadata ResumeNeighborRequest::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class StreamMessageBatch::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<StreamMessageBatch>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_._has_bits_);
+};
+
+StreamMessageBatch::StreamMessageBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamMessageBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:StreamMessageBatch)
+}
+PROTOBUF_NDEBUG_INLINE StreamMessageBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    [[maybe_unused]] const ::StreamMessageBatch& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        messages_{visibility, arena, from.messages_} {}
+
+StreamMessageBatch::StreamMessageBatch(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const StreamMessageBatch& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, StreamMessageBatch_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  StreamMessageBatch* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+
+  // @@protoc_insertion_point(copy_constructor:StreamMessageBatch)
+}
+PROTOBUF_NDEBUG_INLINE StreamMessageBatch::Impl_::Impl_(
+    [[maybe_unused]] ::google::protobuf::internal::InternalVisibility visibility,
+    [[maybe_unused]] ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        messages_{visibility, arena} {}
+
+inline void StreamMessageBatch::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+}
+StreamMessageBatch::~StreamMessageBatch() {
+  // @@protoc_insertion_point(destructor:StreamMessageBatch)
+  SharedDtor(*this);
+}
+inline void StreamMessageBatch::SharedDtor(MessageLite& self) {
+  StreamMessageBatch& this_ = static_cast<StreamMessageBatch&>(self);
+  if constexpr (::_pbi::DebugHardenCheckHasBitConsistency()) {
+    this_.CheckHasBitConsistency();
+  }
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL StreamMessageBatch::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) StreamMessageBatch(arena);
+}
+constexpr auto StreamMessageBatch::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_.messages_) +
+          decltype(StreamMessageBatch::_impl_.messages_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(StreamMessageBatch), alignof(StreamMessageBatch), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&StreamMessageBatch::PlacementNew_,
+                                 sizeof(StreamMessageBatch),
+                                 alignof(StreamMessageBatch));
+  }
+}
+constexpr auto StreamMessageBatch::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_StreamMessageBatch_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &StreamMessageBatch::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<StreamMessageBatch>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &StreamMessageBatch::SharedDtor,
+          static_cast<void (::google::protobuf::MessageLite::*)()>(&StreamMessageBatch::ClearImpl),
+              ::google::protobuf::Message::ByteSizeLongImpl, ::google::protobuf::Message::_InternalSerializeImpl
+              ,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_._cached_size_),
+          false,
+      },
+      &StreamMessageBatch::kDescriptorMethods,
+      &descriptor_table_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull StreamMessageBatch_class_data_ =
+        StreamMessageBatch::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+StreamMessageBatch::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&StreamMessageBatch_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(StreamMessageBatch_class_data_.tc_table);
+  return StreamMessageBatch_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2>
+StreamMessageBatch::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    StreamMessageBatch_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::StreamMessageBatch>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // repeated bytes messages = 1;
+    {::_pbi::TcParser::FastBR1,
+     {10, 0, 0,
+      PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_.messages_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // repeated bytes messages = 1;
+    {PROTOBUF_FIELD_OFFSET(StreamMessageBatch, _impl_.messages_), _Internal::kHasBitsOffset + 0, 0, (0 | ::_fl::kFcRepeated | ::_fl::kBytes | ::_fl::kRepSString)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+void StreamMessageBatch::InternalSwap(StreamMessageBatch* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  GetReflection()->Swap(this, other);}
+
+::google::protobuf::Metadata StreamMessageBatch::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 namespace google {
 namespace protobuf {
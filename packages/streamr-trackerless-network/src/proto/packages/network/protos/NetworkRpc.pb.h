@@ -149,6 +149,10 @@ class StreamMessage;
 struct StreamMessageDefaultTypeInternal;
 extern StreamMessageDefaultTypeInternal _StreamMessage_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull StreamMessage_class_data_;
+class StreamMessageBatch;
+struct StreamMessageBatchDefaultTypeInternal;
+extern StreamMessageBatchDefaultTypeInternal _StreamMessageBatch_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull StreamMessageBatch_class_data_;
 class StreamPartHandshakeRequest;
 struct StreamPartHandshakeRequestDefaultTypeInternal;
 extern StreamPartHandshakeRequestDefaultTypeInternal _StreamPartHandshakeRequest_default_instance_;
@@ -768,6 +772,7 @@ class StreamPartHandshakeRequest final : public ::google::protobuf::Message
     kRequestIdFieldNumber = 2,
     kConcurrentHandshakeNodeIdFieldNumber = 3,
     kInterleaveNodeIdFieldNumber = 5,
+    kAcceptsStreamMessageBatchesFieldNumber = 1000,
   };
   // repeated bytes neighborNodeIds = 4;
   int neighbornodeids_size() const;
@@ -852,14 +857,24 @@ class StreamPartHandshakeRequest final : public ::google::protobuf::Message
   PROTOBUF_ALWAYS_INLINE void _internal_set_interleavenodeid(const ::std::string& value);
   ::std::string* PROTOBUF_NONNULL _internal_mutable_interleavenodeid();
 
+  public:
+  // bool acceptsStreamMessageBatches = 1000;
+  void clear_acceptsstreammessagebatches() ;
+  bool acceptsstreammessagebatches() const;
+  void set_acceptsstreammessagebatches(bool value);
+
+  private:
+  bool _internal_acceptsstreammessagebatches() const;
+  void _internal_set_acceptsstreammessagebatches(bool value);
+
   public:
   // @@protoc_insertion_point(class_scope:StreamPartHandshakeRequest)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<3, 5,
+  static const ::google::protobuf::internal::TcParseTable<3, 6,
                                    0, 56,
-                                   2>
+                                   7>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -884,6 +899,7 @@ class StreamPartHandshakeRequest final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr requestid_;
     ::google::protobuf::internal::ArenaStringPtr concurrenthandshakenodeid_;
     ::google::protobuf::internal::ArenaStringPtr interleavenodeid_;
+    bool acceptsstreammessagebatches_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -893,6 +909,174 @@ class StreamPartHandshakeRequest final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull StreamPartHandshakeRequest_class_data_;
 // -------------------------------------------------------------------
 
+class StreamMessageBatch final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:StreamMessageBatch) */ {
+ public:
+  inline StreamMessageBatch() : StreamMessageBatch(nullptr) {}
+  ~StreamMessageBatch() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(StreamMessageBatch* PROTOBUF_NONNULL msg, ::std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(StreamMessageBatch));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR StreamMessageBatch(::google::protobuf::internal::ConstantInitialized);
+
+  inline StreamMessageBatch(const StreamMessageBatch& from) : StreamMessageBatch(nullptr, from) {}
+  inline StreamMessageBatch(StreamMessageBatch&& from) noexcept
+      : StreamMessageBatch(nullptr, ::std::move(from)) {}
+  inline StreamMessageBatch& operator=(const StreamMessageBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StreamMessageBatch& operator=(StreamMessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StreamMessageBatch& default_instance() {
+    return *reinterpret_cast<const StreamMessageBatch*>(
+        &_StreamMessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 26;
+  friend void swap(StreamMessageBatch& a, StreamMessageBatch& b) { a.Swap(&b); }
+  inline void Swap(StreamMessageBatch* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StreamMessageBatch* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StreamMessageBatch* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<StreamMessageBatch>(arena);
+  }
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(StreamMessageBatch* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "StreamMessageBatch"; }
+
+  explicit StreamMessageBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  StreamMessageBatch(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const StreamMessageBatch& from);
+  StreamMessageBatch(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, StreamMessageBatch&& from) noexcept
+      : StreamMessageBatch(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated bytes messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+
+  public:
+  void clear_messages() ;
+  const ::std::string& messages(int index) const;
+  ::std::string* PROTOBUF_NONNULL mutable_messages(int index);
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_messages(int index, Arg_&& value, Args_... args);
+  ::std::string* PROTOBUF_NONNULL add_messages();
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void add_messages(Arg_&& value, Args_... args);
+  const ::google::protobuf::RepeatedPtrField<::std::string>& messages() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL mutable_messages();
+
+  private:
+  const ::google::protobuf::RepeatedPtrField<::std::string>& _internal_messages() const;
+  ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL _internal_mutable_messages();
+
+  public:
+  // @@protoc_insertion_point(class_scope:StreamMessageBatch)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const StreamMessageBatch& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField<::std::string> messages_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_packages_2fnetwork_2fprotos_2fNetworkRpc_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull StreamMessageBatch_class_data_;
+// -------------------------------------------------------------------
+
 class ResumeNeighborRequest final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:ResumeNeighborRequest) */ {
  public:
@@ -3632,6 +3816,7 @@ class StreamPartHandshakeResponse final : public ::google::protobuf::Message
     kRequestIdFieldNumber = 2,
     kInterleaveTargetDescriptorFieldNumber = 3,
     kAcceptedFieldNumber = 1,
+    kAcceptsStreamMessageBatchesFieldNumber = 1000,
   };
   // string requestId = 2;
   void clear_requestid() ;
@@ -3672,14 +3857,24 @@ class StreamPartHandshakeResponse final : public ::google::protobuf::Message
   bool _internal_accepted() const;
   void _internal_set_accepted(bool value);
 
+  public:
+  // bool acceptsStreamMessageBatches = 1000;
+  void clear_acceptsstreammessagebatches() ;
+  bool acceptsstreammessagebatches() const;
+  void set_acceptsstreammessagebatches(bool value);
+
+  private:
+  bool _internal_acceptsstreammessagebatches() const;
+  void _internal_set_acceptsstreammessagebatches(bool value);
+
   public:
   // @@protoc_insertion_point(class_scope:StreamPartHandshakeResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 3,
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
                                    1, 45,
-                                   2>
+                                   7>
       _table_;
 
   friend class ::google::protobuf::MessageLite;
@@ -3702,6 +3897,7 @@ class StreamPartHandshakeResponse final : public ::google::protobuf::Message
     ::google::protobuf::internal::ArenaStringPtr requestid_;
     ::dht::PeerDescriptor* PROTOBUF_NULLABLE interleavetargetdescriptor_;
     bool accepted_;
+    bool acceptsstreammessagebatches_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -7302,6 +7498,31 @@ inline void StreamPartHandshakeRequest::set_allocated_interleavenodeid(::std::st
   // @@protoc_insertion_point(field_set_allocated:StreamPartHandshakeRequest.interleaveNodeId)
 }
 
+// bool acceptsStreamMessageBatches = 1000;
+inline void StreamPartHandshakeRequest::clear_acceptsstreammessagebatches() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acceptsstreammessagebatches_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000020U);
+}
+inline bool StreamPartHandshakeRequest::acceptsstreammessagebatches() const {
+  // @@protoc_insertion_point(field_get:StreamPartHandshakeRequest.acceptsStreamMessageBatches)
+  return _internal_acceptsstreammessagebatches();
+}
+inline void StreamPartHandshakeRequest::set_acceptsstreammessagebatches(bool value) {
+  _internal_set_acceptsstreammessagebatches(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000020U);
+  // @@protoc_insertion_point(field_set:StreamPartHandshakeRequest.acceptsStreamMessageBatches)
+}
+inline bool StreamPartHandshakeRequest::_internal_acceptsstreammessagebatches() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.acceptsstreammessagebatches_;
+}
+inline void StreamPartHandshakeRequest::_internal_set_acceptsstreammessagebatches(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acceptsstreammessagebatches_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // StreamPartHandshakeResponse
@@ -7489,6 +7710,31 @@ inline void StreamPartHandshakeResponse::set_allocated_interleavetargetdescripto
   // @@protoc_insertion_point(field_set_allocated:StreamPartHandshakeResponse.interleaveTargetDescriptor)
 }
 
+// bool acceptsStreamMessageBatches = 1000;
+inline void StreamPartHandshakeResponse::clear_acceptsstreammessagebatches() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acceptsstreammessagebatches_ = false;
+  ClearHasBit(_impl_._has_bits_[0],
+                  0x00000008U);
+}
+inline bool StreamPartHandshakeResponse::acceptsstreammessagebatches() const {
+  // @@protoc_insertion_point(field_get:StreamPartHandshakeResponse.acceptsStreamMessageBatches)
+  return _internal_acceptsstreammessagebatches();
+}
+inline void StreamPartHandshakeResponse::set_acceptsstreammessagebatches(bool value) {
+  _internal_set_acceptsstreammessagebatches(value);
+  SetHasBit(_impl_._has_bits_[0], 0x00000008U);
+  // @@protoc_insertion_point(field_set:StreamPartHandshakeResponse.acceptsStreamMessageBatches)
+}
+inline bool StreamPartHandshakeResponse::_internal_acceptsstreammessagebatches() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.acceptsstreammessagebatches_;
+}
+inline void StreamPartHandshakeResponse::_internal_set_acceptsstreammessagebatches(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.acceptsstreammessagebatches_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // InterleaveRequest
@@ -8985,6 +9231,82 @@ inline void ResumeNeighborRequest::_internal_set_fromtimestamp(::int64_t value)
   _impl_.fromtimestamp_ = value;
 }
 
+// -------------------------------------------------------------------
+
+// StreamMessageBatch
+
+// repeated bytes messages = 1;
+inline int StreamMessageBatch::_internal_messages_size() const {
+  return _internal_messages().size();
+}
+inline int StreamMessageBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void StreamMessageBatch::clear_messages() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.messages_.Clear();
+  ClearHasBitForRepeated(_impl_._has_bits_[0],
+                  0x00000001U);
+}
+inline ::std::string* PROTOBUF_NONNULL StreamMessageBatch::add_messages()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::std::string* _s =
+      _internal_mutable_messages()->InternalAddWithArena(
+          ::google::protobuf::MessageLite::internal_visibility(), GetArena());
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add_mutable:StreamMessageBatch.messages)
+  return _s;
+}
+inline const ::std::string& StreamMessageBatch::messages(int index) const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:StreamMessageBatch.messages)
+  return _internal_messages().Get(index);
+}
+inline ::std::string* PROTOBUF_NONNULL StreamMessageBatch::mutable_messages(int index)
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable:StreamMessageBatch.messages)
+  return _internal_mutable_messages()->Mutable(index);
+}
+template <typename Arg_, typename... Args_>
+inline void StreamMessageBatch::set_messages(int index, Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::AssignToString(*_internal_mutable_messages()->Mutable(index), ::std::forward<Arg_>(value),
+                        args... , ::google::protobuf::internal::BytesTag{});
+  // @@protoc_insertion_point(field_set:StreamMessageBatch.messages)
+}
+template <typename Arg_, typename... Args_>
+inline void StreamMessageBatch::add_messages(Arg_&& value, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::google::protobuf::internal::AddToRepeatedPtrField(
+      ::google::protobuf::MessageLite::internal_visibility(), GetArena(),
+      *_internal_mutable_messages(), ::std::forward<Arg_>(value),
+      args... , ::google::protobuf::internal::BytesTag{});
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_add:StreamMessageBatch.messages)
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>& StreamMessageBatch::messages()
+    const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:StreamMessageBatch.messages)
+  return _internal_messages();
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+StreamMessageBatch::mutable_messages() ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  SetHasBitForRepeated(_impl_._has_bits_[0], 0x00000001U);
+  // @@protoc_insertion_point(field_mutable_list:StreamMessageBatch.messages)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_messages();
+}
+inline const ::google::protobuf::RepeatedPtrField<::std::string>&
+StreamMessageBatch::_internal_messages() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.messages_;
+}
+inline ::google::protobuf::RepeatedPtrField<::std::string>* PROTOBUF_NONNULL
+StreamMessageBatch::_internal_mutable_messages() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.messages_;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -0,0 +1,110 @@
+// Microbenchmark: DuplicateMessageDetector::markAndCheck replaying in-order,
+// reordered and lossy message sequences of one publisher chain. Lossy
+// replays keep the detector at maxGapCount, the worst case for the gap
+// structure. Not registered with ctest; run the binary directly (a
+// Release build gives meaningful numbers).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "BenchmarkReport.hpp"
+
+import streamr.trackerlessnetwork.DuplicateMessageDetector;
+
+using streamr::trackerlessnetwork::defaultMaxGapCount;
+using streamr::trackerlessnetwork::DuplicateMessageDetector;
+using streamr::trackerlessnetwork::NumberPair;
+using streamr::utils::benchmark::report;
+
+namespace {
+
+constexpr int64_t messageCount = 1000000;
+constexpr size_t reorderWindow = 16;
+constexpr uint32_t lossPercent = 10;
+constexpr uint32_t rngSeed = 42;
+
+struct Delivery {
+    std::optional<NumberPair> previous;
+    NumberPair number;
+};
+
+// Message i references i - 1, as a publisher's chain does. Each
+// delivery is duplicated once so half of the checks hit seen numbers.
+std::vector<Delivery> createSequence(bool reordered, bool lossy) {
+    std::mt19937 rng(rngSeed);
+    std::vector<Delivery> deliveries;
+    deliveries.reserve(2 * messageCount);
+    deliveries.push_back(Delivery{std::nullopt, NumberPair(0, 0)});
+    for (int64_t i = 1; i < messageCount; ++i) {
+        if (lossy && rng() % 100 < lossPercent) { // NOLINT
+            continue;
+        }
+        deliveries.push_back(Delivery{NumberPair(i - 1, 0), NumberPair(i, 0)});
+    }
+    if (reordered) {
+        for (auto it = deliveries.begin() + 1; it < deliveries.end();
+             it += reorderWindow) {
+            std::shuffle(
+                it,
+                std::min(it + reorderWindow, deliveries.end()),
+                rng);
+        }
+    }
+    const auto uniqueCount = deliveries.size();
+    for (size_t i = 0; i < uniqueCount; ++i) {
+        deliveries.push_back(deliveries[rng() % uniqueCount]);
+    }
+    std::shuffle(deliveries.begin() + uniqueCount, deliveries.end(), rng);
+    return deliveries;
+}
+
+void replay(const std::string& name, bool reordered, bool lossy) {
+    const auto deliveries = createSequence(reordered, lossy);
+    DuplicateMessageDetector detector(defaultMaxGapCount);
+    size_t unique = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& delivery : deliveries) {
+        try {
+            if (detector.markAndCheck(delivery.previous, delivery.number)) {
+                unique++;
+            }
+        } catch (const std::runtime_error&) {
+            // a reordered duplicate may overlap a gap; counted as seen
+        }
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    report(
+        name,
+        deliveries.size(),
+        "checks",
+        elapsed.count(),
+        std::to_string(unique) + " unique, memory " +
+            std::to_string(detector.getMemoryUsage()) + " bytes");
+    EXPECT_GT(unique, 0U);
+}
+
+} // namespace
+
+TEST(DuplicateMessageDetectorBenchmark, InOrder) {
+    replay("in-order", false, false);
+}
+
+TEST(DuplicateMessageDetectorBenchmark, Reordered) {
+    replay("reordered", true, false);
+}
+
+TEST(DuplicateMessageDetectorBenchmark, Lossy) {
+    replay("lossy", false, true);
+}
+
+TEST(DuplicateMessageDetectorBenchmark, LossyAndReordered) {
+    replay("lossy+reordered", true, true);
+}
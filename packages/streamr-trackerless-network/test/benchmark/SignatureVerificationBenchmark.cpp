@@ -0,0 +1,118 @@
+// Microbenchmark: StreamMessageVerificationStage throughput with distinct
+// signed messages (every check is a secp256k1 recovery, no cache hits)
+// and with each message arriving from four neighbors (the relay case the
+// cache targets). Not registered with ctest; run the binary directly (a
+// Release build gives meaningful numbers).
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <coroutine> // IWYU pragma: keep
+
+#include "BenchmarkReport.hpp"
+
+import streamr.dht.Identifiers;
+import streamr.trackerlessnetwork.protos;
+import streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
+import streamr.utils.BinaryUtils;
+import streamr.utils.CoroutineHelper;
+import streamr.utils.SigningUtils;
+import streamr.utils.waitForCondition;
+
+using streamr::dht::DhtAddress;
+using streamr::trackerlessnetwork::SignatureType;
+using streamr::trackerlessnetwork::StreamMessage;
+using streamr::trackerlessnetwork::StreamMessageSignatureVerifier;
+using streamr::trackerlessnetwork::StreamMessageVerificationStage;
+using streamr::trackerlessnetwork::StreamMessageVerificationStageOptions;
+using streamr::utils::BinaryUtils;
+using streamr::utils::blockingWait;
+using streamr::utils::benchmark::report;
+using streamr::utils::SigningUtils;
+using streamr::utils::waitForCondition;
+
+namespace {
+
+constexpr int64_t messageCount = 20000;
+constexpr auto timeout = std::chrono::minutes(5);
+
+const std::string privateKeyHex =
+    "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+const std::string publisherIdHex = "0xa5374e3c19f15e1847881979dd0c6c9ffe846bd5";
+
+std::vector<StreamMessage> createSignedMessages() {
+    std::vector<StreamMessage> messages;
+    messages.reserve(messageCount);
+    for (int64_t i = 0; i < messageCount; ++i) {
+        StreamMessage message;
+        auto* messageId = message.mutable_messageid();
+        messageId->set_streamid("stream");
+        messageId->set_timestamp(i);
+        messageId->set_publisherid(
+            BinaryUtils::hexToBinaryString(publisherIdHex));
+        messageId->set_messagechainid("1");
+        message.mutable_contentmessage()->set_content(
+            std::string(256, 'x')); // NOLINT
+        message.set_signaturetype(SignatureType::ECDSA_SECP256K1_EVM);
+        message.set_signature(SigningUtils::createSignature(
+            StreamMessageSignatureVerifier::createSignaturePayload(message)
+                .value(),
+            privateKeyHex));
+        messages.push_back(std::move(message));
+    }
+    return messages;
+}
+
+void run(const std::string& name, size_t copies) {
+    static const auto messages = createSignedMessages();
+    const auto verifier = std::make_shared<StreamMessageSignatureVerifier>();
+    std::atomic<size_t> delivered = 0;
+    const auto total = messages.size() * copies;
+    // Everything is submitted up front, so the stage must hold it all.
+    StreamMessageVerificationStage stage(StreamMessageVerificationStageOptions{
+        .verifier = verifier,
+        .onVerified =
+            [&delivered](const StreamMessage&, const DhtAddress&) {
+                delivered++;
+            },
+        .maxQueueDepth = total});
+    const DhtAddress sender{std::string("sender")};
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& message : messages) {
+        for (size_t copy = 0; copy < copies; ++copy) {
+            stage.submit(message, sender);
+        }
+    }
+    blockingWait(waitForCondition(
+        [&delivered, total]() { return delivered == total; },
+        std::chrono::duration_cast<std::chrono::milliseconds>(timeout)));
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    report(
+        name,
+        total,
+        "verifications",
+        elapsed.count(),
+        "on " + std::to_string(std::thread::hardware_concurrency()) +
+            " cores, " + std::to_string(verifier->getCacheHitCount()) +
+            " cache hits");
+    stage.stop();
+    EXPECT_EQ(verifier->getRejectedMessageCounts().size(), 0U);
+}
+
+} // namespace
+
+TEST(SignatureVerificationBenchmark, DistinctMessages) {
+    run("distinct", 1);
+}
+
+TEST(SignatureVerificationBenchmark, FourCopiesPerMessage) {
+    run("4 copies", 4); // NOLINT
+}
@@ -22,6 +22,7 @@ import streamr.protorpc.RpcCommunicator;
 import streamr.protorpc.protos;
 import streamr.trackerlessnetwork.ContentDeliveryRpcRemote;
 import streamr.trackerlessnetwork.NetworkRpcClient;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
 import streamr.trackerlessnetwork.TestUtils;
 import streamr.trackerlessnetwork.protos;
 import streamr.dht.DhtCallContext;
@@ -40,8 +41,8 @@ using streamr::utils::blockingWait;
 using streamr::utils::StreamPartIDUtils;
 using streamr::utils::toEthereumAddress;
 
-using ContentDeliveryRpcClient =
-    streamr::protorpc::ContentDeliveryRpcClient<DhtCallContext>;
+using streamr::trackerlessnetwork::ContentDeliveryRpcClient;
+using streamr::trackerlessnetwork::serializeStreamMessage;
 using RpcCommunicatorType = RpcCommunicator<DhtCallContext>;
 
 class ContentDeliveryRpcRemoteTest : public ::testing::Test {
@@ -51,14 +52,18 @@ protected:
     PeerDescriptor clientNode = createMockPeerDescriptor();
     PeerDescriptor serverNode = createMockPeerDescriptor();
     size_t recvCounter = 0;
+    std::optional<StreamMessage> lastReceived;
     std::optional<ContentDeliveryRpcRemote> rpcRemote;
 
     void SetUp() override {
         this->serverCommunicator.registerRpcNotification<StreamMessage>(
             "sendStreamMessage",
             [this](
-                const StreamMessage& /*message*/,
-                const DhtCallContext& /*context*/) { this->recvCounter++; });
+                const StreamMessage& message,
+                const DhtCallContext& /*context*/) {
+                this->recvCounter++;
+                this->lastReceived = message;
+            });
         this->serverCommunicator.registerRpcNotification<LeaveStreamPartNotice>(
             "leaveStreamPartNotice",
             [this](
@@ -101,3 +106,17 @@ TEST_F(ContentDeliveryRpcRemoteTest, LeaveNotice) {
         StreamPartIDUtils::parse("test#0"), false));
     EXPECT_EQ(this->recvCounter, 1);
 }
+
+TEST_F(ContentDeliveryRpcRemoteTest, SendSerializedStreamMessage) {
+    const auto msg = createStreamMessage(
+        R"({"hello":"WORLD"})",
+        StreamPartIDUtils::parse("test-stream#0"),
+        toEthereumAddress("0x1234567890123456789012345678901234567890"));
+    const auto serialized = serializeStreamMessage(msg);
+    blockingWait(this->rpcRemote->sendStreamMessage(serialized));
+    blockingWait(this->rpcRemote->sendStreamMessage(serialized));
+    EXPECT_EQ(this->recvCounter, 2);
+    ASSERT_TRUE(this->lastReceived.has_value());
+    EXPECT_EQ(
+        this->lastReceived->SerializeAsString(), msg.SerializeAsString());
+}
@@ -0,0 +1,99 @@
+// Native-only: DuplicateDetectorIndex keys detectors by raw publisher id
+// and interned chain id, evicts idle publishers and enforces its memory
+// budget least-recently-used first.
+#include <chrono>
+#include <optional>
+#include <string>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.trackerlessnetwork.DuplicateDetectorIndex;
+import streamr.trackerlessnetwork.DuplicateMessageDetector;
+
+using streamr::trackerlessnetwork::DuplicateDetectorIndex;
+using streamr::trackerlessnetwork::DuplicateDetectorIndexOptions;
+using streamr::trackerlessnetwork::NumberPair;
+
+namespace {
+
+std::string publisher(char fill) {
+    return std::string(20, fill);
+}
+
+} // namespace
+
+TEST(DuplicateDetectorIndexTest, DetectsDuplicatesPerPublisherChain) {
+    DuplicateDetectorIndex index;
+    EXPECT_TRUE(
+        index.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0}));
+    EXPECT_FALSE(
+        index.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0}));
+    EXPECT_TRUE(
+        index.markAndCheck(publisher('a'), "other", std::nullopt, {1, 0}));
+    EXPECT_TRUE(
+        index.markAndCheck(publisher('b'), "chain", std::nullopt, {1, 0}));
+    EXPECT_EQ(index.size(), 3U);
+}
+
+TEST(DuplicateDetectorIndexTest, TracksGapsWithPreviousNumbers) {
+    DuplicateDetectorIndex index;
+    const auto id = publisher('a');
+    EXPECT_TRUE(index.markAndCheck(id, "chain", std::nullopt, {1, 0}));
+    EXPECT_TRUE(index.markAndCheck(id, "chain", NumberPair(3, 0), {4, 0}));
+    EXPECT_TRUE(index.markAndCheck(id, "chain", NumberPair(1, 0), {2, 0}));
+    EXPECT_FALSE(index.markAndCheck(id, "chain", NumberPair(1, 0), {2, 0}));
+    EXPECT_TRUE(index.markAndCheck(id, "chain", NumberPair(2, 0), {3, 0}));
+}
+
+TEST(DuplicateDetectorIndexTest, EvictsIdlePublishers) {
+    DuplicateDetectorIndex index(
+        DuplicateDetectorIndexOptions{.maxIdleTime = std::chrono::seconds(10)});
+    const auto start = std::chrono::steady_clock::now();
+    index.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0}, start);
+    index.markAndCheck(
+        publisher('b'),
+        "chain",
+        std::nullopt,
+        {1, 0},
+        start + std::chrono::seconds(8));
+    index.evictIdle(start + std::chrono::seconds(15));
+    EXPECT_EQ(index.size(), 1U);
+    EXPECT_EQ(index.getEvictionCount(), 1U);
+    // The evicted chain starts over: the old number is accepted again.
+    EXPECT_TRUE(index.markAndCheck(
+        publisher('a'),
+        "chain",
+        std::nullopt,
+        {1, 0},
+        start + std::chrono::seconds(15)));
+}
+
+TEST(DuplicateDetectorIndexTest, EnforcesMemoryBudgetLeastRecentlyUsedFirst) {
+    DuplicateDetectorIndex probe;
+    probe.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0});
+    const auto perPublisher = probe.getMemoryUsage();
+
+    DuplicateDetectorIndex index(
+        DuplicateDetectorIndexOptions{.maxMemoryBytes = (3 * perPublisher)});
+    for (char fill = 'a'; fill <= 'j'; ++fill) {
+        index.markAndCheck(publisher(fill), "chain", std::nullopt, {1, 0});
+    }
+    EXPECT_LE(index.getMemoryUsage(), 3 * perPublisher);
+    EXPECT_GT(index.getEvictionCount(), 0U);
+    // The most recent publisher survives, the oldest one is gone.
+    EXPECT_FALSE(
+        index.markAndCheck(publisher('j'), "chain", std::nullopt, {1, 0}));
+    EXPECT_TRUE(
+        index.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0}));
+}
+
+TEST(DuplicateDetectorIndexTest, ClearReleasesEverything) {
+    DuplicateDetectorIndex index;
+    index.markAndCheck(publisher('a'), "chain", std::nullopt, {1, 0});
+    index.clear();
+    EXPECT_EQ(index.size(), 0U);
+    EXPECT_EQ(index.getMemoryUsage(), 0U);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -1,9 +1,108 @@
+#include <optional>
 #include <gtest/gtest.h>
 
+// NOLINTBEGIN(readability-magic-numbers)
+
 import streamr.trackerlessnetwork.DuplicateMessageDetector;
 
 using streamr::trackerlessnetwork::DuplicateMessageDetector; // NOLINT
+using streamr::trackerlessnetwork::GapMisMatchError;
+using streamr::trackerlessnetwork::InvalidNumberingError;
+using streamr::trackerlessnetwork::NumberPair;
+
+namespace {
+
+std::optional<NumberPair> prev(int64_t a) {
+    return NumberPair(a, 0);
+}
+
+NumberPair num(int64_t a) {
+    return {a, 0};
+}
+
+} // namespace
 
 TEST(DuplicateMessageDetectorTest, ItCanBeInstantiated) {
     // DuplicateMessageDetector duplicateMessageDetector;
 }
+
+TEST(DuplicateMessageDetectorTest, InOrderMessagesAreUniqueOnce) {
+    DuplicateMessageDetector detector;
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(1)));
+    for (int64_t i = 2; i <= 10; ++i) {
+        EXPECT_TRUE(detector.markAndCheck(prev(i - 1), num(i)));
+    }
+    for (int64_t i = 2; i <= 10; ++i) {
+        EXPECT_FALSE(detector.markAndCheck(prev(i - 1), num(i)));
+    }
+}
+
+TEST(DuplicateMessageDetectorTest, SkippedMessagesFillGapsOutOfOrder) {
+    DuplicateMessageDetector detector;
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(1)));
+    EXPECT_TRUE(detector.markAndCheck(prev(5), num(6)));
+    EXPECT_TRUE(detector.markAndCheck(prev(9), num(10)));
+    // fill (1, 5] and (6, 9] from both ends and the middle
+    EXPECT_TRUE(detector.markAndCheck(prev(3), num(4)));
+    EXPECT_TRUE(detector.markAndCheck(prev(1), num(2)));
+    EXPECT_TRUE(detector.markAndCheck(prev(4), num(5)));
+    EXPECT_TRUE(detector.markAndCheck(prev(2), num(3)));
+    EXPECT_TRUE(detector.markAndCheck(prev(8), num(9)));
+    EXPECT_TRUE(detector.markAndCheck(prev(6), num(8)));
+    for (int64_t i = 2; i <= 6; ++i) {
+        EXPECT_FALSE(detector.markAndCheck(prev(i - 1), num(i)));
+    }
+    EXPECT_FALSE(detector.markAndCheck(prev(6), num(8)));
+    EXPECT_TRUE(detector.markAndCheck(prev(10), num(11)));
+}
+
+TEST(DuplicateMessageDetectorTest, WithoutPreviousNumberOnlyLatestIsCompared) {
+    DuplicateMessageDetector detector;
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(5)));
+    EXPECT_FALSE(detector.markAndCheck(std::nullopt, num(5)));
+    EXPECT_FALSE(detector.markAndCheck(std::nullopt, num(3)));
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(7)));
+}
+
+TEST(DuplicateMessageDetectorTest, ThrowsIfPreviousNumberIsNotLower) {
+    DuplicateMessageDetector detector;
+    EXPECT_THROW(
+        detector.markAndCheck(prev(5), num(5)), InvalidNumberingError);
+    EXPECT_THROW(
+        detector.markAndCheck(prev(6), num(5)), InvalidNumberingError);
+}
+
+TEST(DuplicateMessageDetectorTest, ThrowsOnGapOverlap) {
+    DuplicateMessageDetector detector;
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(1)));
+    EXPECT_TRUE(detector.markAndCheck(prev(5), num(6)));
+    // (1, 5] is a gap; 3 -> 7 reaches over the seen number 6
+    EXPECT_THROW(detector.markAndCheck(prev(3), num(7)), GapMisMatchError);
+    // 0 is seen; 0 -> 2 reaches into the gap (1, 5]
+    EXPECT_THROW(detector.markAndCheck(prev(0), num(2)), GapMisMatchError);
+}
+
+TEST(DuplicateMessageDetectorTest, DropsLowestGapWhenOverMaxGapCount) {
+    DuplicateMessageDetector detector(2);
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(1)));
+    EXPECT_TRUE(detector.markAndCheck(prev(2), num(3)));
+    EXPECT_TRUE(detector.markAndCheck(prev(4), num(5)));
+    // gap (1, 2] was dropped: its message now counts as seen
+    EXPECT_FALSE(detector.markAndCheck(prev(1), num(2)));
+    EXPECT_TRUE(detector.markAndCheck(prev(3), num(4)));
+}
+
+TEST(DuplicateMessageDetectorTest, LossyPublisherDoesNotGrowAtMaxGapCount) {
+    DuplicateMessageDetector detector(4);
+    EXPECT_TRUE(detector.markAndCheck(std::nullopt, num(1)));
+    for (int64_t i = 2; i < 20; i += 2) {
+        EXPECT_TRUE(detector.markAndCheck(prev(i), num(i + 1)));
+    }
+    const auto usage = detector.getMemoryUsage();
+    for (int64_t i = 20; i < 1000; i += 2) {
+        EXPECT_TRUE(detector.markAndCheck(prev(i), num(i + 1)));
+    }
+    EXPECT_EQ(detector.getMemoryUsage(), usage);
+}
+
+// NOLINTEND(readability-magic-numbers)
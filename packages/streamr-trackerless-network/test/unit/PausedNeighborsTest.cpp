@@ -0,0 +1,49 @@
+// Ported from packages/trackerless-network/test/unit/
+// PausedNeighbors.test.ts (v103.8.0-rc.3): paused neighbors are tracked
+// per message chain and bounded by the limit.
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.trackerlessnetwork.PausedNeighbors;
+import streamr.dht.Identifiers;
+
+using streamr::dht::DhtAddress;
+using streamr::trackerlessnetwork::plumtree::PausedNeighbors;
+
+TEST(PausedNeighborsTest, TracksNeighborsPerMessageChain) {
+    PausedNeighbors paused(3);
+    EXPECT_TRUE(paused.add(DhtAddress{"node1"}, "chain1"));
+    EXPECT_TRUE(paused.add(DhtAddress{"node2"}, "chain1"));
+    EXPECT_TRUE(paused.add(DhtAddress{"node1"}, "chain2"));
+    EXPECT_TRUE(paused.isPaused(DhtAddress{"node1"}, "chain1"));
+    EXPECT_TRUE(paused.isPaused(DhtAddress{"node1"}, "chain2"));
+    EXPECT_FALSE(paused.isPaused(DhtAddress{"node2"}, "chain2"));
+    EXPECT_EQ(paused.size("chain1"), 2U);
+    paused.remove(DhtAddress{"node1"}, "chain1");
+    EXPECT_FALSE(paused.isPaused(DhtAddress{"node1"}, "chain1"));
+    EXPECT_EQ(paused.size("chain1"), 1U);
+}
+
+TEST(PausedNeighborsTest, RespectsLimit) {
+    PausedNeighbors paused(2);
+    EXPECT_TRUE(paused.add(DhtAddress{"node1"}, "chain"));
+    EXPECT_TRUE(paused.add(DhtAddress{"node2"}, "chain"));
+    EXPECT_FALSE(paused.add(DhtAddress{"node3"}, "chain"));
+    // re-adding an already paused neighbor is not over the limit
+    EXPECT_TRUE(paused.add(DhtAddress{"node2"}, "chain"));
+    EXPECT_EQ(paused.size("chain"), 2U);
+}
+
+TEST(PausedNeighborsTest, RemoveAllClearsEveryChain) {
+    PausedNeighbors paused(3);
+    paused.add(DhtAddress{"node1"}, "chain1");
+    paused.add(DhtAddress{"node1"}, "chain2");
+    paused.add(DhtAddress{"node2"}, "chain2");
+    paused.removeAll(DhtAddress{"node1"});
+    EXPECT_EQ(paused.size("chain1"), 0U);
+    EXPECT_EQ(paused.size("chain2"), 1U);
+    EXPECT_EQ(paused.getAll().size(), 1U);
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,244 @@
+// Native-only (no TS counterpart): Plumtree delivery versus plain
+// propagation over the same simulated stream-part overlay. One publisher
+// sends a chain of messages; the test measures the duplicate ratio
+// (duplicate deliveries per unique delivery) with plumtreeOptimization
+// off and on, and checks that Plumtree keeps every message delivered
+// while sending fewer duplicates.
+//
+// NB: NetworkRpc types are consumed ONLY through the
+// streamr.trackerlessnetwork.protos module (no textual NetworkRpc.pb.h
+// include) — see TestUtilsTest.cpp for the clangd rationale.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <coroutine> // IWYU pragma: keep
+
+import streamr.utils.CoroutineHelper;
+import streamr.trackerlessnetwork.ContentDeliveryLayerNode;
+import streamr.trackerlessnetwork.createContentDeliveryLayerNode;
+import streamr.trackerlessnetwork.DhtNodeDiscoveryLayer;
+import streamr.trackerlessnetwork.protos;
+import streamr.dht.DhtNode;
+import streamr.dht.Simulator;
+import streamr.dht.SimulatorTransport;
+import streamr.dht.protos;
+import streamr.dht.Identifiers;
+import streamr.utils.BinaryUtils;
+import streamr.utils.StreamPartID;
+import streamr.utils.waitForCondition;
+
+using ::dht::PeerDescriptor;
+using streamr::dht::DhtNode;
+using streamr::dht::DhtNodeOptions;
+using streamr::dht::Identifiers;
+using streamr::dht::ServiceID;
+using streamr::dht::connection::simulator::LatencyType;
+using streamr::dht::connection::simulator::Simulator;
+using streamr::dht::connection::simulator::SimulatorTransport;
+using streamr::trackerlessnetwork::ContentDeliveryLayerNode;
+using streamr::trackerlessnetwork::ContentDeliveryLayerNodeOptions;
+using streamr::trackerlessnetwork::createContentDeliveryLayerNode;
+using streamr::trackerlessnetwork::contentdeliverylayernodeevents::Message;
+using streamr::trackerlessnetwork::discoverylayer::DhtNodeDiscoveryLayer;
+using streamr::utils::BinaryUtils;
+using streamr::utils::blockingWait;
+using streamr::utils::StreamPartID;
+using streamr::utils::StreamPartIDUtils;
+using streamr::utils::waitForCondition;
+
+namespace {
+
+// Local copies of the TestUtils factories: importing the TestUtils module
+// on top of this TU's DhtNode + simulator + content-delivery composition
+// exhausts clang's per-TU source-location space.
+inline PeerDescriptor createMockPeerDescriptor() {
+    PeerDescriptor descriptor;
+    descriptor.set_nodeid(
+        Identifiers::getRawFromDhtAddress(
+            Identifiers::createRandomDhtAddress()));
+    descriptor.set_type(::dht::NodeType::NODEJS);
+    return descriptor;
+}
+
+// Message i of one publisher chain: timestamp i, previous ref i - 1.
+inline StreamMessage createChainedStreamMessage(
+    int64_t timestamp, const StreamPartID& streamPartId) {
+    StreamMessage msg;
+    auto* messageId = msg.mutable_messageid();
+    messageId->set_streamid(StreamPartIDUtils::getStreamID(streamPartId));
+    messageId->set_streampartition(
+        static_cast<int32_t>(
+            StreamPartIDUtils::getStreamPartition(streamPartId).value_or(0)));
+    messageId->set_sequencenumber(0);
+    messageId->set_timestamp(timestamp);
+    messageId->set_publisherid(
+        BinaryUtils::hexToBinaryString(
+            "0x1234567890123456789012345678901234567890"));
+    messageId->set_messagechainid("messageChain0");
+    msg.set_signaturetype(SignatureType::ECDSA_SECP256K1_EVM);
+    msg.set_signature(BinaryUtils::hexToBinaryString("0x1234"));
+    auto* contentMessage = msg.mutable_contentmessage();
+    contentMessage->set_encryptiontype(EncryptionType::NONE);
+    contentMessage->set_contenttype(ContentType::JSON);
+    contentMessage->set_content(R"({"hello":"WORLD"})");
+    if (timestamp > 1) {
+        msg.mutable_previousmessageref()->set_timestamp(timestamp - 1);
+        msg.mutable_previousmessageref()->set_sequencenumber(0);
+    }
+    return msg;
+}
+
+constexpr size_t nodeCount = 16;
+constexpr int64_t messageCount = 100;
+constexpr std::chrono::milliseconds publishInterval{20};
+constexpr std::chrono::seconds meshTimeout{60};
+constexpr std::chrono::seconds propagationTimeout{20};
+constexpr std::chrono::milliseconds pollInterval{200};
+// TS createMockContentDeliveryLayerNodeAndDhtNode DhtNode options.
+constexpr size_t tsNumberOfNodesPerKBucket = 4;
+constexpr size_t tsNeighborPingLimit = 16;
+constexpr std::chrono::milliseconds tsRpcRequestTimeout{5000};
+
+struct SimNode {
+    std::shared_ptr<SimulatorTransport> transport;
+    std::shared_ptr<DhtNodeDiscoveryLayer> discoveryLayerNode;
+    std::shared_ptr<ContentDeliveryLayerNode> contentDeliveryLayerNode;
+};
+
+SimNode createSimNode(
+    const PeerDescriptor& localPeerDescriptor,
+    const StreamPartID& streamPartId,
+    Simulator& simulator,
+    bool plumtreeOptimization) {
+    auto transport =
+        std::make_shared<SimulatorTransport>(localPeerDescriptor, simulator);
+    transport->start();
+    auto dhtNode = std::make_shared<DhtNode>(DhtNodeOptions{
+        .serviceId = ServiceID{streamPartId},
+        .numberOfNodesPerKBucket = tsNumberOfNodesPerKBucket,
+        .neighborPingLimit = tsNeighborPingLimit,
+        .rpcRequestTimeout = tsRpcRequestTimeout,
+        .transport = transport.get(),
+        .connectionsView = transport.get(),
+        .connectionLocker = transport.get(),
+        .peerDescriptor = localPeerDescriptor});
+    auto discoveryLayerNode = std::make_shared<DhtNodeDiscoveryLayer>(dhtNode);
+    auto contentDeliveryLayerNode = createContentDeliveryLayerNode(
+        ContentDeliveryLayerNodeOptions{
+            .streamPartId = streamPartId,
+            .discoveryLayerNode = discoveryLayerNode,
+            .transport = transport.get(),
+            .connectionLocker = transport.get(),
+            .localPeerDescriptor = localPeerDescriptor,
+            .isLocalNodeEntryPoint = []() { return false; },
+            .plumtreeOptimization = plumtreeOptimization});
+    return SimNode{
+        .transport = std::move(transport),
+        .discoveryLayerNode = std::move(discoveryLayerNode),
+        .contentDeliveryLayerNode = std::move(contentDeliveryLayerNode)};
+}
+
+struct DeliveryStats {
+    size_t received = 0;
+    uint64_t duplicates = 0;
+
+    [[nodiscard]] double duplicateRatio() const {
+        return static_cast<double>(this->duplicates) /
+            static_cast<double>(this->received);
+    }
+};
+
+// Builds the overlay, publishes messageCount chained messages from the
+// entry point and tears everything down again.
+DeliveryStats runOverlay(bool plumtreeOptimization) {
+    const auto streamPartId = StreamPartIDUtils::parse("testingtesting#0");
+    const auto entryPointDescriptor = createMockPeerDescriptor();
+    Simulator simulator{LatencyType::NONE};
+    std::vector<SimNode> nodes;
+    std::atomic<size_t> received = 0;
+
+    auto entryPoint = createSimNode(
+        entryPointDescriptor, streamPartId, simulator, plumtreeOptimization);
+    blockingWait(entryPoint.discoveryLayerNode->start());
+    blockingWait(entryPoint.discoveryLayerNode->joinDht({entryPointDescriptor}));
+    blockingWait(entryPoint.contentDeliveryLayerNode->start());
+    nodes.push_back(std::move(entryPoint));
+    std::vector<folly::coro::Task<void>> joins;
+    joins.reserve(nodeCount);
+    for (size_t i = 0; i < nodeCount; i++) {
+        auto node = createSimNode(
+            createMockPeerDescriptor(),
+            streamPartId,
+            simulator,
+            plumtreeOptimization);
+        blockingWait(node.discoveryLayerNode->start());
+        blockingWait(node.contentDeliveryLayerNode->start());
+        node.contentDeliveryLayerNode->on<Message>(
+            [&received](const StreamMessage& /*msg*/) { received++; });
+        joins.push_back(
+            node.discoveryLayerNode->joinDht({entryPointDescriptor}));
+        nodes.push_back(std::move(node));
+    }
+    blockingWait(folly::coro::collectAllRange(std::move(joins)));
+    blockingWait(waitForCondition(
+        [&nodes]() {
+            return std::ranges::all_of(nodes, [](const auto& node) {
+                return node.contentDeliveryLayerNode->getNeighbors().size() >=
+                    3;
+            });
+        },
+        meshTimeout,
+        pollInterval));
+
+    for (int64_t timestamp = 1; timestamp <= messageCount; timestamp++) {
+        nodes[0].contentDeliveryLayerNode->broadcast(
+            createChainedStreamMessage(timestamp, streamPartId));
+        std::this_thread::sleep_for(publishInterval);
+    }
+    const auto expected = nodeCount * static_cast<size_t>(messageCount);
+    blockingWait(waitForCondition(
+        [&received, expected]() { return received >= expected; },
+        propagationTimeout,
+        pollInterval));
+
+    DeliveryStats stats{.received = received};
+    for (const auto& node : nodes) {
+        stats.duplicates +=
+            node.contentDeliveryLayerNode->getDuplicateMessageCount();
+    }
+    for (auto& node : nodes) {
+        node.contentDeliveryLayerNode->stop();
+    }
+    for (auto& node : nodes) {
+        blockingWait(node.discoveryLayerNode->stop());
+    }
+    for (auto& node : nodes) {
+        node.transport->stop();
+    }
+    simulator.stop();
+    return stats;
+}
+
+} // namespace
+
+TEST(PlumtreePropagationTest, PlumtreeLowersDuplicateRatio) {
+    const auto baseline = runOverlay(false);
+    const auto plumtree = runOverlay(true);
+    std::cout << "[          ] duplicate ratio without plumtree: "
+              << baseline.duplicateRatio() << " (" << baseline.duplicates
+              << "/" << baseline.received << ")\n"
+              << "[          ] duplicate ratio with plumtree:    "
+              << plumtree.duplicateRatio() << " (" << plumtree.duplicates
+              << "/" << plumtree.received << ")\n";
+    EXPECT_EQ(
+        plumtree.received, nodeCount * static_cast<size_t>(messageCount));
+    EXPECT_LT(plumtree.duplicateRatio(), baseline.duplicateRatio());
+}
@@ -1,9 +1,111 @@
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
 #include <gtest/gtest.h>
 
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.trackerlessnetwork.protos;
 import streamr.trackerlessnetwork.PropagationTaskStore;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
 
+using streamr::trackerlessnetwork::serializeStreamMessage;
+using streamr::trackerlessnetwork::StreamMessage;
+using streamr::trackerlessnetwork::propagation::PropagationTask;
 using streamr::trackerlessnetwork::propagation::PropagationTaskStore; // NOLINT
 
+namespace {
+
+std::shared_ptr<PropagationTask> createTask(int64_t timestamp) {
+    StreamMessage message;
+    message.mutable_messageid()->set_timestamp(timestamp);
+    message.mutable_messageid()->set_sequencenumber(0);
+    return std::make_shared<PropagationTask>(PropagationTask{
+        .message = serializeStreamMessage(std::move(message)),
+        .source = std::nullopt,
+        .handledNeighbors = {}});
+}
+
+int64_t timestampOf(const std::shared_ptr<PropagationTask>& task) {
+    return task->message->getMessage().messageid().timestamp();
+}
+
+} // namespace
+
 TEST(PropagationTaskStoreTest, ItCanBeInstantiated) {
     // PropagationTaskStore store;
 }
+
+TEST(PropagationTaskStoreTest, DropsOldestTaskWhenFull) {
+    PropagationTaskStore store(std::chrono::seconds(10), 3);
+    for (int64_t i = 1; i <= 5; ++i) {
+        store.add(createTask(i));
+    }
+    const auto tasks = store.get();
+    ASSERT_EQ(tasks.size(), 3U);
+    EXPECT_EQ(timestampOf(tasks[0]), 3);
+    EXPECT_EQ(timestampOf(tasks[2]), 5);
+}
+
+TEST(PropagationTaskStoreTest, RemovedTasksDoNotCountTowardsCapacity) {
+    PropagationTaskStore store(std::chrono::seconds(10), 3);
+    store.add(createTask(1));
+    // Many add/remove rounds leave holes in the ring; the oldest task
+    // must survive as long as the store holds fewer than maxTasks.
+    for (int64_t i = 2; i < 100; ++i) {
+        const auto task = createTask(i);
+        store.add(task);
+        store.remove(task->message->getMessage().messageid());
+    }
+    store.add(createTask(100));
+    const auto tasks = store.get();
+    ASSERT_EQ(tasks.size(), 2U);
+    EXPECT_EQ(timestampOf(tasks[0]), 1);
+    EXPECT_EQ(timestampOf(tasks[1]), 100);
+}
+
+TEST(PropagationTaskStoreTest, AddingSameMessageReplacesTask) {
+    PropagationTaskStore store(std::chrono::seconds(10), 3);
+    store.add(createTask(1));
+    store.add(createTask(2));
+    const auto replacement = createTask(1);
+    store.add(replacement);
+    const auto tasks = store.get();
+    ASSERT_EQ(tasks.size(), 2U);
+    EXPECT_EQ(timestampOf(tasks[0]), 2);
+    EXPECT_EQ(tasks[1], replacement);
+}
+
+TEST(PropagationTaskStoreTest, ExpiresTasksAfterTtl) {
+    PropagationTaskStore store(std::chrono::seconds(10), 10);
+    const auto start = std::chrono::steady_clock::now();
+    store.add(createTask(1), start);
+    store.add(createTask(2), start + std::chrono::seconds(5));
+    EXPECT_EQ(store.get(start + std::chrono::seconds(9)).size(), 2U);
+    const auto tasks = store.get(start + std::chrono::seconds(12));
+    ASSERT_EQ(tasks.size(), 1U);
+    EXPECT_EQ(timestampOf(tasks[0]), 2);
+    EXPECT_TRUE(store.get(start + std::chrono::seconds(15)).empty());
+    EXPECT_EQ(store.size(), 0U);
+}
+
+TEST(PropagationTaskStoreTest, GetReturnsSharedTasks) {
+    PropagationTaskStore store(std::chrono::seconds(10), 3);
+    const auto task = createTask(1);
+    store.add(task);
+    store.get()[0]->handledNeighbors.insert("neighbor");
+    EXPECT_EQ(task->handledNeighbors, std::set<std::string>{"neighbor"});
+    EXPECT_EQ(store.get()[0]->message, task->message);
+}
+
+TEST(PropagationTaskStoreTest, ZeroCapacityStoresNothing) {
+    PropagationTaskStore store(std::chrono::seconds(10), 0);
+    store.add(createTask(1));
+    EXPECT_TRUE(store.get().empty());
+}
+
+// NOLINTEND(readability-magic-numbers)
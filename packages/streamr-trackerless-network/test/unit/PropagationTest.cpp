@@ -1,9 +1,277 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
+#include <coroutine> // IWYU pragma: keep
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.utils.CoroutineHelper;
+import streamr.trackerlessnetwork.protos;
+import streamr.dht.Identifiers;
 import streamr.trackerlessnetwork.Propagation;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.utils.waitForCondition;
 
+using streamr::dht::DhtAddress;
+using streamr::trackerlessnetwork::serializeStreamMessage;
+using streamr::trackerlessnetwork::SharedStreamMessage;
+using streamr::trackerlessnetwork::StreamMessage;
 using streamr::trackerlessnetwork::propagation::Propagation; // NOLINT
+using streamr::trackerlessnetwork::propagation::PropagationBatchingOptions;
+using streamr::trackerlessnetwork::propagation::PropagationOptions;
+using streamr::trackerlessnetwork::propagation::SendQueueOverflowPolicy;
+using streamr::utils::blockingWait;
+using streamr::utils::waitForCondition;
+
+namespace {
+
+const DhtAddress slowNeighbor{std::string("slow")};
+const DhtAddress fastNeighbor{std::string("fast")};
+
+StreamMessage createMessage(int64_t timestamp) {
+    StreamMessage message;
+    message.mutable_messageid()->set_timestamp(timestamp);
+    return message;
+}
+
+// Sends to "slow" stall until `released` is set.
+class SlowNeighborTest : public ::testing::Test {
+protected:
+    std::atomic<bool> released = false;
+    std::atomic<size_t> slowSends = 0;
+    std::atomic<size_t> fastSends = 0;
+    std::atomic<size_t> slowSendsInFlight = 0;
+    std::atomic<size_t> maxSlowSendsInFlight = 0;
+    std::vector<int64_t> slowTimestamps;
+    std::mutex slowTimestampsMutex;
+
+    std::optional<Propagation> propagation;
+
+    void createPropagation(SendQueueOverflowPolicy policy) {
+        this->propagation.emplace(PropagationOptions{
+            .sendToNeighbor =
+                [this](
+                    const DhtAddress& neighborId,
+                    const SharedStreamMessage& msg) -> folly::coro::Task<void> {
+                if (neighborId == fastNeighbor) {
+                    this->fastSends++;
+                    co_return;
+                }
+                const auto inFlight = ++this->slowSendsInFlight;
+                this->maxSlowSendsInFlight =
+                    std::max(this->maxSlowSendsInFlight.load(), inFlight);
+                while (!this->released) {
+                    co_await folly::coro::sleep(std::chrono::milliseconds(5));
+                }
+                this->slowSendsInFlight--;
+                {
+                    std::scoped_lock lock(this->slowTimestampsMutex);
+                    this->slowTimestamps.push_back(
+                        msg->getMessage().messageid().timestamp());
+                }
+                this->slowSends++;
+            },
+            .minPropagationTargets = 2,
+            .sendQueueHighWaterMark = 4,
+            .sendQueueOverflowPolicy = policy});
+    }
+
+    void feed(int64_t count, int64_t first = 1) {
+        for (int64_t i = first; i < first + count; ++i) {
+            this->propagation->feedUnseenMessage(
+                createMessage(i), {slowNeighbor, fastNeighbor}, std::nullopt);
+        }
+    }
+
+    void TearDown() override {
+        this->released = true;
+        this->propagation.reset();
+    }
+};
+
+} // namespace
 
 TEST(PropagationTest, ItCanBeInstantiated) {
     // Propagation propagation;
 }
+
+TEST_F(SlowNeighborTest, SlowNeighborQueueIsBounded) {
+    this->createPropagation(SendQueueOverflowPolicy::DropOldest);
+    this->feed(20);
+    blockingWait(waitForCondition([this]() { return this->fastSends == 20; }));
+    // 20 sends: four queued, the rest dropped — except the one in flight
+    // if the drain took it before the queue filled up.
+    EXPECT_GE(this->propagation->getSendQueueDepth(slowNeighbor), 3U);
+    EXPECT_LE(this->propagation->getSendQueueDepth(slowNeighbor), 4U);
+    EXPECT_EQ(this->propagation->getSendQueueDepth(fastNeighbor), 0U);
+    const auto dropped = this->propagation->getDroppedSendCount();
+    EXPECT_GE(dropped, 15U);
+    EXPECT_LE(dropped, 16U);
+
+    this->released = true;
+    blockingWait(waitForCondition(
+        [this, dropped]() { return this->slowSends == 20 - dropped; }));
+    EXPECT_EQ(this->propagation->getSendQueueDepth(), 0U);
+    // Sends stay in order and the newest messages survive.
+    std::scoped_lock lock(this->slowTimestampsMutex);
+    EXPECT_TRUE(std::ranges::is_sorted(this->slowTimestamps));
+    EXPECT_EQ(this->slowTimestamps.back(), 20);
+}
+
+TEST_F(SlowNeighborTest, DropNewestKeepsQueuedSends) {
+    this->createPropagation(SendQueueOverflowPolicy::DropNewest);
+    this->feed(20);
+    blockingWait(waitForCondition([this]() { return this->fastSends == 20; }));
+    this->released = true;
+    const auto dropped = this->propagation->getDroppedSendCount();
+    blockingWait(waitForCondition(
+        [this, dropped]() { return this->slowSends == 20 - dropped; }));
+    std::scoped_lock lock(this->slowTimestampsMutex);
+    EXPECT_EQ(this->slowTimestamps.front(), 1);
+    EXPECT_LE(this->slowTimestamps.back(), 5);
+}
+
+TEST_F(SlowNeighborTest, LeavingNeighborDiscardsItsQueue) {
+    this->createPropagation(SendQueueOverflowPolicy::DropOldest);
+    this->feed(10);
+    blockingWait(waitForCondition([this]() { return this->fastSends == 10; }));
+    EXPECT_GT(this->propagation->getSendQueueDepth(slowNeighbor), 0U);
+    this->propagation->onNeighborLeft(slowNeighbor);
+    EXPECT_EQ(this->propagation->getSendQueueDepth(slowNeighbor), 0U);
+    EXPECT_EQ(this->propagation->getSendQueueDepth(), 0U);
+}
+
+TEST_F(SlowNeighborTest, RejoiningNeighborKeepsOneDrain) {
+    this->createPropagation(SendQueueOverflowPolicy::DropOldest);
+    this->feed(3);
+    blockingWait(waitForCondition([this]() {
+        return this->fastSends == 3 && this->slowSendsInFlight == 1;
+    }));
+    this->propagation->onNeighborLeft(slowNeighbor);
+    // Sends after the neighbor is back queue behind the one in flight.
+    this->feed(3, 4);
+    this->released = true;
+    blockingWait(waitForCondition([this]() { return this->slowSends == 4; }));
+    EXPECT_EQ(this->maxSlowSendsInFlight, 1U);
+    std::scoped_lock lock(this->slowTimestampsMutex);
+    EXPECT_EQ(this->slowTimestamps, (std::vector<int64_t>{1, 4, 5, 6}));
+}
+
+TEST_F(SlowNeighborTest, MessagesFedToOneNeighborQueueBehindItsSends) {
+    this->createPropagation(SendQueueOverflowPolicy::DropOldest);
+    this->feed(2);
+    blockingWait(waitForCondition([this]() {
+        return this->fastSends == 2 && this->slowSendsInFlight == 1;
+    }));
+    this->propagation->feedMessagesToNeighbor(
+        slowNeighbor,
+        {serializeStreamMessage(createMessage(10)),
+         serializeStreamMessage(createMessage(11))});
+    EXPECT_EQ(this->propagation->getSendQueueDepth(slowNeighbor), 3U);
+    EXPECT_EQ(this->fastSends, 2U);
+    this->released = true;
+    blockingWait(waitForCondition([this]() { return this->slowSends == 4; }));
+    std::scoped_lock lock(this->slowTimestampsMutex);
+    EXPECT_EQ(this->slowTimestamps, (std::vector<int64_t>{1, 2, 10, 11}));
+}
+
+TEST(PropagationTest, BatchesSendsToNeighborsThatAcceptBatches) {
+    std::atomic<size_t> singleSends = 0;
+    std::atomic<size_t> slowSingleSends = 0;
+    std::vector<size_t> batchSizes;
+    std::mutex batchSizesMutex;
+    Propagation propagation(PropagationOptions{
+        .sendToNeighbor =
+            [&singleSends, &slowSingleSends](
+                const DhtAddress& neighborId,
+                const SharedStreamMessage& /* msg */)
+            -> folly::coro::Task<void> {
+            if (neighborId == slowNeighbor) {
+                slowSingleSends++;
+            } else {
+                singleSends++;
+            }
+            co_return;
+        },
+        .minPropagationTargets = 2,
+        .batching = PropagationBatchingOptions{
+            .sendBatchToNeighbor =
+                [&batchSizes, &batchSizesMutex](
+                    const DhtAddress& neighborId,
+                    std::vector<SharedStreamMessage> messages)
+                -> folly::coro::Task<void> {
+                EXPECT_EQ(neighborId, slowNeighbor);
+                std::scoped_lock lock(batchSizesMutex);
+                batchSizes.push_back(messages.size());
+                co_return;
+            },
+            .acceptsBatches =
+                [](const DhtAddress& neighborId) {
+                    return neighborId == slowNeighbor;
+                },
+            .maxBatchMessages = 4,
+            .window = std::chrono::milliseconds(200)}});
+    for (int64_t i = 1; i <= 10; ++i) {
+        propagation.feedUnseenMessage(
+            createMessage(i), {slowNeighbor, fastNeighbor}, std::nullopt);
+    }
+    const auto batchedCount = [&batchSizes, &batchSizesMutex]() {
+        std::scoped_lock lock(batchSizesMutex);
+        size_t count = 0;
+        for (const auto size : batchSizes) {
+            count += size;
+        }
+        return count;
+    };
+    blockingWait(
+        waitForCondition([&singleSends, &slowSingleSends, &batchedCount]() {
+            return singleSends == 10 &&
+                slowSingleSends + batchedCount() == 10;
+        }));
+    // All ten are queued well within one window, so the drain sends
+    // (about) full batches of four instead of ten single sends. If the
+    // drain starts before the rest are queued, the first message goes
+    // alone, and so may a lone last one.
+    std::scoped_lock lock(batchSizesMutex);
+    EXPECT_LE(slowSingleSends, 2U);
+    EXPECT_LE(batchSizes.size() + slowSingleSends, 5U);
+    EXPECT_LE(std::ranges::max(batchSizes), 4U);
+}
+
+TEST(PropagationTest, LoneMessageToBatchingNeighborIsSentAtOnce) {
+    std::atomic<size_t> sends = 0;
+    Propagation propagation(PropagationOptions{
+        .sendToNeighbor =
+            [&sends](
+                const DhtAddress& /* neighborId */,
+                const SharedStreamMessage& /* msg */)
+            -> folly::coro::Task<void> {
+            sends++;
+            co_return;
+        },
+        .minPropagationTargets = 1,
+        .batching = PropagationBatchingOptions{
+            .sendBatchToNeighbor =
+                [](const DhtAddress& /* neighborId */,
+                   std::vector<SharedStreamMessage> /* messages */)
+                -> folly::coro::Task<void> { co_return; },
+            .acceptsBatches = [](const DhtAddress& /* neighborId */) {
+                return true;
+            },
+            .window = std::chrono::seconds(60)}});
+    propagation.feedUnseenMessage(
+        createMessage(1), {slowNeighbor}, std::nullopt);
+    // Well below the window: nothing else is queued to wait for.
+    blockingWait(waitForCondition(
+        [&sends]() { return sends == 1; }, std::chrono::seconds(5)));
+}
+
+// NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.trackerlessnetwork.protos;
+import streamr.trackerlessnetwork.SerializedStreamMessage;
+import streamr.trackerlessnetwork.StreamMessageBatch;
+
+using streamr::trackerlessnetwork::MalformedStreamMessageBatch;
+using streamr::trackerlessnetwork::packStreamMessageBatch;
+using streamr::trackerlessnetwork::serializeStreamMessage;
+using streamr::trackerlessnetwork::SharedStreamMessage;
+using streamr::trackerlessnetwork::StreamMessage;
+using streamr::trackerlessnetwork::StreamMessageBatch;
+using streamr::trackerlessnetwork::StreamPartHandshakeRequest;
+using streamr::trackerlessnetwork::unpackStreamMessageBatch;
+
+namespace {
+
+SharedStreamMessage createMessage(int64_t timestamp) {
+    StreamMessage message;
+    message.mutable_messageid()->set_timestamp(timestamp);
+    message.mutable_messageid()->set_streamid("stream");
+    return serializeStreamMessage(std::move(message));
+}
+
+} // namespace
+
+TEST(StreamMessageBatchTest, PackedBatchUnpacksInOrder) {
+    const std::vector<SharedStreamMessage> messages{
+        createMessage(1), createMessage(2), createMessage(3)};
+    StreamMessageBatch received;
+    ASSERT_TRUE(received.ParseFromString(
+        packStreamMessageBatch(messages).SerializeAsString()));
+    const auto unpacked = unpackStreamMessageBatch(received);
+    ASSERT_EQ(unpacked.size(), 3U);
+    for (size_t i = 0; i < unpacked.size(); ++i) {
+        EXPECT_EQ(
+            unpacked[i].SerializeAsString(),
+            messages[i]->getMessage().SerializeAsString());
+    }
+}
+
+TEST(StreamMessageBatchTest, EmptyBatchUnpacksToNothing) {
+    const auto batch = packStreamMessageBatch({});
+    EXPECT_TRUE(unpackStreamMessageBatch(batch).empty());
+}
+
+TEST(StreamMessageBatchTest, MalformedEntryThrows) {
+    const std::vector<SharedStreamMessage> messages{
+        createMessage(1), createMessage(2)};
+    auto batch = packStreamMessageBatch(messages);
+    batch.mutable_messages(1)->pop_back();
+    EXPECT_THROW(unpackStreamMessageBatch(batch), MalformedStreamMessageBatch);
+}
+
+TEST(StreamMessageBatchTest, CapabilityFlagSurvivesSerialization) {
+    StreamPartHandshakeRequest request;
+    request.set_streampartid("stream#0");
+    const auto withoutFlag = request.SerializeAsString();
+    request.set_acceptsstreammessagebatches(true);
+    StreamPartHandshakeRequest received;
+    ASSERT_TRUE(received.ParseFromString(request.SerializeAsString()));
+    EXPECT_TRUE(received.acceptsstreammessagebatches());
+    EXPECT_EQ(received.streampartid(), "stream#0");
+
+    // An unset flag adds nothing to the wire, so TS peers see the
+    // request they always did.
+    request.set_acceptsstreammessagebatches(false);
+    EXPECT_EQ(request.SerializeAsString(), withoutFlag);
+}
+
+// NOLINTEND(readability-magic-numbers)
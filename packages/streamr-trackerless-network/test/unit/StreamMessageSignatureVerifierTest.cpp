@@ -0,0 +1,212 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <coroutine> // IWYU pragma: keep
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+import streamr.dht.Identifiers;
+import streamr.trackerlessnetwork.protos;
+import streamr.trackerlessnetwork.StreamMessageSignatureVerifier;
+import streamr.utils.BinaryUtils;
+import streamr.utils.CoroutineHelper;
+import streamr.utils.SigningUtils;
+import streamr.utils.waitForCondition;
+
+using streamr::dht::DhtAddress;
+using streamr::trackerlessnetwork::SignatureType;
+using streamr::trackerlessnetwork::SignatureVerificationResult;
+using streamr::trackerlessnetwork::StreamMessage;
+using streamr::trackerlessnetwork::StreamMessageSignatureVerifier;
+using streamr::trackerlessnetwork::StreamMessageSignatureVerifierOptions;
+using streamr::trackerlessnetwork::StreamMessageVerificationStage;
+using streamr::trackerlessnetwork::StreamMessageVerificationStageOptions;
+using streamr::utils::BinaryUtils;
+using streamr::utils::blockingWait;
+using streamr::utils::SigningUtils;
+using streamr::utils::waitForCondition;
+
+namespace {
+
+const std::string privateKeyHex =
+    "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+// The address of privateKeyHex.
+const std::string publisherIdHex = "0xa5374e3c19f15e1847881979dd0c6c9ffe846bd5";
+
+StreamMessage createSignedMessage(int64_t timestamp) {
+    StreamMessage message;
+    auto* messageId = message.mutable_messageid();
+    messageId->set_streamid("stream");
+    messageId->set_streampartition(0);
+    messageId->set_timestamp(timestamp);
+    messageId->set_sequencenumber(0);
+    messageId->set_publisherid(BinaryUtils::hexToBinaryString(publisherIdHex));
+    messageId->set_messagechainid("1");
+    message.mutable_contentmessage()->set_content("hello");
+    message.set_signaturetype(SignatureType::ECDSA_SECP256K1_EVM);
+    message.set_signature(SigningUtils::createSignature(
+        StreamMessageSignatureVerifier::createSignaturePayload(message)
+            .value(),
+        privateKeyHex));
+    return message;
+}
+
+} // namespace
+
+TEST(StreamMessageSignatureVerifierTest, AcceptsValidSignature) {
+    StreamMessageSignatureVerifier verifier;
+    const auto message = createSignedMessage(1);
+    EXPECT_EQ(verifier.verify(message), SignatureVerificationResult::Valid);
+    // The copy from a second neighbor is answered from the cache.
+    EXPECT_EQ(verifier.verify(message), SignatureVerificationResult::Valid);
+    EXPECT_EQ(verifier.getVerifiedCount(), 2U);
+    EXPECT_EQ(verifier.getCacheHitCount(), 1U);
+    EXPECT_TRUE(verifier.getRejectedMessageCounts().empty());
+}
+
+TEST(StreamMessageSignatureVerifierTest, RejectsForgedMessages) {
+    StreamMessageSignatureVerifier verifier;
+    auto tampered = createSignedMessage(1);
+    tampered.mutable_contentmessage()->set_content("HELLO");
+    EXPECT_EQ(verifier.verify(tampered), SignatureVerificationResult::Invalid);
+
+    auto previousRefAdded = createSignedMessage(2);
+    previousRefAdded.mutable_previousmessageref()->set_timestamp(1);
+    EXPECT_EQ(
+        verifier.verify(previousRefAdded),
+        SignatureVerificationResult::Invalid);
+
+    auto unsigned_ = createSignedMessage(3);
+    unsigned_.clear_signature();
+    EXPECT_EQ(verifier.verify(unsigned_), SignatureVerificationResult::Invalid);
+
+    EXPECT_FALSE(verifier.accepts(SignatureVerificationResult::Invalid));
+    EXPECT_EQ(verifier.getRejectedMessageCount(publisherIdHex), 3U);
+}
+
+TEST(StreamMessageSignatureVerifierTest, PassesUnverifiableByDefault) {
+    auto legacy = createSignedMessage(1);
+    legacy.set_signaturetype(SignatureType::ECDSA_SECP256K1_LEGACY);
+
+    StreamMessageSignatureVerifier lenient;
+    const auto result = lenient.verify(legacy);
+    EXPECT_EQ(result, SignatureVerificationResult::Unverifiable);
+    EXPECT_TRUE(lenient.accepts(result));
+
+    StreamMessageSignatureVerifier strict(
+        StreamMessageSignatureVerifierOptions{.rejectUnverifiable = true});
+    EXPECT_FALSE(strict.accepts(strict.verify(legacy)));
+    EXPECT_EQ(strict.getRejectedMessageCount(publisherIdHex), 1U);
+}
+
+TEST(StreamMessageSignatureVerifierTest, StageDeliversOnlyValidMessages) {
+    const auto verifier = std::make_shared<StreamMessageSignatureVerifier>();
+    const DhtAddress sender{std::string("sender")};
+    std::atomic<size_t> delivered = 0;
+    StreamMessageVerificationStage stage(StreamMessageVerificationStageOptions{
+        .verifier = verifier,
+        .onVerified =
+            [&delivered, &sender](
+                const StreamMessage& message, const DhtAddress& from) {
+                EXPECT_EQ(from, sender);
+                EXPECT_EQ(message.contentmessage().content(), "hello");
+                delivered++;
+            },
+        .maxBatchSize = 4,
+        .maxParallelBatches = 3});
+    for (int64_t i = 1; i <= 50; ++i) {
+        auto message = createSignedMessage(i);
+        if (i % 5 == 0) {
+            message.mutable_contentmessage()->set_content("forged");
+        }
+        stage.submit(std::move(message), sender);
+    }
+    blockingWait(waitForCondition([&verifier]() {
+        return verifier->getVerifiedCount() == 50;
+    }));
+    blockingWait(waitForCondition([&delivered]() { return delivered == 40; }));
+    EXPECT_EQ(verifier->getRejectedMessageCount(publisherIdHex), 10U);
+    EXPECT_EQ(stage.getQueueDepth(), 0U);
+    stage.stop();
+}
+
+TEST(StreamMessageSignatureVerifierTest, StageDeliversInSubmissionOrder) {
+    const auto verifier = std::make_shared<StreamMessageSignatureVerifier>();
+    std::mutex mutex;
+    std::vector<int64_t> timestamps;
+    StreamMessageVerificationStage stage(StreamMessageVerificationStageOptions{
+        .verifier = verifier,
+        .onVerified =
+            [&mutex, &timestamps](const StreamMessage& message,
+                                  const DhtAddress& /* from */) {
+                std::scoped_lock lock(mutex);
+                timestamps.push_back(message.messageid().timestamp());
+            },
+        .maxBatchSize = 1,
+        .maxParallelBatches = 8});
+    std::vector<int64_t> expected;
+    for (int64_t i = 1; i <= 200; ++i) {
+        auto message = createSignedMessage(i);
+        if (i % 7 == 0) {
+            message.mutable_contentmessage()->set_content("forged");
+        } else {
+            expected.push_back(i);
+        }
+        stage.submit(std::move(message), DhtAddress{std::string("sender")});
+    }
+    blockingWait(waitForCondition([&mutex, &timestamps, &expected]() {
+        std::scoped_lock lock(mutex);
+        return timestamps.size() == expected.size();
+    }));
+    stage.stop();
+    EXPECT_EQ(timestamps, expected);
+}
+
+TEST(StreamMessageSignatureVerifierTest, FullStageDropsSubmits) {
+    const auto verifier = std::make_shared<StreamMessageSignatureVerifier>();
+    std::atomic<bool> delivering = false;
+    std::atomic<bool> released = false;
+    std::atomic<size_t> delivered = 0;
+    StreamMessageVerificationStage stage(StreamMessageVerificationStageOptions{
+        .verifier = verifier,
+        .onVerified =
+            [&delivering, &released, &delivered](
+                const StreamMessage& /* message */,
+                const DhtAddress& /* from */) {
+                // The first delivery holds up every later one.
+                delivering = true;
+                while (!released) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                delivered++;
+            },
+        .maxBatchSize = 4,
+        .maxParallelBatches = 2,
+        .maxQueueDepth = 4});
+    const DhtAddress sender{std::string("sender")};
+    EXPECT_TRUE(stage.submit(createSignedMessage(1), sender));
+    blockingWait(waitForCondition([&delivering]() { return delivering.load(); }));
+    // Message 1 is being delivered; four more fit behind it.
+    size_t accepted = 0;
+    for (int64_t i = 2; i <= 11; ++i) {
+        accepted += stage.submit(createSignedMessage(i), sender) ? 1 : 0;
+    }
+    EXPECT_EQ(accepted, 4U);
+    EXPECT_EQ(stage.getDroppedMessageCount(), 6U);
+    released = true;
+    blockingWait(waitForCondition([&delivered]() { return delivered == 5; }));
+    EXPECT_TRUE(stage.submit(createSignedMessage(12), sender));
+    blockingWait(waitForCondition([&delivered]() { return delivered == 6; }));
+    stage.stop();
+}
+
+// NOLINTEND(readability-magic-numbers)
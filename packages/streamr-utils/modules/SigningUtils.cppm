@@ -2,11 +2,23 @@
 // CONSOLIDATED from the former header
 // streamr-utils/SigningUtils.hpp (MODERNIZATION.md Phase 2.6):
 // this file is now the source of truth.
+//
+// Signing reuses per-thread randomized secp256k1 contexts and a Signer
+// holds its parsed private key, so signing a message costs one hash and
+// one ECDSA operation. hashParts() hashes a payload given as several
+// pieces without concatenating them first.
 module;
 
 #include <secp256k1.h>
 #include <secp256k1_ecdh.h>
 #include <secp256k1_recovery.h>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <cryptopp/asn.h>
@@ -14,6 +26,7 @@ module;
 #include <cryptopp/eccrypto.h>
 #include <cryptopp/hex.h>
 #include <cryptopp/keccak.h>
+#include <cryptopp/misc.h>
 #include <cryptopp/oids.h>
 #include <cryptopp/osrng.h>
 #include <cryptopp/sha.h>
@@ -27,52 +40,250 @@ export namespace streamr::utils {
 using streamr::utils::BinaryUtils;
 
 class SigningUtils {
+public:
+    static constexpr size_t SIGNATURE_LENGTH = 65;
+    static constexpr size_t HASH_LENGTH = 32;
+    static constexpr size_t ADDRESS_LENGTH = 20;
+
 private:
     // NOLINTNEXTLINE
     static constexpr std::string_view SIGN_MAGIC =
         "\u0019Ethereum Signed Message:\n";
 
+    // Verification and recovery only read the context, so one context is
+    // shared by every thread (creating one per call costs more than the
+    // recovery itself).
+    static const secp256k1_context* verifyContext() {
+        // magic static
+        static const secp256k1_context* context =
+            secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
+        return context;
+    }
+
 public:
+    // Signs with a one-off Signer; keep a Signer to sign repeatedly with
+    // the same key.
     static std::string createSignature(
         const std::string& payloadBinaryString, // NOLINT
-        const std::string& privateKeyHex) {
-        std::string hash = SigningUtils::hash(payloadBinaryString);
-        std::string privateKey = BinaryUtils::hexToBinaryString(privateKeyHex);
+        const std::string& privateKeyHex);
 
-        secp256k1_context* secpContext =
-            secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
-        secp256k1_ecdsa_recoverable_signature secpSignature;
+    // The 20-byte EVM address whose key produced `signature` (r || s || v,
+    // v either 27/28 or 0/1) over payloadBinaryString, or nullopt if the
+    // signature is malformed or does not recover to a key.
+    static std::optional<std::string> recoverAddress(
+        const std::string& payloadBinaryString, // NOLINT
+        const std::string& signature) {
+        return SigningUtils::recoverAddressFromHash(
+            SigningUtils::hash(payloadBinaryString), signature);
+    }
 
-        int r = secp256k1_ecdsa_sign_recoverable(
-            secpContext,
-            &secpSignature,
-            reinterpret_cast<unsigned char*>(hash.data()),
-            reinterpret_cast<unsigned char*>(privateKey.data()),
-            nullptr,
-            nullptr);
-        int recid;
-        uint8_t signatureData[65]; // NOLINT
-
-        r = secp256k1_ecdsa_recoverable_signature_serialize_compact(
-            secpContext, signatureData, &recid, &secpSignature);
-        signatureData[64] = static_cast<uint8_t>(27 + recid); // NOLINT
-
-        secp256k1_context_destroy(secpContext);
+    // As recoverAddress, for a payload already hashed with hash().
+    static std::optional<std::string> recoverAddressFromHash(
+        std::string_view hash, std::string_view signature) {
+        if (hash.size() != HASH_LENGTH ||
+            signature.size() != SIGNATURE_LENGTH) {
+            return std::nullopt;
+        }
+        const auto* signatureData =
+            reinterpret_cast<const unsigned char*>(signature.data());
+        int recid = signatureData[SIGNATURE_LENGTH - 1];
+        if (recid >= 27) { // NOLINT
+            recid -= 27; // NOLINT
+        }
+        if (recid < 0 || recid > 3) {
+            return std::nullopt;
+        }
+        const auto* context = SigningUtils::verifyContext();
+        secp256k1_ecdsa_recoverable_signature secpSignature;
+        secp256k1_pubkey publicKey;
+        if (!secp256k1_ecdsa_recoverable_signature_parse_compact(
+                context, &secpSignature, signatureData, recid) ||
+            !secp256k1_ecdsa_recover(
+                context,
+                &publicKey,
+                &secpSignature,
+                reinterpret_cast<const unsigned char*>(hash.data()))) {
+            return std::nullopt;
+        }
+        std::array<unsigned char, 65> serialized{}; // NOLINT
+        size_t serializedLength = serialized.size();
+        secp256k1_ec_pubkey_serialize(
+            context,
+            serialized.data(),
+            &serializedLength,
+            &publicKey,
+            SECP256K1_EC_UNCOMPRESSED);
+        // address = last 20 bytes of keccak256(X || Y), skipping the 0x04
+        // format byte
+        std::array<unsigned char, HASH_LENGTH> publicKeyHash{};
+        CryptoPP::Keccak_256 keccak;
+        keccak.CalculateDigest(
+            publicKeyHash.data(), serialized.data() + 1, serializedLength - 1);
         return std::string(
-            reinterpret_cast<char*>(signatureData), sizeof(signatureData));
+            reinterpret_cast<const char*>(publicKeyHash.data()) + HASH_LENGTH -
+                ADDRESS_LENGTH,
+            ADDRESS_LENGTH);
+    }
+
+    // True if `signature` over payloadBinaryString was made with the key
+    // of the 20-byte binary `address`.
+    static bool verifySignature(
+        const std::string& address,
+        const std::string& payloadBinaryString, // NOLINT
+        const std::string& signature) {
+        const auto recovered =
+            SigningUtils::recoverAddress(payloadBinaryString, signature);
+        return recovered.has_value() && recovered.value() == address;
     }
 
     static std::string hash(const std::string& payloadBinaryString) {
-        const std::string prefixString = std::string(SIGN_MAGIC) +
-            std::to_string(payloadBinaryString.length());
-        std::string hash;
+        return SigningUtils::hashParts({payloadBinaryString});
+    }
+
+    // hash() of the concatenation of `parts`, without building it.
+    static std::string hashParts(
+        std::initializer_list<std::string_view> parts) {
+        size_t length = 0;
+        for (const auto part : parts) {
+            length += part.size();
+        }
+        std::array<char, 20> lengthDigits{}; // NOLINT
+        const auto lengthEnd = std::to_chars(
+                                   lengthDigits.data(),
+                                   lengthDigits.data() + lengthDigits.size(),
+                                   length)
+                                   .ptr;
         CryptoPP::Keccak_256 keccak;
-        CryptoPP::StringSource ss(
-            prefixString + payloadBinaryString,
-            true,
-            new CryptoPP::HashFilter(keccak, new CryptoPP::StringSink(hash)));
+        update(keccak, SIGN_MAGIC);
+        update(
+            keccak,
+            std::string_view(
+                lengthDigits.data(),
+                static_cast<size_t>(lengthEnd - lengthDigits.data())));
+        for (const auto part : parts) {
+            update(keccak, part);
+        }
+        std::string hash(HASH_LENGTH, '\0');
+        keccak.Final(reinterpret_cast<CryptoPP::byte*>(hash.data()));
         return hash;
     }
+
+private:
+    static void update(CryptoPP::Keccak_256& keccak, std::string_view bytes) {
+        keccak.Update(
+            reinterpret_cast<const CryptoPP::byte*>(bytes.data()),
+            bytes.size());
+    }
 };
 
+/**
+ * Signs EVM-style (recoverable secp256k1 over the Ethereum signed-message
+ * hash) with one private key, parsed and checked once. Each thread signs
+ * with its own context, randomized on creation to blind the signing
+ * against side channels. Thread-safe.
+ */
+class Signer {
+private:
+    static constexpr size_t PRIVATE_KEY_LENGTH = 32;
+    static constexpr int RECOVERY_ID_OFFSET = 27;
+
+    struct ThreadContext {
+        secp256k1_context* context =
+            secp256k1_context_create(SECP256K1_CONTEXT_SIGN);
+
+        ThreadContext() {
+            std::array<unsigned char, PRIVATE_KEY_LENGTH> seed{};
+            CryptoPP::AutoSeededRandomPool random;
+            random.GenerateBlock(seed.data(), seed.size());
+            // Only fails for a context that cannot sign; signing with an
+            // unrandomized context is still correct.
+            static_cast<void>(
+                secp256k1_context_randomize(this->context, seed.data()));
+            CryptoPP::SecureWipeArray(seed.data(), seed.size());
+        }
+        ~ThreadContext() { secp256k1_context_destroy(this->context); }
+        ThreadContext(const ThreadContext&) = delete;
+        ThreadContext& operator=(const ThreadContext&) = delete;
+        ThreadContext(ThreadContext&&) = delete;
+        ThreadContext& operator=(ThreadContext&&) = delete;
+    };
+
+    std::array<unsigned char, PRIVATE_KEY_LENGTH> privateKey{};
+
+    static secp256k1_context* threadContext() {
+        thread_local ThreadContext threadContext;
+        return threadContext.context;
+    }
+
+public:
+    // Throws std::invalid_argument if the key is not a valid secp256k1
+    // private key.
+    explicit Signer(const std::string& privateKeyHex) {
+        auto binary = BinaryUtils::hexToBinaryString(privateKeyHex);
+        if (binary.size() != PRIVATE_KEY_LENGTH) {
+            throw std::invalid_argument("Invalid private key length");
+        }
+        std::ranges::copy(binary, this->privateKey.begin());
+        CryptoPP::SecureWipeArray(binary.data(), binary.size());
+        if (!secp256k1_ec_seckey_verify(
+                Signer::threadContext(), this->privateKey.data())) {
+            throw std::invalid_argument("Invalid private key");
+        }
+    }
+
+    ~Signer() {
+        CryptoPP::SecureWipeArray(
+            this->privateKey.data(), this->privateKey.size());
+    }
+
+    Signer(const Signer&) = default;
+    Signer& operator=(const Signer&) = default;
+    Signer(Signer&&) = default;
+    Signer& operator=(Signer&&) = default;
+
+    // 65-byte r || s || v signature, v = 27 + recovery id.
+    [[nodiscard]] std::string sign(std::string_view payload) const {
+        return this->signHash(SigningUtils::hashParts({payload}));
+    }
+
+    // sign() of the concatenation of `parts`, without building it.
+    [[nodiscard]] std::string signParts(
+        std::initializer_list<std::string_view> parts) const {
+        return this->signHash(SigningUtils::hashParts(parts));
+    }
+
+    // Signs a 32-byte SigningUtils::hash() digest.
+    [[nodiscard]] std::string signHash(std::string_view hash) const {
+        if (hash.size() != SigningUtils::HASH_LENGTH) {
+            throw std::invalid_argument("Hash must be 32 bytes");
+        }
+        auto* context = Signer::threadContext();
+        secp256k1_ecdsa_recoverable_signature secpSignature;
+        if (!secp256k1_ecdsa_sign_recoverable(
+                context,
+                &secpSignature,
+                reinterpret_cast<const unsigned char*>(hash.data()),
+                this->privateKey.data(),
+                nullptr,
+                nullptr)) {
+            throw std::runtime_error("Signing failed");
+        }
+        int recid = 0;
+        std::string signature(SigningUtils::SIGNATURE_LENGTH, '\0');
+        auto* signatureData =
+            reinterpret_cast<unsigned char*>(signature.data());
+        secp256k1_ecdsa_recoverable_signature_serialize_compact(
+            context, signatureData, &recid, &secpSignature);
+        signatureData[SigningUtils::SIGNATURE_LENGTH - 1] =
+            static_cast<unsigned char>(RECOVERY_ID_OFFSET + recid);
+        return signature;
+    }
+};
+
+inline std::string SigningUtils::createSignature(
+    const std::string& payloadBinaryString, // NOLINT
+    const std::string& privateKeyHex) {
+    return Signer(privateKeyHex).sign(payloadBinaryString);
+}
+
 } // namespace streamr::utils
\ No newline at end of file
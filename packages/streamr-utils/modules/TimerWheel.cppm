@@ -0,0 +1,160 @@
+// Module streamr.utils.TimerWheel
+// Native-only (no TS counterpart): a hierarchical timer wheel for owners
+// that expire many values on their own schedule (TS would give each value
+// its own setTimeout).
+//
+// Four levels of 64 slots each. A timer sits in the lowest level whose
+// slots still distinguish its deadline from the current tick, and moves
+// down a level each time the wheel reaches its slot, so scheduling is O(1)
+// and advancing touches only the slots that come due. Deadlines further
+// out than the top level wait in an overflow list that is re-examined
+// each time the top level wraps.
+//
+// Timers cannot be cancelled: an owner that replaces or drops a value
+// checks, when its timer fires, whether the value is still current. The
+// wheel is not thread-safe; its owner serializes access.
+module;
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+export module streamr.utils.TimerWheel;
+
+export namespace streamr::utils {
+
+template <typename T>
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    static constexpr size_t slotBits = 6;
+    static constexpr size_t slotCount = size_t{1} << slotBits;
+    static constexpr uint64_t slotMask = slotCount - 1;
+    static constexpr size_t levelCount = 4;
+
+    struct Timer {
+        uint64_t tick;
+        T value;
+    };
+
+    using Slot = std::vector<Timer>;
+
+    Clock::duration tickDuration;
+    Clock::time_point origin;
+    uint64_t currentTick = 0;
+    size_t timerCount = 0;
+    std::array<std::array<Slot, slotCount>, levelCount> levels;
+    Slot overflow;
+
+    // Whether the low `bits` bits of the current tick are all zero, i.e.
+    // the wheel just reached a slot boundary of the level above them.
+    [[nodiscard]] bool atBoundary(size_t bits) const {
+        return (this->currentTick & ((uint64_t{1} << bits) - 1)) == 0;
+    }
+
+    // The first tick at or after `deadline`, so no timer fires early.
+    [[nodiscard]] uint64_t tickOf(Clock::time_point deadline) const {
+        if (deadline <= this->origin) {
+            return 0;
+        }
+        const auto elapsed = (deadline - this->origin).count();
+        const auto tick = this->tickDuration.count();
+        return static_cast<uint64_t>((elapsed + tick - 1) / tick);
+    }
+
+    void place(Timer timer) {
+        for (size_t level = 0; level < levelCount; ++level) {
+            const size_t shift = slotBits * (level + 1);
+            if ((timer.tick >> shift) == (this->currentTick >> shift)) {
+                const auto slot = (timer.tick >> (slotBits * level)) & slotMask;
+                this->levels[level][slot].push_back(std::move(timer));
+                return;
+            }
+        }
+        this->overflow.push_back(std::move(timer));
+    }
+
+    void cascade(Slot& slot) {
+        Slot timers;
+        timers.swap(slot);
+        for (auto& timer : timers) {
+            this->place(std::move(timer));
+        }
+    }
+
+public:
+    explicit TimerWheel(
+        std::chrono::milliseconds tickDuration,
+        Clock::time_point origin = Clock::now())
+        : tickDuration(
+              std::chrono::duration_cast<Clock::duration>(tickDuration)),
+          origin(origin) {}
+
+    // Fires `value` from the first advance() at or after `deadline`.
+    void schedule(Clock::time_point deadline, T value) {
+        // The current tick's slot has already fired.
+        const uint64_t tick =
+            std::max(this->tickOf(deadline), this->currentTick + 1);
+        this->place(Timer{.tick = tick, .value = std::move(value)});
+        this->timerCount++;
+    }
+
+    // Moves the wheel to `now` and calls onExpired(T&&) for every timer
+    // that came due, earliest tick first. Returns the number fired.
+    template <typename Fn>
+    size_t advance(Clock::time_point now, Fn onExpired) {
+        const auto nowTick = now <= this->origin
+            ? 0
+            : static_cast<uint64_t>(
+                  (now - this->origin).count() / this->tickDuration.count());
+        size_t fired = 0;
+        while (this->currentTick < nowTick) {
+            if (this->timerCount == 0) {
+                this->currentTick = nowTick;
+                break;
+            }
+            this->currentTick++;
+            if (this->atBoundary(slotBits * levelCount)) {
+                this->cascade(this->overflow);
+            }
+            // Higher levels first: their timers may land in a lower slot
+            // that is cascaded or fired on this same tick.
+            for (size_t level = levelCount - 1; level > 0; --level) {
+                const size_t shift = slotBits * level;
+                if (this->atBoundary(shift)) {
+                    const auto slot = (this->currentTick >> shift) & slotMask;
+                    this->cascade(this->levels[level][slot]);
+                }
+            }
+            Slot due;
+            due.swap(this->levels[0][this->currentTick & slotMask]);
+            this->timerCount -= due.size();
+            for (auto& timer : due) {
+                onExpired(std::move(timer.value));
+            }
+            fired += due.size();
+        }
+        return fired;
+    }
+
+    // Timers scheduled and not yet fired.
+    [[nodiscard]] size_t size() const { return this->timerCount; }
+
+    void clear() {
+        for (auto& level : this->levels) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        this->overflow.clear();
+        this->timerCount = 0;
+    }
+};
+
+} // namespace streamr::utils
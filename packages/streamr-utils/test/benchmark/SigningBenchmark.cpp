@@ -0,0 +1,74 @@
+// Microbenchmark: signing throughput for a typical StreamMessage payload
+// with a one-off key per signature (SigningUtils::createSignature), a
+// reused Signer, and a reused Signer hashing the payload fields in place
+// (the proxy client publish path). Not registered with ctest; run the
+// binary directly (a Release build gives meaningful numbers).
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "BenchmarkReport.hpp"
+
+import streamr.utils.SigningUtils;
+
+using streamr::utils::Signer;
+using streamr::utils::benchmark::report;
+using streamr::utils::SigningUtils;
+
+namespace {
+
+constexpr size_t signatureCount = 20000;
+constexpr size_t contentSize = 256;
+
+const std::string privateKeyHex =
+    "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+const std::string publisherIdHex = "0xa5374e3c19f15e1847881979dd0c6c9ffe846bd5";
+const std::string content(contentSize, 'x');
+
+void run(const std::string& name, const std::function<std::string()>& sign) {
+    size_t bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < signatureCount; ++i) {
+        bytes += sign().size();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    report(name, signatureCount, "signatures", elapsed.count());
+    EXPECT_EQ(bytes, signatureCount * SigningUtils::SIGNATURE_LENGTH);
+}
+
+std::string concatenatedPayload() {
+    return "stream/path" + std::to_string(0) + std::to_string(1700000000000) +
+        std::to_string(42) + publisherIdHex + "1" + content; // NOLINT
+}
+
+} // namespace
+
+TEST(SigningBenchmark, CreateSignature) {
+    run("createSignature", []() {
+        return SigningUtils::createSignature(
+            concatenatedPayload(), privateKeyHex);
+    });
+}
+
+TEST(SigningBenchmark, ReusedSigner) {
+    const Signer signer(privateKeyHex);
+    run("Signer::sign",
+        [&signer]() { return signer.sign(concatenatedPayload()); });
+}
+
+TEST(SigningBenchmark, ReusedSignerHashingParts) {
+    const Signer signer(privateKeyHex);
+    run("Signer::signParts", [&signer]() {
+        return signer.signParts(
+            {"stream/path",
+             "0",
+             "1700000000000",
+             "42",
+             publisherIdHex,
+             "1",
+             content});
+    });
+}
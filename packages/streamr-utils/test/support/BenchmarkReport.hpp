@@ -0,0 +1,37 @@
+// Output helpers shared by the microbenchmarks of the monorepo packages
+// (test/benchmark/*). This is a plain header, NOT a module: it is test-only
+// and the other packages' benchmark targets include it by path, so it does
+// not have to ship in the streamr-utils library.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string_view>
+
+namespace streamr::utils::benchmark {
+
+// Prints "[ BENCH    ] <name>: <count> <unit>, <rate> <unit>/s" in the
+// column of gtest's own output, followed by ", <details>" if given.
+inline void report(
+    std::string_view name,
+    size_t count,
+    std::string_view unit,
+    double seconds,
+    std::string_view details = {}) {
+    std::cout << "[ BENCH    ] " << name << ": " << count << " " << unit
+              << ", "
+              << static_cast<uint64_t>(static_cast<double>(count) / seconds)
+              << " " << unit << "/s";
+    if (!details.empty()) {
+        std::cout << ", " << details;
+    }
+    std::cout << "\n";
+}
+
+// Prints "[ BENCH    ] <message>" for figures that are not a rate.
+inline void note(std::string_view message) {
+    std::cout << "[ BENCH    ] " << message << "\n";
+}
+
+} // namespace streamr::utils::benchmark
@@ -1,9 +1,12 @@
+#include <stdexcept>
+#include <string>
 #include <gtest/gtest.h>
 
 import streamr.utils.BinaryUtils;
 import streamr.utils.SigningUtils;
 
 using streamr::utils::BinaryUtils;
+using streamr::utils::Signer;
 using streamr::utils::SigningUtils;
 
 TEST(SigninUtilsTest, createSignature) {
@@ -31,4 +34,64 @@ TEST(SigninUtilsTest, hash) {
     std::string lowerCaseHash;
     std::ranges::transform(hash, std::back_inserter(lowerCaseHash), ::tolower);
     EXPECT_EQ(hash, expectedHash);
-}
\ No newline at end of file
+}
+TEST(SigninUtilsTest, recoverAddress) {
+    const std::string privateKeyHex =
+        "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+    const std::string expectedAddressHex =
+        "a5374e3c19f15e1847881979dd0c6c9ffe846bd5";
+    const auto payload = std::string("data-to-sign");
+    const auto signature =
+        SigningUtils::createSignature(payload, privateKeyHex);
+    const auto address = SigningUtils::recoverAddress(payload, signature);
+    ASSERT_TRUE(address.has_value());
+    EXPECT_EQ(BinaryUtils::binaryStringToHex(*address), expectedAddressHex);
+    EXPECT_TRUE(SigningUtils::verifySignature(
+        BinaryUtils::hexToBinaryString(expectedAddressHex),
+        payload,
+        signature));
+}
+
+TEST(SigninUtilsTest, verifySignatureRejectsTamperedInput) {
+    const std::string privateKeyHex =
+        "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+    const auto address = BinaryUtils::hexToBinaryString(
+        "a5374e3c19f15e1847881979dd0c6c9ffe846bd5");
+    const auto signature =
+        SigningUtils::createSignature("data-to-sign", privateKeyHex);
+    EXPECT_FALSE(
+        SigningUtils::verifySignature(address, "data-to-sigN", signature));
+    EXPECT_FALSE(SigningUtils::verifySignature(
+        address, "data-to-sign", signature.substr(0, 64)));
+    auto badRecoveryId = signature;
+    badRecoveryId.back() = 0x7f;
+    EXPECT_FALSE(SigningUtils::recoverAddress("data-to-sign", badRecoveryId)
+                     .has_value());
+}
+
+TEST(SigninUtilsTest, signerMatchesCreateSignature) {
+    const std::string privateKeyHex =
+        "23bead9b499af21c4c16e4511b3b6b08c3e22e76e0591f5ab5ba8d4c3a5b1820";
+    const Signer signer(privateKeyHex);
+    EXPECT_EQ(
+        signer.sign("data-to-sign"),
+        SigningUtils::createSignature("data-to-sign", privateKeyHex));
+    // Signing is deterministic (RFC 6979) despite the randomized context.
+    EXPECT_EQ(
+        signer.signParts({"data", "-to-", "sign"}),
+        signer.sign("data-to-sign"));
+}
+
+TEST(SigninUtilsTest, hashPartsMatchesHash) {
+    EXPECT_EQ(
+        SigningUtils::hashParts({"stream", "0", "", "1700000000000"}),
+        SigningUtils::hash("stream01700000000000"));
+    EXPECT_EQ(SigningUtils::hashParts({}), SigningUtils::hash(""));
+}
+
+TEST(SigninUtilsTest, signerRejectsInvalidKeys) {
+    EXPECT_THROW(Signer("1234"), std::invalid_argument);
+    EXPECT_THROW(
+        Signer(std::string(64, '0')), // NOLINT
+        std::invalid_argument);
+}
@@ -0,0 +1,90 @@
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+import streamr.utils.TimerWheel;
+
+using streamr::utils::TimerWheel;
+using Clock = TimerWheel<int>::Clock;
+using std::chrono::milliseconds;
+
+// NOLINTBEGIN(readability-magic-numbers)
+
+namespace {
+
+const Clock::time_point origin{};
+
+std::vector<int> advanceTo(TimerWheel<int>& wheel, milliseconds now) {
+    std::vector<int> fired;
+    wheel.advance(origin + now, [&fired](int value) {
+        fired.push_back(value);
+    });
+    return fired;
+}
+
+} // namespace
+
+TEST(TimerWheelTest, FiresTimersWhenTheyComeDue) {
+    TimerWheel<int> wheel(milliseconds(10), origin);
+    wheel.schedule(origin + milliseconds(30), 1);
+    wheel.schedule(origin + milliseconds(15), 2);
+    EXPECT_EQ(wheel.size(), 2U);
+    EXPECT_TRUE(advanceTo(wheel, milliseconds(10)).empty());
+    EXPECT_EQ(advanceTo(wheel, milliseconds(25)), std::vector<int>{2});
+    EXPECT_EQ(advanceTo(wheel, milliseconds(30)), std::vector<int>{1});
+    EXPECT_EQ(wheel.size(), 0U);
+}
+
+TEST(TimerWheelTest, NeverFiresEarly) {
+    TimerWheel<int> wheel(milliseconds(10), origin);
+    wheel.schedule(origin + milliseconds(11), 1);
+    EXPECT_TRUE(advanceTo(wheel, milliseconds(19)).empty());
+    EXPECT_EQ(advanceTo(wheel, milliseconds(20)), std::vector<int>{1});
+}
+
+TEST(TimerWheelTest, PastDeadlinesFireOnTheNextTick) {
+    TimerWheel<int> wheel(milliseconds(10), origin);
+    advanceTo(wheel, milliseconds(100));
+    wheel.schedule(origin + milliseconds(50), 1);
+    EXPECT_EQ(advanceTo(wheel, milliseconds(110)), std::vector<int>{1});
+}
+
+TEST(TimerWheelTest, CascadesFarDeadlinesInOrder) {
+    TimerWheel<int> wheel(milliseconds(1), origin);
+    // One deadline per level, and one past the top level.
+    const std::vector<milliseconds> deadlines{
+        milliseconds(20'000'000),
+        milliseconds(300'000),
+        milliseconds(5'000),
+        milliseconds(40)};
+    for (size_t i = 0; i < deadlines.size(); ++i) {
+        wheel.schedule(origin + deadlines[i], static_cast<int>(i));
+    }
+    std::vector<int> fired;
+    for (auto now = milliseconds(0); now <= milliseconds(20'000'000);
+         now += milliseconds(997)) {
+        for (const int value : advanceTo(wheel, now)) {
+            EXPECT_GE(now, deadlines[static_cast<size_t>(value)]);
+            EXPECT_LT(
+                now, deadlines[static_cast<size_t>(value)] + milliseconds(997));
+            fired.push_back(value);
+        }
+    }
+    fired.push_back(-1);
+    for (const int value : advanceTo(wheel, milliseconds(20'000'000))) {
+        fired.push_back(value);
+    }
+    EXPECT_EQ(fired, (std::vector<int>{3, 2, 1, -1, 0}));
+}
+
+TEST(TimerWheelTest, ClearDropsAllTimers) {
+    TimerWheel<int> wheel(milliseconds(10), origin);
+    wheel.schedule(origin + milliseconds(10), 1);
+    wheel.schedule(origin + milliseconds(100'000), 2);
+    wheel.clear();
+    EXPECT_EQ(wheel.size(), 0U);
+    EXPECT_TRUE(advanceTo(wheel, milliseconds(200'000)).empty());
+}
+
+// NOLINTEND(readability-magic-numbers)